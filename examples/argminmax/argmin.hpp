@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+#ifndef __ARGMIN_HPP
+#define __ARGMIN_HPP
+#include <array>
+#include <limits>
+#include <utility>
+#include "map.hpp"
+#include "arrayops.hpp"
+#include "divconq.hpp"
+#include "lazy.hpp"
+#include "batch.hpp"
+
+// I'd actually prefer a tuple - but that's not synthesizable...
+//
+// The index has type I, so that a kernel run in lockstep by
+// hops::batch holds one index per lane (see hops::LanesOf)
+template <typename T, typename I = std::size_t>
+struct argmin_t{
+	T data;
+	I idx;
+	std::size_t lev;
+	argmin_t<T, I> operator()(T const& v) const {
+#pragma HLS INLINE
+		return {v, I(0), 0};
+	}
+};
+
+// The indices of a sub-tree of lev levels are less than 2^lev, so
+// when R is smaller its index in the larger tree is R.idx | 2^lev.
+// select (see batch.hpp) replaces the ?: operator, so that Argminop
+// can be run in lockstep.
+struct Argminop{
+	template <typename T, typename I>
+	argmin_t<T, I> operator()(argmin_t<T, I> const& L, argmin_t<T, I> const& R) const{
+#pragma HLS INLINE
+		auto b = R.data < L.data;
+		std::size_t lev = L.lev;
+		T res = hops::select(b, R.data, L.data);
+		I idx = hops::select(b, I(R.idx | (I(1) << lev)), L.idx);
+		argmin_t<T, I> result = {res, idx, lev + 1};
+		return result;
+	}
+
+	template <typename T, typename I>
+ 	argmin_t<T, I> operator()(std::array<argmin_t<T, I>, 1> const& L,
+			std::array<argmin_t<T, I>, 1> const& R) const{
+#pragma HLS INLINE
+		return this->operator()(L[0], R[0]);
+	}
+
+	// On non-power-of-two-length arrays divconq can pair a
+	// sub-tree result with an unmodified leaf
+	template <typename T, typename I>
+ 	argmin_t<T, I> operator()(argmin_t<T, I> const& L,
+			std::array<argmin_t<T, I>, 1> const& R) const{
+#pragma HLS INLINE
+		return this->operator()(L, R[0]);
+	}
+};
+
+Argminop argminop;
+
+// The type of the index of an element of type T: std::size_t, or for
+// hops::Lanes, the Lanes of the comparison mask (an integer as wide
+// as the element), so that the comparisons and the selection of the
+// indices are vectorized together
+template <typename T>
+struct argmin_index{
+	typedef std::size_t type;
+	static const std::size_t max = std::numeric_limits<std::size_t>::max();
+};
+
+template <typename T, std::size_t B>
+struct argmin_index<hops::Lanes<T, B> >{
+	typedef typename hops::Lanes<T, B>::mask type;
+	static const std::size_t max = std::numeric_limits<typename hops::LaneMask<T>::type>::max();
+};
+
+// The (value, index) of the smallest element of IN, the kernel of
+// argmin_hop_synth. It is templated on the element type, so
+// hops::batch can run it on hops::Lanes.
+template <typename T, std::size_t LEN>
+auto argmin_hop(std::array<T, LEN> const& IN)
+	-> std::pair<T, typename hops::LanesOf<T, std::size_t>::type>{
+#pragma HLS INLINE
+	typedef typename argmin_index<T>::type I;
+	static_assert(LEN - 1 <= argmin_index<T>::max, "The index type is too narrow for LEN");
+	argmin_t<T, I> out = hops::divconq(argminop, hops::lazy(IN).map(argmin_t<T, I>()));
+	return std::make_pair(out.data, typename hops::LanesOf<T, std::size_t>::type(out.idx));
+}
+#endif // __ARGMIN_HPP
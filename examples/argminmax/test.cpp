@@ -38,9 +38,10 @@
 #include "map.hpp"
 #include "arrayops.hpp"
 #include "divconq.hpp"
+#include "argmin.hpp"
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
-typedef ap_int<1> last_t;
+#include "fixed.hpp"
+typedef hops::intw<1> last_t;
 #else
 typedef	bool last_t;
 #endif
@@ -49,39 +50,7 @@ using namespace hops;
 
 #define LOG_LIST_LENGTH 4
 #define LIST_LENGTH (1<<LOG_LIST_LENGTH)
-
-// I'd actually prefer a tuple - but that's not synthesizable...
-template <typename T>
-struct argmin_t{
-	T data;
-	std::size_t idx, lev;
-	argmin_t<T> operator()(T const& v) const {
-#pragma HLS INLINE
-		return {v, 0, 0};
-	}
-};
-
-struct Argminop{
-	template <typename T>
-	argmin_t<T> operator()(argmin_t<T> const& L, argmin_t<T> const& R) const{
-#pragma HLS INLINE
-		bool b = R.data < L.data;
-		std::size_t lev = L.lev;
-		T res = b ? R.data : L.data;
-		std::size_t idx = ((b & 1) << lev) | (b ? R.idx : L.idx);
-		argmin_t<T> result = {res, idx, lev + 1};
-		return result;
-	}
-
-	template <typename T>
- 	argmin_t<T> operator()(std::array<argmin_t<T>, 1> const& L,
-			std::array<argmin_t<T>, 1> const& R) const{
-#pragma HLS INLINE
-		return this->operator()(L[0], R[0]);
-	}
-};
-
-Argminop argminop;
+#define ODD_LIST_LENGTH 13
 
 std::pair<int, std::size_t> argmin_loop_synth(std::array<int, LIST_LENGTH> IN){
 #pragma HLS ARRAY_PARTITION variable=IN._M_instance
@@ -109,8 +78,14 @@ std::pair<int, std::size_t> argmin_hop_synth(std::array<int, LIST_LENGTH> IN){
 #pragma HLS ARRAY_PARTITION variable=IN._M_instance
 #pragma HLS INLINE
 #pragma HLS PIPELINE
-	argmin_t<int> out = divconq(argminop, map(argmin_t<int>(), IN));
-	return std::make_pair(out.data, out.idx);
+	return argmin_hop(IN);
+}
+
+std::pair<int, std::size_t> argmin_odd_hop_synth(std::array<int, ODD_LIST_LENGTH> IN){
+#pragma HLS ARRAY_PARTITION variable=IN._M_instance
+#pragma HLS INLINE
+#pragma HLS PIPELINE
+	return argmin_hop(IN);
 }
 
 int argmin_test(){
@@ -156,6 +131,31 @@ int argmin_test(){
 	}
 	std::cout << "argmin_hop_synth test passed" << std::endl;
 
+	std::array<int, ODD_LIST_LENGTH> oddinput;
+	fill_normal(oddinput);
+	gold = {oddinput[0], 0};
+	for(int i = 1; i < ODD_LIST_LENGTH; ++i){
+		if(oddinput[i] < gold.first){
+			gold.first = oddinput[i];
+			gold.second = i;
+		}
+	}
+
+	output = argmin_odd_hop_synth(oddinput);
+	if(output.first != gold.first){
+		std::cout << "Failed argmin_odd_hop_synth (value) test! Output: "
+			  << output.first << ", Gold: " << gold.first
+			  << std::endl;
+		exit(-1);
+	}
+	if(output.second != gold.second){
+		std::cout << "Failed argmin_odd_hop_synth (index) test! Output: "
+			  << output.second << ", Gold: " << gold.second
+			  << std::endl;
+		exit(-1);
+	}
+	std::cout << "argmin_odd_hop_synth test passed" << std::endl;
+
 	printf("ArgminTests Passed!\n");
 	return 0;
 }
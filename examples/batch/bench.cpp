@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+#include <array>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <vector>
+#include "batch.hpp"
+#include "span.hpp"
+#include "kernels.hpp"
+
+using namespace hops;
+// LIST_LENGTH (the number of problems) is set by the bench rule in
+// include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 64
+#endif
+#define BENCH_ITERATIONS (1<<16)/LIST_LENGTH
+#define NUM_LANES 8
+
+// Times K on every problem in IN, once per problem and then B
+// problems at a time. After each call, FB writes part of each result
+// back to its problem, so that every call depends on the previous one
+template <class FN, class FBN, typename X, typename R>
+void bench_kernel(char const* NAME, FN const& K, FBN const& FB,
+		std::vector<X> const& IN, std::vector<R>& problem,
+		std::vector<R>& lockstep){
+	std::vector<X> problem_in(IN), lockstep_in(IN);
+	double problem_ns, lockstep_ns;
+	problem_ns = bench_ns([&](){
+			for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+				problem[i] = K(problem_in[i]);
+				FB(problem_in[i], problem[i]);
+			}
+		}, BENCH_ITERATIONS);
+	lockstep_ns = bench_ns([&](){
+			dyn::Span<R> out = dyn::span(lockstep);
+			dyn::Span<X> in = dyn::span(lockstep_in);
+			for(std::size_t i = 0; i < LIST_LENGTH; i += NUM_LANES){
+				batch<NUM_LANES>(K, out.subspan(i, NUM_LANES), in.subspan(i, NUM_LANES));
+				for(std::size_t b = i; b < i + NUM_LANES; ++b){
+					FB(lockstep_in[b], lockstep[b]);
+				}
+			}
+		}, BENCH_ITERATIONS);
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH << " " << NAME
+		  << ": per-problem: " << problem_ns / LIST_LENGTH << " ns/problem, "
+		  << "batch<" << NUM_LANES << ">: " << lockstep_ns / LIST_LENGTH
+		  << " ns/problem" << std::endl;
+}
+
+// Writing the minimum back to its index keeps the inputs unchanged
+struct ArgminFeedback{
+	void operator()(std::array<int, ARGMIN_LENGTH>& IN,
+			std::pair<int, std::size_t> const& R) const{
+		IN[R.second] = R.first;
+	}
+};
+
+// Multiplying by zero keeps the inputs unchanged, but is not folded
+// away for floating-point types
+struct FIRFeedback{
+	void operator()(std::array<float, FIR_LENGTH>& IN,
+			std::array<float, FIR_LENGTH> const& R) const{
+		IN[0] += R[FIR_LENGTH - 1] * 0.f;
+	}
+};
+
+struct FFTFeedback{
+	void operator()(std::array<std::complex<float>, FFT_LENGTH>& IN,
+			std::array<std::complex<float>, FFT_LENGTH> const& R) const{
+		IN[0] += R[0] * 0.f;
+	}
+};
+
+int main(){
+	std::vector<std::array<int, ARGMIN_LENGTH> > argmin_in(LIST_LENGTH);
+	std::vector<std::pair<int, std::size_t> > argmin_problem(LIST_LENGTH), argmin_lockstep(LIST_LENGTH);
+	std::vector<std::array<float, FIR_LENGTH> > fir_in(LIST_LENGTH);
+	std::vector<std::array<float, FIR_LENGTH> > fir_problem(LIST_LENGTH), fir_lockstep(LIST_LENGTH);
+	std::vector<std::array<std::complex<float>, FFT_LENGTH> > fft_in(LIST_LENGTH);
+	std::vector<std::array<std::complex<float>, FFT_LENGTH> > fft_problem(LIST_LENGTH), fft_lockstep(LIST_LENGTH);
+	for(std::size_t p = 0; p < LIST_LENGTH; ++p){
+		fill_problem(p, argmin_in[p], fir_in[p], fft_in[p]);
+	}
+
+	bench_kernel("argmin (32 int)", Argmin(), ArgminFeedback(), argmin_in, argmin_problem, argmin_lockstep);
+	if(argmin_problem != argmin_lockstep){
+		std::cerr << "Failed argmin benchmark! Results differ" << std::endl;
+		return -1;
+	}
+
+	bench_kernel("fir (16 float taps, 64 samples)", FIR(), FIRFeedback(), fir_in, fir_problem, fir_lockstep);
+	for(std::size_t p = 0; p < LIST_LENGTH; ++p){
+		for(std::size_t i = 0; i < FIR_LENGTH; ++i){
+			if(std::abs(fir_problem[p][i] - fir_lockstep[p][i]) > .1){
+				std::cerr << "Failed fir benchmark! Results differ" << std::endl;
+				return -1;
+			}
+		}
+	}
+
+	bench_kernel("fft (64 complex<float>)", FFT(), FFTFeedback(), fft_in, fft_problem, fft_lockstep);
+	for(std::size_t p = 0; p < LIST_LENGTH; ++p){
+		for(std::size_t i = 0; i < FFT_LENGTH; ++i){
+			if(std::abs(fft_problem[p][i] - fft_lockstep[p][i]) > .01){
+				std::cerr << "Failed fft benchmark! Results differ" << std::endl;
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// The kernels of the batch test and benchmark: argmin_hop (see
+// ../argminmax/argmin.hpp), fir_hop (see
+// ../finite_impulse_response/fir.hpp) and fft (see
+// ../fast_fourier_transform/fft.hpp). Each is templated on its element
+// type, and is wrapped in a functor so that it can be passed to
+// hops::batch and run in lockstep.
+#ifndef __KERNELS_HPP
+#define __KERNELS_HPP
+#include <algorithm>
+#include <array>
+#include <complex>
+#include "batch.hpp"
+#include "argmin.hpp"
+#include "fir.hpp"
+#include "fft.hpp"
+#include "utility.hpp"
+
+#define ARGMIN_LENGTH 32
+#define FIR_LENGTH 64
+#define FFT_LENGTH 64
+
+// The (value, index) of the smallest element of each problem
+struct Argmin{
+	template <typename T, std::size_t LEN>
+	auto operator()(std::array<T, LEN> const& IN) const
+		-> decltype(argmin_hop(IN)){
+#pragma HLS INLINE
+		return argmin_hop(IN);
+	}
+};
+
+// Filters each problem, a signal of LEN samples, from an empty delay
+// line
+struct FIR{
+	template <typename T, std::size_t LEN>
+	std::array<T, LEN> operator()(std::array<T, LEN> const& IN) const{
+#pragma HLS INLINE
+		static const std::array<float, C_NUM_TAPS> coeffs = {COEFFS_INIT};
+		hops::DelayLine<T, C_NUM_TAPS> sig;
+		std::array<T, LEN> out;
+		for(std::size_t i = 0; i < LEN; ++i){
+			out[i] = fir_hop(sig, coeffs, IN[i]);
+		}
+		return out;
+	}
+};
+
+// The radix-2 FFT of each problem
+struct FFT{
+	template <typename C, std::size_t LEN>
+	std::array<C, LEN> operator()(std::array<C, LEN> const& IN) const{
+#pragma HLS INLINE
+		return fft(IN);
+	}
+};
+
+// Fills problem P of each kernel from a normal distribution, rotated
+// by P so that the problems differ
+void fill_problem(std::size_t P, std::array<int, ARGMIN_LENGTH>& ARGMIN,
+		std::array<float, FIR_LENGTH>& SIGNAL,
+		std::array<std::complex<float>, FFT_LENGTH>& POINTS){
+	std::array<int, FIR_LENGTH> samples;
+	std::array<int, FFT_LENGTH> re, im;
+	fill_normal(ARGMIN);
+	std::rotate(ARGMIN.begin(), ARGMIN.begin() + P % ARGMIN_LENGTH, ARGMIN.end());
+	fill_normal<3>(samples);
+	std::rotate(samples.begin(), samples.begin() + P % FIR_LENGTH, samples.end());
+	std::copy(samples.begin(), samples.end(), SIGNAL.begin());
+	fill_normal<5>(re);
+	fill_normal<7>(im);
+	std::rotate(re.begin(), re.begin() + P % FFT_LENGTH, re.end());
+	for(std::size_t i = 0; i < FFT_LENGTH; ++i){
+		POINTS[i] = std::complex<float>(re[i], im[i]);
+	}
+}
+#endif // __KERNELS_HPP
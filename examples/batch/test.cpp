@@ -0,0 +1,202 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+#include <array>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <vector>
+#include "batch.hpp"
+#include "span.hpp"
+#include "kernels.hpp"
+
+using namespace hops;
+#define NUM_PROBLEMS 37
+#define NUM_LANES 8
+
+// -------------------- Argmin Test --------------------
+void argmin_batch_synth(std::array<int, ARGMIN_LENGTH> const* IN,
+			std::pair<int, std::size_t>* OUT, std::size_t N){
+	batch<NUM_LANES>(Argmin(), dyn::Span<std::pair<int, std::size_t> >(OUT, N),
+			dyn::Span<std::array<int, ARGMIN_LENGTH> const>(IN, N));
+}
+
+// Not templated, so it is run once per problem
+std::pair<int, std::size_t> argmin_scalar(std::array<int, ARGMIN_LENGTH> const& IN){
+#pragma HLS INLINE
+	return argmin_hop(IN);
+}
+
+int argmin_test(std::vector<std::array<int, ARGMIN_LENGTH> > const& input){
+	std::vector<std::pair<int, std::size_t> > output(NUM_PROBLEMS), scalar(NUM_PROBLEMS), gold;
+	for(std::size_t p = 0; p < NUM_PROBLEMS; ++p){
+		auto m = std::min_element(input[p].begin(), input[p].end());
+		gold.push_back(std::make_pair(*m, std::size_t(m - input[p].begin())));
+	}
+
+	std::cout << "Running argmin_batch_synth test... ";
+	static_assert(BatchCallable<Argmin, NUM_LANES,
+		      std::tuple<std::array<int, ARGMIN_LENGTH> > >::value,
+		      "Argmin should run in lockstep");
+	argmin_batch_synth(input.data(), output.data(), NUM_PROBLEMS);
+	if(output != gold){
+		std::cerr << "Failed argmin_batch_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed argmin_batch_synth test!" << std::endl;
+
+	std::cout << "Running argmin per-problem batch test... ";
+	static_assert(!BatchCallable<decltype(&argmin_scalar), NUM_LANES,
+		      std::tuple<std::array<int, ARGMIN_LENGTH> > >::value,
+		      "argmin_scalar should run once per problem");
+	batch<NUM_LANES>(argmin_scalar, dyn::span(scalar), dyn::span(input));
+	if(scalar != gold){
+		std::cerr << "Failed argmin per-problem batch test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed argmin per-problem batch test!" << std::endl;
+	return 0;
+}
+// -------------------- End Argmin Test --------------------
+
+// -------------------- FIR Test --------------------
+void fir_batch_synth(std::array<float, FIR_LENGTH> const* IN,
+		std::array<float, FIR_LENGTH>* OUT, std::size_t N){
+	batch<NUM_LANES>(FIR(), dyn::Span<std::array<float, FIR_LENGTH> >(OUT, N),
+			dyn::Span<std::array<float, FIR_LENGTH> const>(IN, N));
+}
+
+int fir_test(std::vector<std::array<float, FIR_LENGTH> > const& input){
+	static const std::array<float, C_NUM_TAPS> coeffs = {COEFFS_INIT};
+	std::vector<std::array<float, FIR_LENGTH> > output(NUM_PROBLEMS);
+
+	std::cout << "Running fir_batch_synth test... ";
+	static_assert(BatchCallable<FIR, NUM_LANES,
+		      std::tuple<std::array<float, FIR_LENGTH> > >::value,
+		      "FIR should run in lockstep");
+	fir_batch_synth(input.data(), output.data(), NUM_PROBLEMS);
+	for(std::size_t p = 0; p < NUM_PROBLEMS; ++p){
+		for(std::size_t i = 0; i < FIR_LENGTH; ++i){
+			float gold = 0;
+			for(std::size_t t = 0; t < C_NUM_TAPS && t <= i; ++t){
+				gold += coeffs[t] * input[p][i - t];
+			}
+			if(std::abs(output[p][i] - gold) > .1){
+				std::cerr << "Failed fir_batch_synth test!" << std::endl;
+				exit(-1);
+			}
+		}
+	}
+	std::cout << "Passed fir_batch_synth test!" << std::endl;
+	return 0;
+}
+// -------------------- End FIR Test --------------------
+
+// -------------------- FFT Test --------------------
+void fft_batch_synth(std::array<std::complex<float>, FFT_LENGTH> const* IN,
+		std::array<std::complex<float>, FFT_LENGTH>* OUT, std::size_t N){
+	batch<NUM_LANES>(FFT(), dyn::Span<std::array<std::complex<float>, FFT_LENGTH> >(OUT, N),
+			dyn::Span<std::array<std::complex<float>, FFT_LENGTH> const>(IN, N));
+}
+
+int fft_test(std::vector<std::array<std::complex<float>, FFT_LENGTH> > const& input){
+	std::vector<std::array<std::complex<float>, FFT_LENGTH> > output(NUM_PROBLEMS);
+
+	std::cout << "Running fft_batch_synth test... ";
+	static_assert(BatchCallable<FFT, NUM_LANES,
+		      std::tuple<std::array<std::complex<float>, FFT_LENGTH> > >::value,
+		      "FFT should run in lockstep");
+	fft_batch_synth(input.data(), output.data(), NUM_PROBLEMS);
+	for(std::size_t p = 0; p < NUM_PROBLEMS; ++p){
+		std::array<std::complex<float>, FFT_LENGTH> gold = fft(input[p]);
+		for(std::size_t i = 0; i < FFT_LENGTH; ++i){
+			if(std::abs(output[p][i] - gold[i]) > .01){
+				std::cerr << "Failed fft_batch_synth test!" << std::endl;
+				exit(-1);
+			}
+		}
+	}
+	std::cout << "Passed fft_batch_synth test!" << std::endl;
+	return 0;
+}
+// -------------------- End FFT Test --------------------
+
+// -------------------- Lanes Test --------------------
+int lanes_test(){
+	Lanes<int, 4> a, b, c;
+	Lanes<int, 4>::mask m;
+	LaneComplex<int, 4> x, y, z;
+	for(std::size_t i = 0; i < 4; ++i){
+		a[i] = i + 1;
+		b[i] = 4 - i;
+	}
+
+	std::cout << "Running lanes test... ";
+	c = (a * b + 2) % 5;
+	m = (a < b) || !(a != 3);
+	c += select(m, -a, ~b << 1);
+	x = LaneComplex<int, 4>(a, b);
+	y = LaneComplex<int, 4>(b, -a);
+	z = x * y - x;
+	for(std::size_t i = 0; i < 4; ++i){
+		int ai = i + 1, bi = 4 - i;
+		bool mi = (ai < bi) || !(ai != 3);
+		std::complex<int> zi = std::complex<int>(ai, bi) * std::complex<int>(bi, -ai)
+			- std::complex<int>(ai, bi);
+		if(c[i] != (ai * bi + 2) % 5 + (mi ? -ai : ~bi << 1) ||
+		   z.real()[i] != zi.real() || z.imag()[i] != zi.imag()){
+			std::cerr << "Failed lanes test!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed lanes test!" << std::endl;
+	return 0;
+}
+// -------------------- End Lanes Test --------------------
+
+int main(){
+	std::vector<std::array<int, ARGMIN_LENGTH> > argmin_in(NUM_PROBLEMS);
+	std::vector<std::array<float, FIR_LENGTH> > fir_in(NUM_PROBLEMS);
+	std::vector<std::array<std::complex<float>, FFT_LENGTH> > fft_in(NUM_PROBLEMS);
+	for(std::size_t p = 0; p < NUM_PROBLEMS; ++p){
+		fill_problem(p, argmin_in[p], fir_in[p], fft_in[p]);
+	}
+
+	lanes_test();
+	argmin_test(argmin_in);
+	fir_test(fir_in);
+	fft_test(fft_in);
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
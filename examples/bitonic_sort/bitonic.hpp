@@ -37,11 +37,16 @@
 #include <array>
 #include <utility>
 #include "divconq.hpp"
+#include "butterfly.hpp"
+#include "cost.hpp"
 #include "zip.hpp"
 #include "map.hpp"
 #include "arrayops.hpp"
+#include "batch.hpp"
 #include "reduce.hpp"
 
+// The compare-and-swaps select instead of branching, so that
+// bitonic_sort can be batched (batch.hpp) and traced (trace.hpp)
 template <bool min>
 struct CAS;
 
@@ -50,13 +55,16 @@ struct CAS<true>{
 	template <typename T>
 	std::pair<T, T> operator()(T const& l, T const& r) const{
 #pragma HLS INLINE
-		T lo, ro;
-		if(l <= r){
-			lo = r; ro = l;
-		} else {
-			lo = l; ro = r;
-		}
-		return std::pair<T, T>{lo,ro};
+		using hops::select;
+		auto swap = l <= r;
+		return std::pair<T, T>{select(swap, r, l), select(swap, l, r)};
+	}
+
+	template <typename T>
+	std::pair<T, T> operator()(std::pair<std::size_t, std::size_t> const& ctx,
+				std::pair<T, T> const& in) const{
+#pragma HLS INLINE
+		return (*this)(in.first, in.second);
 	}
 };
 
@@ -65,68 +73,42 @@ struct CAS<false>{
 	template <typename T>
 	std::pair<T, T> operator()(T const& l, T const& r) const{
 #pragma HLS INLINE
-		T lo, ro;
-		if(l >= r){
-			lo = r; ro = l;
-		} else {
-			lo = l; ro = r;
-		}
-		return std::pair<T, T>{lo,ro};
+		using hops::select;
+		auto swap = l >= r;
+		return std::pair<T, T>{select(swap, r, l), select(swap, l, r)};
 	}
-};
 
-CAS<true> min;
-CAS<false> max;
-
-struct Interleave{
-	template <typename T, std::size_t LEN>
-	auto operator()(std::array<T, LEN> const& L, std::array<T, LEN> const& R) const
-		-> std::array<T, 2*LEN> {
+	template <typename T>
+	std::pair<T, T> operator()(std::pair<std::size_t, std::size_t> const& ctx,
+				std::pair<T, T> const& in) const{
 #pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
-		std::array<T, 0> init; 		
-#pragma HLS ARRAY_PARTITION complete VARIABLE=init._M_instance
-		return hops::rreduce(hops::concatenate,
-				hops::zipWith(hops::construct, L, R), init);
+		return (*this)(in.first, in.second);
 	}
-} interleave;
+};
 
-struct Bitreverse{
-	template <typename T, std::size_t LEN>
-	auto operator()(std::array<T, LEN> const& IN) const
-		-> std::array<T, LEN> {
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
-		return hops::divconq(interleave, IN);
-	}
-} bitreverse;
+CAS<true> min;
+CAS<false> max;
 
 struct BitonicOperator{
-	template <typename T>
-	std::array<T, 2> operator()(std::array<T,1> const& L, std::array<T,1> const& R) const {
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
-		return hops::uncurry(hops::concatenate)(hops::unzip(hops::zipWith(min, L, R)));
-	}
-
 	template <typename T, std::size_t LEN>
 	std::array<T, 2*LEN> operator()(std::array<T,LEN> const& L, std::array<T,LEN> const& R) const {
 #pragma HLS INLINE
 #pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
-		// calls divconq on each sub-branch
-		auto p = hops::unzip(hops::zipWith(min, L, hops::reverse(R)));
-		auto swap = hops::compose(hops::uncurry(hops::concatenate), hops::compose(hops::unzip, hops::partial(hops::zipWith, min)));
-		auto l = hops::divconq(swap, bitreverse(p.first));
-		auto r = hops::divconq(swap, bitreverse(p.second));
-#pragma HLS ARRAY_PARTITION complete VARIABLE=l._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=r._M_instance
-		return hops::concatenate(bitreverse(l), bitreverse(r));
+		// Reversing R makes the concatenation bitonic, and the
+		// merge network is a decreasing-stride butterfly
+		return hops::rbutterfly(min, hops::concatenate(L, hops::reverse(R)));
 	}
 } bitonicOperator;
 
+namespace hops{
+	// Each merge is an rbutterfly of compare-and-swaps
+	template <typename T, std::size_t LEN>
+	struct FunctionCost<BitonicOperator, std::array<T, LEN>, std::array<T, LEN> >
+		: public Cost<RButterfly, CAS<true>, std::array<T, 2 * LEN> >{
+	};
+}
+
 template <typename T, std::size_t LEN>
 std::array<T, LEN> bitonic_sort(std::array<T,LEN> const& IN){
 #pragma HLS INLINE
@@ -134,77 +116,19 @@ std::array<T, LEN> bitonic_sort(std::array<T,LEN> const& IN){
 	return hops::divconq(bitonicOperator, IN);
 }
 
-namespace loop{
-	template <typename T, std::size_t LEN>
-	std::array<T, LEN> bitreverse(std::array<T, LEN> const& IN){
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
-		static const size_t LEV = hops::log2(LEN);
-		std::array<T, LEN> out;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=out._M_instance
-		for(std::size_t t = 0; t < LEN; t++){
-#pragma HLS UNROLL
-			unsigned int b = 0;
-			for(std::size_t j = 0; j < LEV; j++){
-#pragma HLS UNROLL
-				b = b << 1;
-				b |= ((t >> j) &1);
-			}
-			out[t] = IN[b];
-			out[b] = IN[t];
-		}
-		return out;
-	}
-
-	template <class FN, std::size_t LEN, typename T>
-	std::array<T, LEN> butterfly(FN const& F, std::array<T, LEN> const& IN){
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
-		static const int LEV = hops::clog2(LEN);
-		std::array<std::array<T, LEN>, LEV + 1> stagearr;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr[0]._M_instance
-	bfly_in:
-		for(int i = 0; i< LEN; ++i){
-			stagearr[0][i] = IN[i];
-		}
-		
-	bfly_level:
-		for(int l = 0; l < LEV; ++l){
-			std::size_t dftp = (1<<(l+1));
-			std::size_t stride = 1<<l;
-			std::size_t mask = stride - 1;
-		bfly_pairs:
-			for(int i = 0; i < (1<<(LEV-1)); ++i){
-				std::size_t grp = i >> l;
-				std::size_t top = i & mask;
-				std::size_t base = top + (grp<<(l+1));
-
-				std::pair<T, T> o = F(stagearr[l][base], 
-						stagearr[l][base + stride]);
-				stagearr[l+1][base]= o.first;
-				stagearr[l+1][base + stride] = o.second;
-			}
-		}
-		return stagearr[LEV];
-	}
+// The figures of bitonic_sort: a divconq of merges
+template <typename T, std::size_t LEN>
+using BitonicCost = hops::Cost<hops::Divconq, BitonicOperator, std::array<T, LEN> >;
 
+namespace loop{
 	struct BitonicStage{
-		template <typename T>
-		std::array<T, 2*1> operator()(std::array<T,1> const& L, std::array<T,1> const& R) const {
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
-			return hops::concatenate(L, R);
-		}
-
 		template <typename T, std::size_t LEN>
 		std::array<T, 2*LEN> operator()(std::array<T,LEN> const& L, std::array<T,LEN> const& R) const {
 #pragma HLS INLINE
 #pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
-			auto lsub = bitreverse(butterfly(max, bitreverse(L)));
-			auto rsub = bitreverse(butterfly(min, bitreverse(R)));
+			auto lsub = hops::loop::rbutterfly(max, L);
+			auto rsub = hops::loop::rbutterfly(min, R);
 #pragma HLS ARRAY_PARTITION complete VARIABLE=lsub._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=rsub._M_instance
 			return hops::concatenate(lsub, rsub);
@@ -215,7 +139,7 @@ namespace loop{
 	std::array<T, LEN> bitonic_sort(std::array<T,LEN> const& IN){
 #pragma HLS INLINE
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
-		return bitreverse(butterfly(min, bitreverse(hops::divconq(bitonicStage, IN))));
+		return hops::loop::rbutterfly(min, hops::divconq(bitonicStage, IN));
 	}
 }
 #endif
@@ -38,11 +38,17 @@
 #include "utility.hpp"
 
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
+#include "fixed.hpp"
 #endif
 #define LOG_LIST_LENGTH 4
 #define LIST_LENGTH (1<<LOG_LIST_LENGTH)
 
+typedef BitonicCost<int, LIST_LENGTH> bitonic_cost;
+static_assert(bitonic_cost::ops == (LIST_LENGTH / 4) * LOG_LIST_LENGTH * (LOG_LIST_LENGTH + 1),
+	"bitonic_hop_synth has (N/4)log2(N)(log2(N) + 1) comparators");
+static_assert(bitonic_cost::depth == LOG_LIST_LENGTH * (LOG_LIST_LENGTH + 1) / 2,
+	"bitonic_hop_synth has a depth of log2(N)(log2(N) + 1)/2 comparators");
+
 std::array<int, LIST_LENGTH> bitonic_hop_synth(std::array<int, LIST_LENGTH> const &IN){
 #pragma HLS PIPELINE
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
@@ -58,6 +64,9 @@ std::array<int, LIST_LENGTH> bitonic_loop_synth(std::array<int, LIST_LENGTH> con
 int main(){
 	std::array<int, LIST_LENGTH> input, output, gold;
 
+	std::cout << "bitonic_hop_synth: " << bitonic_cost::ops << " comparators, depth "
+		  << bitonic_cost::depth << ", " << bitonic_cost::storage
+		  << " intermediate elements" << std::endl;
 	fill_normal(input);
 	gold = input;
 
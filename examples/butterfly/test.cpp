@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include <utility>
+#include "butterfly.hpp"
+#include "arrayops.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LOG_LIST_LENGTH 4
+#define LIST_LENGTH (1<<LOG_LIST_LENGTH)
+
+typedef std::pair<std::size_t, std::size_t> ctx_t;
+
+// A butterfly operator that is not symmetric in its inputs and
+// depends on its context, so that the test checks the pairing,
+// ordering and (level, index) context of every stage.
+struct Mix{
+	std::pair<int, int> operator()(ctx_t const& CTX,
+				std::pair<int, int> const& IN) const{
+#pragma HLS INLINE
+		return std::pair<int, int>(IN.first + 2 * IN.second + CTX.first,
+					IN.first - IN.second + CTX.second);
+	}
+} mix;
+
+// Reference model: visits every element of every stage and applies F
+// to the elements whose stride bit is clear.
+template <std::size_t LEN>
+std::array<int, LEN> butterfly_gold(std::array<int, LEN> IN, bool decreasing){
+	std::size_t lev = 0;
+	while((std::size_t(1) << lev) < LEN){
+		++lev;
+	}
+	for(std::size_t s = 1; s <= lev; ++s){
+		std::size_t l = decreasing ? lev + 1 - s : s;
+		std::size_t stride = std::size_t(1) << (l - 1);
+		for(std::size_t i = 0; i < LEN; ++i){
+			if(i & stride){
+				continue;
+			}
+			std::pair<int, int> o = mix(ctx_t(l, i % stride),
+						std::pair<int, int>(IN[i], IN[i + stride]));
+			IN[i] = o.first;
+			IN[i + stride] = o.second;
+		}
+	}
+	return IN;
+}
+
+// -------------------- Butterfly Test --------------------
+std::array<int, LIST_LENGTH> butterfly_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return butterfly(mix, IN);
+}
+
+std::array<int, LIST_LENGTH> butterfly_loop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return loop::butterfly(mix, IN);
+}
+
+std::array<int, LIST_LENGTH> rbutterfly_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return rbutterfly(mix, IN);
+}
+
+std::array<int, LIST_LENGTH> rbutterfly_loop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return loop::rbutterfly(mix, IN);
+}
+
+template <std::size_t LEN>
+int length_test(){
+	std::array<int, LEN> input, output, gold;
+	fill_normal(input);
+
+	std::cout << "Running " << LEN << "-element butterfly tests... ";
+	gold = butterfly_gold(input, false);
+	output = butterfly(mix, input);
+	if(check(output, gold)){
+		std::cout << "Failed butterfly!" << std::endl;
+		exit(-1);
+	}
+	output = loop::butterfly(mix, input);
+	if(check(output, gold)){
+		std::cout << "Failed loop::butterfly!" << std::endl;
+		exit(-1);
+	}
+
+	gold = butterfly_gold(input, true);
+	output = rbutterfly(mix, input);
+	if(check(output, gold)){
+		std::cout << "Failed rbutterfly!" << std::endl;
+		exit(-1);
+	}
+	output = loop::rbutterfly(mix, input);
+	if(check(output, gold)){
+		std::cout << "Failed loop::rbutterfly!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+int butterfly_test(){
+	std::array<int, LIST_LENGTH> input, output, gold;
+	fill_normal(input);
+
+	gold = butterfly_gold(input, false);
+	std::cout << "Running butterfly_hop_synth test... ";
+	output = butterfly_hop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed butterfly_hop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed butterfly_hop_synth test!" << std::endl;
+
+	std::cout << "Running butterfly_loop_synth test... ";
+	output = butterfly_loop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed butterfly_loop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed butterfly_loop_synth test!" << std::endl;
+
+	gold = butterfly_gold(input, true);
+	std::cout << "Running rbutterfly_hop_synth test... ";
+	output = rbutterfly_hop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed rbutterfly_hop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed rbutterfly_hop_synth test!" << std::endl;
+
+	std::cout << "Running rbutterfly_loop_synth test... ";
+	output = rbutterfly_loop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed rbutterfly_loop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed rbutterfly_loop_synth test!" << std::endl;
+
+	length_test<1>();
+	length_test<2>();
+	length_test<4>();
+	length_test<64>();
+
+	std::cout << "Butterfly Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Butterfly Test --------------------
+
+int main(){
+	butterfly_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
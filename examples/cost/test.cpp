@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include "arrayops.hpp"
+#include "butterfly.hpp"
+#include "cost.hpp"
+#include "divconq.hpp"
+#include "map.hpp"
+#include "mapreduce.hpp"
+#include "reduce.hpp"
+#include "scan.hpp"
+#include "zip.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 16
+
+// -------------------- Sum Test --------------------
+int sum_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return treereduce(std::plus<int>(), IN);
+}
+
+// The figures are known when sum_hop_synth is compiled
+typedef Cost<Treereduce, std::plus<int>, std::array<int, LIST_LENGTH> > sum_cost;
+static_assert(sum_cost::ops == LIST_LENGTH - 1, "sum_hop_synth has LIST_LENGTH - 1 adders");
+static_assert(sum_cost::depth == 4, "sum_hop_synth has a depth of clog2(LIST_LENGTH)");
+// -------------------- End Sum Test --------------------
+
+// Every function below records each of its applications, and returns
+// Nodes holding the depth of the application, so that the figures of
+// Cost can be checked against the structure that is built.
+struct Node{
+	std::size_t depth;
+};
+
+static std::size_t applications = 0, elements = 0;
+
+Node node(std::size_t DEPTH){
+	Node n = {DEPTH};
+	return n;
+}
+
+struct Step{
+	Node operator()(Node const& A) const{
+		++applications;
+		elements += 1;
+		return node(A.depth + 1);
+	}
+} step;
+
+struct Join{
+	Node operator()(Node const& A, Node const& B) const{
+		++applications;
+		elements += 1;
+		return node((A.depth < B.depth ? B.depth : A.depth) + 1);
+	}
+} join;
+
+// A divconq function whose result grows, like concatenate
+struct Grow{
+	template <std::size_t LL, std::size_t LR>
+	std::array<Node, LL + LR> operator()(std::array<Node, LL> const& L,
+					std::array<Node, LR> const& R) const{
+		std::size_t d = 0;
+		for(Node const& n : L){
+			d = (d < n.depth) ? n.depth : d;
+		}
+		for(Node const& n : R){
+			d = (d < n.depth) ? n.depth : d;
+		}
+		++applications;
+		elements += LL + LR;
+		std::array<Node, LL + LR> res;
+		res.fill(node(d + 1));
+		return res;
+	}
+
+	// The four-argument overload for divconq4
+	template <std::size_t LEN>
+	std::array<Node, 4*LEN> operator()(std::array<Node, LEN> const& A, std::array<Node, LEN> const& B,
+					   std::array<Node, LEN> const& C, std::array<Node, LEN> const& D) const{
+		std::size_t d = 0;
+		for(std::array<Node, LEN> const& q : {A, B, C, D}){
+			for(Node const& n : q){
+				d = (d < n.depth) ? n.depth : d;
+			}
+		}
+		++applications;
+		elements += 4*LEN;
+		std::array<Node, 4*LEN> res;
+		res.fill(node(d + 1));
+		return res;
+	}
+} grow;
+
+struct Pairwise{
+	std::pair<Node, Node> operator()(std::pair<std::size_t, std::size_t> const& CTX,
+					std::pair<Node, Node> const& IN) const{
+		Node n = join(IN.first, IN.second);
+		elements += 1;
+		return std::make_pair(n, n);
+	}
+} pairwise;
+
+std::size_t depth_of(Node const& N){
+	return N.depth;
+}
+
+template <std::size_t LEN>
+std::size_t depth_of(std::array<Node, LEN> const& IN){
+	std::size_t d = 0;
+	for(Node const& n : IN){
+		d = (d < n.depth) ? n.depth : d;
+	}
+	return d;
+}
+
+// Applies a Higher-Order Function and checks its figures against C
+template <class C, class RUN>
+int cost_test(const char * name, std::size_t LEN, RUN const& R){
+	applications = 0;
+	elements = 0;
+	std::size_t depth = depth_of(R());
+	if(applications != C::ops || depth != C::depth || elements != C::storage){
+		std::cout << "Failed " << LEN << "-element " << name << " cost test! "
+			  << "Model: (" << C::ops << ", " << C::depth << ", " << C::storage
+			  << "), Built: (" << applications << ", " << depth << ", "
+			  << elements << ")" << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+
+template <std::size_t LEN>
+int length_test(){
+	typedef std::array<Node, LEN> A;
+	A in;
+	in.fill(node(0));
+	Node z = node(0);
+
+	cost_test<Cost<Map, Step, A> >("map", LEN, [&](){return map(step, in);});
+	cost_test<Cost<ZipWith, Join, A, A> >("zipWith", LEN,
+					      [&](){return zipWith(join, in, in);});
+	cost_test<Cost<Lreduce, Join, Node, A> >("lreduce", LEN,
+						 [&](){return lreduce(join, z, in);});
+	cost_test<Cost<Rreduce, Join, A, Node> >("rreduce", LEN,
+						 [&](){return rreduce(join, in, z);});
+	cost_test<Cost<Treereduce, Join, A> >("treereduce", LEN,
+					      [&](){return treereduce(join, in);});
+	cost_test<Cost<Divconq, Grow, A> >("divconq", LEN,
+					   [&](){return divconq(grow, in);});
+	cost_test<Cost<Divconq4, Grow, A> >("divconq4", LEN,
+					    [&](){return divconq4(grow, in);});
+	cost_test<Cost<Lscan<Sklansky>, Join, A> >("Sklansky lscan", LEN,
+						   [&](){return Lscan<Sklansky>()(join, in);});
+	cost_test<Cost<Rscan<KoggeStone>, Join, A> >("Kogge-Stone rscan", LEN,
+						     [&](){return Rscan<KoggeStone>()(join, in);});
+	cost_test<Cost<Lscan<BrentKung>, Join, A> >("Brent-Kung lscan", LEN,
+						    [&](){return Lscan<BrentKung>()(join, in);});
+	cost_test<Cost<Mapreduce<Chain>, Step, Join, Node, A> >("Chain mapreduce", LEN,
+				[&](){return Mapreduce<Chain>()(step, join, z, in);});
+	cost_test<Cost<Mapreduce<Tree>, Step, Join, Node, A> >("Tree mapreduce", LEN,
+				[&](){return Mapreduce<Tree>()(step, join, z, in);});
+	return 0;
+}
+
+template <std::size_t LEN>
+int butterfly_test(){
+	typedef std::array<Node, LEN> A;
+	A in;
+	in.fill(node(0));
+
+	cost_test<Cost<Butterfly, Pairwise, A> >("butterfly", LEN,
+						 [&](){return butterfly(pairwise, in);});
+	cost_test<Cost<RButterfly, Pairwise, A> >("rbutterfly", LEN,
+						  [&](){return rbutterfly(pairwise, in);});
+	return 0;
+}
+
+int main(){
+	std::cout << "Running cost model tests... ";
+	length_test<1>();
+	length_test<2>();
+	length_test<5>();
+	length_test<13>();
+	length_test<LIST_LENGTH>();
+	length_test<37>();
+	length_test<100>();
+	length_test<64>();
+	butterfly_test<2>();
+	butterfly_test<LIST_LENGTH>();
+	butterfly_test<64>();
+	std::cout << "Passed cost model tests!" << std::endl;
+
+	std::array<int, LIST_LENGTH> input;
+	std::cout << "sum_hop_synth: " << cost<Treereduce>(std::plus<int>(), input).ops
+		  << " adders, depth " << sum_cost::depth << std::endl;
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -42,7 +42,7 @@
 #include "reduce.hpp"
 
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
+#include "fixed.hpp"
 #endif
 
 using namespace hops;
@@ -115,7 +115,7 @@ float sum_test(){
 
 	std::cout << "Running sum_hop_synth test... ";
 	output = sum_hop_synth(input);
-	if(output != gold){
+	if(std::abs(output - gold) > .1){
 		std::cout << "Failed sum_hop_synth test! Output: "
 			  << output << ", Gold: " << gold << std::endl;
 		exit(-1);
@@ -219,11 +219,178 @@ int index_bitreverse_test(){
 }
 // -------------------- End Bit-Reverse --------------------
 
+// -------------------- Begin Non-Power-of-Two --------------------
+struct IntSum{
+	std::array<int, 1> operator()(std::array<int, 1> const& L,
+				std::array<int, 1> const& R) const{
+#pragma HLS INLINE
+		return {L[0] + R[0]};
+	}
+} intsum;
+
+int sum5_hop_synth(std::array<int, 5> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return divconq(intsum, IN)[0];
+}
+
+template <std::size_t LEN>
+int npot_test(){
+	std::array<int, LEN> input, output;
+	int sum, gold = 0;
+
+	fill_normal(input);
+	for(std::size_t i = 0; i < LEN; ++i){
+		gold += input[i];
+	}
+
+	std::cout << "Running " << LEN << "-element divconq sum test... ";
+	sum = divconq(intsum, input)[0];
+	if(sum != gold){
+		std::cout << "Failed " << LEN << "-element divconq sum test! "
+			  << "Output: " << sum << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running " << LEN << "-element divconq concatenate test... ";
+	output = divconq(concatenate, input);
+	if(check(output, input)){
+		std::cout << "Failed " << LEN << "-element divconq "
+			  << "concatenate test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+int npot_sum_test(){
+	std::array<int, 5> input;
+	int output, gold = 0;
+
+	fill_normal(input);
+	for(int i = 0; i < 5; ++i){
+		gold += input[i];
+	}
+
+	std::cout << "Running sum5_hop_synth test... ";
+	output = sum5_hop_synth(input);
+	if(output != gold){
+		std::cout << "Failed sum5_hop_synth test! Output: "
+			  << output << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sum5_hop_synth test!" << std::endl;
+
+	npot_test<3>();
+	npot_test<5>();
+	npot_test<100>();
+	npot_test<1000>();
+
+	std::cout << "Passed Non-Power-of-Two tests!" << std::endl;
+	return 0;
+}
+// -------------------- End Non-Power-of-Two --------------------
+
+// -------------------- Begin Divconq4 --------------------
+// divconq4 passes four quarters to F when the length is a multiple of
+// four, and two halves otherwise
+struct Join{
+	template <typename T, std::size_t LLEN, std::size_t RLEN>
+	std::array<T, LLEN + RLEN> operator()(std::array<T, LLEN> const& L,
+					      std::array<T, RLEN> const& R) const{
+#pragma HLS INLINE
+		return concatenate(L, R);
+	}
+
+	template <typename T, std::size_t LEN>
+	std::array<T, 4*LEN> operator()(std::array<T, LEN> const& A, std::array<T, LEN> const& B,
+					std::array<T, LEN> const& C, std::array<T, LEN> const& D) const{
+#pragma HLS INLINE
+		return concatenate(concatenate(A, B), concatenate(C, D));
+	}
+} join;
+
+struct IntSum4 : public IntSum{
+	using IntSum::operator();
+	std::array<int, 1> operator()(std::array<int, 1> const& A, std::array<int, 1> const& B,
+				std::array<int, 1> const& C, std::array<int, 1> const& D) const{
+#pragma HLS INLINE
+		return {(A[0] + B[0]) + (C[0] + D[0])};
+	}
+} intsum4;
+
+int sum4_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return divconq4(intsum4, IN)[0];
+}
+
+template <std::size_t LEN>
+int divconq4_test(){
+	std::array<int, LEN> input, output;
+	int sum, gold = 0;
+
+	fill_normal(input);
+	for(std::size_t i = 0; i < LEN; ++i){
+		gold += input[i];
+	}
+
+	std::cout << "Running " << LEN << "-element divconq4 sum test... ";
+	sum = divconq4(intsum4, input)[0];
+	if(sum != gold){
+		std::cout << "Failed " << LEN << "-element divconq4 sum test! "
+			  << "Output: " << sum << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running " << LEN << "-element divconq4 join test... ";
+	output = divconq4(join, input);
+	if(check(output, input)){
+		std::cout << "Failed " << LEN << "-element divconq4 join test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+int divconq4_sum_test(){
+	std::array<int, LIST_LENGTH> input;
+	int output, gold = 0;
+
+	fill_normal(input);
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		gold += input[i];
+	}
+
+	std::cout << "Running sum4_hop_synth test... ";
+	output = sum4_hop_synth(input);
+	if(output != gold){
+		std::cout << "Failed sum4_hop_synth test! Output: "
+			  << output << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sum4_hop_synth test!" << std::endl;
+
+	// Powers of four, other powers of two, and other lengths
+	divconq4_test<64>();
+	divconq4_test<2>();
+	divconq4_test<32>();
+	divconq4_test<5>();
+	divconq4_test<100>();
+	std::cout << "Passed Divconq4 tests!" << std::endl;
+	return 0;
+}
+// -------------------- End Divconq4 --------------------
+
 int main(){
 	int err;
 	min_test();
 	sum_test();
 	index_bitreverse_test();
+	npot_sum_test();
+	divconq4_sum_test();
 	std::cout << "Tests passed!" << std::endl;
 	return 0;	
 }
@@ -0,0 +1,330 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <utility>
+#include <vector>
+#include "argmin.hpp"
+#include "arrayops.hpp"
+#include "divconq.hpp"
+#include "map.hpp"
+#include "reduce.hpp"
+#include "scan.hpp"
+#include "span.hpp"
+#include "utility.hpp"
+#include "zip.hpp"
+
+using namespace hops;
+#define MAX_LENGTH 64
+
+// Counts calls to the global allocator, so that the tests can check
+// that the hops::dyn functions never allocate
+static std::size_t allocations = 0;
+void* operator new(std::size_t SZ){
+	++allocations;
+	if(void* p = std::malloc(SZ ? SZ : 1)){
+		return p;
+	}
+	throw std::bad_alloc();
+}
+void operator delete(void* P) noexcept{
+	std::free(P);
+}
+void operator delete(void* P, std::size_t) noexcept{
+	std::free(P);
+}
+
+// Horner's rule: neither associative nor commutative, so it checks
+// that lreduce and rreduce apply F in the same order as the static
+// versions
+struct LHorner{
+	unsigned operator()(unsigned const& ACC, unsigned const& X) const{
+#pragma HLS INLINE
+		return 3 * ACC + X;
+	}
+} lhorner;
+
+struct RHorner{
+	unsigned operator()(unsigned const& X, unsigned const& ACC) const{
+#pragma HLS INLINE
+		return X + 3 * ACC;
+	}
+} rhorner;
+
+// Affine functions x -> m*x + c stored as (m, c). Composition is
+// associative, but not commutative, so it checks that treereduce,
+// divconq and the scans preserve the order of the arguments to F.
+typedef std::pair<int, int> affine;
+struct Compose{
+	affine operator()(affine const& F, affine const& G) const{
+#pragma HLS INLINE
+		return affine(G.first * F.first, G.first * F.second + G.second);
+	}
+} affine_compose;
+
+struct ComposeLeaf{
+	std::array<affine, 1> operator()(std::array<affine, 1> const& L,
+					std::array<affine, 1> const& R) const{
+#pragma HLS INLINE
+		return {{affine_compose(L[0], R[0])}};
+	}
+} affine_compose_leaf;
+
+struct ToAffine{
+	affine operator()(int const& X) const{
+#pragma HLS INLINE
+		return affine(X < 0 ? -1 : 1, X);
+	}
+} to_affine;
+
+// -------------------- Horner Test --------------------
+// The loop bound is a function argument, so a single circuit
+// evaluates any length up to MAX_LENGTH
+unsigned horner_dyn_synth(std::array<unsigned, MAX_LENGTH> const& IN, std::size_t LEN){
+	return dyn::lreduce(lhorner, 0u, dyn::span(IN).subspan(0, LEN));
+}
+// -------------------- End Horner Test --------------------
+
+template <typename T, std::size_t LEN>
+std::vector<T> to_vector(std::array<T, LEN> const& IN){
+	return std::vector<T>(IN.begin(), IN.end());
+}
+
+template <typename T, std::size_t LEN>
+int check_dyn(const char * name, std::array<T, LEN> const& GOLD,
+	std::vector<T> const& OUT){
+	bool pass = OUT.size() == LEN;
+	for(std::size_t i = 0; pass && i < LEN; ++i){
+		pass = OUT[i] == GOLD[i];
+	}
+	if(!pass){
+		std::cout << "Failed " << name << "!" << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+
+template <typename T>
+int check_dyn(const char * name, T const& GOLD, T const& OUT){
+	if(!(OUT == GOLD)){
+		std::cout << "Failed " << name << "!" << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+
+// Checks every hops::dyn function against its static counterpart at
+// length LEN
+template <std::size_t LEN>
+int length_test(){
+	std::array<int, LEN> ia, ib;
+	std::array<unsigned, LEN> ua;
+	fill_normal<42>(ia);
+	fill_normal<7>(ib);
+	for(std::size_t i = 0; i < LEN; ++i){
+		ua[i] = static_cast<unsigned>(ia[i]);
+	}
+	std::array<affine, LEN> aa = map(to_affine, ia);
+
+	std::vector<int> va = to_vector(ia), vb = to_vector(ib);
+	std::vector<unsigned> vu = to_vector(ua);
+	std::vector<affine> vaff = to_vector(aa);
+	std::vector<int> vo(LEN), vo1(LEN + 1), vo2(2 * LEN);
+	std::vector<std::size_t> vs(LEN);
+	std::vector<affine> vaffo(LEN);
+	std::size_t before;
+
+	std::cout << "Running " << LEN << "-element dyn tests... ";
+	before = allocations;
+
+	// Higher-Order Functions
+	dyn::map(std::negate<int>(), vo, va);
+	check_dyn("dyn::map", map(std::negate<int>(), ia), vo);
+	dyn::zipWith(std::minus<int>(), vo, va, vb);
+	check_dyn("dyn::zipWith", zipWith(std::minus<int>(), ia, ib), vo);
+	check_dyn("dyn::lreduce", lreduce(lhorner, 1u, ua),
+		dyn::lreduce(lhorner, 1u, vu));
+	check_dyn("dyn::rreduce", rreduce(rhorner, ua, 1u),
+		dyn::rreduce(rhorner, vu, 1u));
+	check_dyn("dyn::treereduce", treereduce(affine_compose, aa),
+		dyn::treereduce(affine_compose, vaff));
+	check_dyn("dyn::divconq", divconq(affine_compose_leaf, aa),
+		dyn::divconq(affine_compose_leaf, vaff));
+	dyn::lscan(affine_compose, vaffo, vaff);
+	check_dyn("dyn::lscan", lscan(affine_compose, aa), vaffo);
+	dyn::rscan(affine_compose, vaffo, vaff);
+	check_dyn("dyn::rscan", rscan(affine_compose, aa), vaffo);
+
+	// Array Operations
+	dyn::range(vs);
+	check_dyn("dyn::range", range<LEN>(), vs);
+	dyn::replicate(vo, 5);
+	check_dyn("dyn::replicate", replicate<LEN>(5), vo);
+	dyn::reverse(vo, va);
+	check_dyn("dyn::reverse", reverse(ia), vo);
+	dyn::prepend(vo1, 5, va);
+	check_dyn("dyn::prepend", prepend(5, ia), vo1);
+	dyn::append(vo1, va, 5);
+	check_dyn("dyn::append", append(ia, 5), vo1);
+	dyn::concatenate(vo2, va, vb);
+	check_dyn("dyn::concatenate", concatenate(ia, ib), vo2);
+	check_dyn("dyn::head", head(ia), dyn::head(va));
+	check_dyn("dyn::last", last(ia), dyn::last(va));
+	dyn::rrotate(vo, va);
+	check_dyn("dyn::rrotate", rrotate(ia), vo);
+	dyn::lrotate(vo, va);
+	check_dyn("dyn::lrotate", lrotate(ia), vo);
+	dyn::rshift(vo, 5, va);
+	check_dyn("dyn::rshift", rshift(5, ia), vo);
+	dyn::lshift(vo, va, 5);
+	check_dyn("dyn::lshift", lshift(ia, 5), vo);
+
+	std::pair<dyn::Span<int>, dyn::Span<int> > halves = dyn::split(va, LEN / 2);
+	dyn::Span<int> t = dyn::tail(va);
+	if(halves.first.size() != LEN / 2 || halves.second.data() != va.data() + LEN / 2 ||
+		t.size() != LEN - 1 || t.data() != va.data() + 1){
+		std::cout << "Failed dyn::split/dyn::tail!" << std::endl;
+		exit(-1);
+	}
+
+	if(allocations != before){
+		std::cout << "Failed: hops::dyn allocated memory!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+// Chains several hops::dyn functions through temporaries taken from
+// an Arena, at lengths chosen at runtime
+int arena_test(){
+	alignas(std::max_align_t) static unsigned char buf[4 * MAX_LENGTH * sizeof(long)];
+	dyn::Arena arena(buf, sizeof(buf));
+	std::array<int, MAX_LENGTH> in;
+	fill_normal(in);
+
+	std::cout << "Running arena pipeline test... ";
+	std::size_t before = allocations;
+	for(std::size_t len = 1; len <= MAX_LENGTH; ++len){
+		arena.reset();
+		dyn::Span<int> x = dyn::span(in).subspan(0, len);
+		dyn::Span<long> sq = arena.take<long>(len);
+		dyn::Span<long> ps = arena.take<long>(len);
+		dyn::map([](int v){return static_cast<long>(v) * v;}, sq, x);
+		dyn::lscan(std::plus<long>(), ps, sq);
+
+		long gold = 0;
+		for(std::size_t i = 0; i < len; ++i){
+			gold += static_cast<long>(in[i]) * in[i];
+		}
+		if(ps[len - 1] != gold || dyn::treereduce(std::plus<long>(), sq) != gold ||
+			arena.used() > sizeof(buf)){
+			std::cout << "Failed at length " << len << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	if(allocations != before){
+		std::cout << "Failed: hops::dyn allocated memory!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+// Runs dyn::divconq with the function object of the argminmax
+// example, whose nodes (argmin_t) are not leaves
+int argmin_test(){
+	std::array<int, MAX_LENGTH> in;
+	std::vector<argmin_t<int> > t(MAX_LENGTH);
+	fill_normal(in);
+
+	std::cout << "Running dyn::divconq argmin test... ";
+	argmin_t<int> gold = divconq(argminop, map(argmin_t<int>(), in));
+	for(std::size_t len = 2; len <= MAX_LENGTH; ++len){
+		dyn::Span<argmin_t<int> > ts = dyn::span(t).subspan(0, len);
+		dyn::map(argmin_t<int>(), ts, dyn::span(in).subspan(0, len));
+		argmin_t<int> res = dyn::divconq(argminop, ts);
+		std::size_t idx = 0;
+		for(std::size_t i = 1; i < len; ++i){
+			idx = (in[i] < in[idx]) ? i : idx;
+		}
+		if(res.data != in[idx] || res.idx != idx ||
+			(len == MAX_LENGTH && (res.data != gold.data || res.idx != gold.idx))){
+			std::cout << "Failed at length " << len << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+int horner_test(){
+	std::array<unsigned, MAX_LENGTH> in;
+	std::array<int, MAX_LENGTH> tmp;
+	fill_normal(tmp);
+	for(std::size_t i = 0; i < MAX_LENGTH; ++i){
+		in[i] = static_cast<unsigned>(tmp[i]);
+	}
+
+	std::cout << "Running horner_dyn_synth test... ";
+	for(std::size_t len = 0; len <= MAX_LENGTH; ++len){
+		unsigned gold = 0;
+		for(std::size_t i = 0; i < len; ++i){
+			gold = 3 * gold + in[i];
+		}
+		if(horner_dyn_synth(in, len) != gold){
+			std::cout << "Failed horner_dyn_synth test at length "
+				  << len << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed horner_dyn_synth test!" << std::endl;
+	return 0;
+}
+
+int main(){
+	length_test<1>();
+	length_test<2>();
+	length_test<5>();
+	length_test<16>();
+	length_test<37>();
+	arena_test();
+	argmin_test();
+	horner_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
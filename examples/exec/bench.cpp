@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include "exec.hpp"
+#include "divconq.hpp"
+#include "map.hpp"
+#include "utility.hpp"
+
+// LIST_LENGTH is set by the bench rule in include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 4096
+#endif
+#define BENCH_ELEMENTS (1<<24)
+#define BENCH_ITERATIONS (BENCH_ELEMENTS/LIST_LENGTH)
+#define BENCH_GRAIN 1024
+
+// Merges two sorted arrays, so that divconq computes a merge sort
+struct Merge{
+	template <typename T, std::size_t LLEN, std::size_t RLEN>
+	std::array<T, LLEN + RLEN> operator()(std::array<T, LLEN> const& L,
+					      std::array<T, RLEN> const& R) const{
+		std::array<T, LLEN + RLEN> res;
+		std::merge(L.begin(), L.end(), R.begin(), R.end(), res.begin());
+		return res;
+	}
+};
+
+// A few rounds of an integer hash, so that each element of map costs
+// more than a load and a store
+struct Hash{
+	int operator()(int X) const{
+		unsigned h = X;
+		for(int i = 0; i < 16; ++i){
+			h = (h * 2654435761u + 0x9e3779b9u) ^ (h >> 13);
+		}
+		return (int)h;
+	}
+};
+
+int divconq_bench(){
+	static std::array<int, LIST_LENGTH> input, output, gold;
+	double serial_ns, par_ns;
+
+	fill_normal(input);
+	gold = input;
+	std::sort(gold.begin(), gold.end());
+
+	serial_ns = bench_ns([](){
+			output = hops::divconq(Merge(), input);
+		}, BENCH_ITERATIONS);
+	if(check(output, gold)){
+		std::cerr << "Failed divconq benchmark! hops::divconq did not sort" << std::endl;
+		return -1;
+	}
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH
+		  << " hops::divconq: " << serial_ns << " ns/call" << std::endl;
+
+	// The pool of each policy is started before it is measured
+	for(std::size_t threads = 1; threads <= 64; threads *= 2){
+		hops::exec::Parallel par(threads, BENCH_GRAIN);
+		output = hops::divconq(par, Merge(), input);
+		par_ns = bench_ns([&par](){
+				output = hops::divconq(par, Merge(), input);
+			}, BENCH_ITERATIONS);
+		if(check(output, gold)){
+			std::cerr << "Failed divconq benchmark! exec::Parallel("
+				  << threads << ") did not sort" << std::endl;
+			return -1;
+		}
+		std::cout << "LIST_LENGTH=" << LIST_LENGTH
+			  << " exec::Parallel(" << threads << ", " << BENCH_GRAIN << "): "
+			  << par_ns << " ns/call, speedup: " << serial_ns / par_ns
+			  << std::endl;
+	}
+	return 0;
+}
+
+int map_bench(){
+	static std::array<int, LIST_LENGTH> input, output, gold;
+	double serial_ns, par_ns;
+
+	fill_normal(input);
+	gold = hops::map(hops::exec::loop, Hash(), input);
+	serial_ns = bench_ns([](){
+			gold = hops::map(hops::exec::loop, Hash(), input);
+		}, BENCH_ITERATIONS);
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH
+		  << " map exec::loop: " << serial_ns << " ns/call" << std::endl;
+
+	// Every call to apply runs on the pool of the policy, so
+	// the time per call does not include starting threads
+	for(std::size_t threads = 1; threads <= 64; threads *= 2){
+		hops::exec::Parallel par(threads, BENCH_GRAIN);
+		output = hops::map(par, Hash(), input);
+		par_ns = bench_ns([&par](){
+				output = hops::map(par, Hash(), input);
+			}, BENCH_ITERATIONS);
+		if(check(output, gold)){
+			std::cerr << "Failed map benchmark! exec::Parallel("
+				  << threads << ") did not match exec::loop" << std::endl;
+			return -1;
+		}
+		std::cout << "LIST_LENGTH=" << LIST_LENGTH
+			  << " map exec::Parallel(" << threads << ", " << BENCH_GRAIN << "): "
+			  << par_ns << " ns/call, speedup: " << serial_ns / par_ns
+			  << std::endl;
+	}
+	return 0;
+}
+
+int main(){
+	if(divconq_bench() || map_bench()){
+		return -1;
+	}
+	return 0;
+}
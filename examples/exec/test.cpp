@@ -0,0 +1,367 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <functional>
+#include <tuple>
+#include "exec.hpp"
+#include "arrayops.hpp"
+#include "divconq.hpp"
+#include "map.hpp"
+#include "mapreduce.hpp"
+#include "zip.hpp"
+#include "reduce.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 16
+#define ODD_LIST_LENGTH 13
+#define LARGE_LIST_LENGTH 4096
+#define LARGE_ODD_LIST_LENGTH 3001
+
+struct Square{
+	int operator()(int const& X) const{
+#pragma HLS INLINE
+		return X * X;
+	}
+};
+
+struct Mac{
+	int operator()(int const& A, int const& B, int const& C) const{
+#pragma HLS INLINE
+		return A * B + C;
+	}
+};
+
+// Not associative, so any reordering of lreduce or rreduce is detected
+struct HornerLeft{
+	int operator()(int const& ACC, int const& X) const{
+#pragma HLS INLINE
+		return ACC * 3 + X;
+	}
+};
+
+struct HornerRight{
+	int operator()(int const& X, int const& ACC) const{
+#pragma HLS INLINE
+		return ACC * 3 + X;
+	}
+};
+
+// Swaps the two halves at every level, so divconq returns a
+// permutation that depends on the shape of the tree
+struct Swap{
+	template <std::size_t LLEN, std::size_t RLEN>
+	std::array<int, LLEN + RLEN> operator()(std::array<int, LLEN> const& L,
+						std::array<int, RLEN> const& R) const{
+#pragma HLS INLINE
+		return concatenate(R, L);
+	}
+};
+
+// -------------------- Kernel Test --------------------
+// The same kernel source, compiled with different policies
+template <class P>
+int sumsq_kernel(P const& POLICY, std::array<int, LIST_LENGTH> const& A,
+		std::array<int, LIST_LENGTH> const& B){
+#pragma HLS INLINE
+	auto squares = map(POLICY, Square(), A);
+	auto macs = zipWith(POLICY, Mac(), squares, B, A);
+	return treereduce(POLICY, std::plus<int>(), macs);
+}
+
+int sumsq_unrolled_synth(std::array<int, LIST_LENGTH> const& A,
+			std::array<int, LIST_LENGTH> const& B){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+	return sumsq_kernel(exec::unrolled, A, B);
+}
+
+int sumsq_loop_synth(std::array<int, LIST_LENGTH> const& A,
+		std::array<int, LIST_LENGTH> const& B){
+	return sumsq_kernel(exec::loop, A, B);
+}
+
+int kernel_test(){
+	std::array<int, LIST_LENGTH> a, b;
+	int output, gold = 0;
+	fill_normal(a);
+	fill_normal<7>(b);
+
+	for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+		gold += a[i] * a[i] * b[i] + a[i];
+	}
+
+	std::cout << "Running sumsq_unrolled_synth test... ";
+	output = sumsq_unrolled_synth(a, b);
+	if(output != gold){
+		std::cerr << "Failed sumsq_unrolled_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sumsq_unrolled_synth test!" << std::endl;
+
+	std::cout << "Running sumsq_loop_synth test... ";
+	output = sumsq_loop_synth(a, b);
+	if(output != gold){
+		std::cerr << "Failed sumsq_loop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sumsq_loop_synth test!" << std::endl;
+
+	std::cout << "Running sumsq_kernel simd test... ";
+	output = sumsq_kernel(exec::simd, a, b);
+	if(output != gold){
+		std::cerr << "Failed sumsq_kernel simd test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sumsq_kernel simd test!" << std::endl;
+
+	std::cout << "Running sumsq_kernel parallel test... ";
+	output = sumsq_kernel(exec::Parallel(4, 1), a, b);
+	if(output != gold){
+		std::cerr << "Failed sumsq_kernel parallel test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sumsq_kernel parallel test!" << std::endl;
+
+	std::cout << "Kernel Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Kernel Test --------------------
+
+// -------------------- Policy Test --------------------
+// Compares every function called with POLICY against the same
+// function called without a policy
+template <class P>
+int policy_test(P const& POLICY, char const* NAME){
+	std::array<int, LIST_LENGTH> a, b, c, output, gold;
+	std::array<int, ODD_LIST_LENGTH> odd, oddout, oddgold;
+	fill_normal(a);
+	fill_normal<7>(b);
+	fill_normal<9>(c);
+	fill_normal<11>(odd);
+
+	std::cout << "Running " << NAME << " policy tests... ";
+
+	gold = map(Square(), a);
+	output = map(POLICY, Square(), a);
+	if(check(output, gold)){
+		std::cerr << "Failed " << NAME << " map test!" << std::endl;
+		exit(-1);
+	}
+
+	gold = zipWith(Mac(), a, b, c);
+	output = zipWith(POLICY, Mac(), a, b, c);
+	if(check(output, gold)){
+		std::cerr << "Failed " << NAME << " zipWith test!" << std::endl;
+		exit(-1);
+	}
+
+	std::array<std::pair<int, int>, LIST_LENGTH> pgold = zip(a, b), pout;
+	pout = zip(POLICY, a, b);
+	auto upout = unzip(POLICY, pgold);
+	if(check(pout, pgold) || check(upout.first, a) || check(upout.second, b)){
+		std::cerr << "Failed " << NAME << " zip/unzip test!" << std::endl;
+		exit(-1);
+	}
+
+	std::array<std::tuple<int, int, int>, LIST_LENGTH> tgold = zip(a, b, c), tout;
+	tout = zip(POLICY, a, b, c);
+	auto utout = unzip(POLICY, tgold);
+	if(check(tout, tgold) || check(std::get<0>(utout), a) ||
+		check(std::get<1>(utout), b) || check(std::get<2>(utout), c)){
+		std::cerr << "Failed " << NAME << " tuple zip/unzip test!" << std::endl;
+		exit(-1);
+	}
+
+	if(lreduce(POLICY, HornerLeft(), 1, a) != lreduce(HornerLeft(), 1, a) ||
+		rreduce(POLICY, HornerRight(), a, 1) != rreduce(HornerRight(), a, 1)){
+		std::cerr << "Failed " << NAME << " lreduce/rreduce test!" << std::endl;
+		exit(-1);
+	}
+
+	if(treereduce(POLICY, std::plus<int>(), a) != treereduce(std::plus<int>(), a) ||
+		treereduce(POLICY, std::plus<int>(), odd) != treereduce(std::plus<int>(), odd)){
+		std::cerr << "Failed " << NAME << " treereduce test!" << std::endl;
+		exit(-1);
+	}
+
+	if(mapreduce(POLICY, Mac(), HornerLeft(), 1, a, b, c) !=
+		mapreduce(Mac(), HornerLeft(), 1, a, b, c) ||
+		Mapreduce<Tree>()(POLICY, std::multiplies<int>(), std::plus<int>(), 1, a, b) !=
+		Mapreduce<Tree>()(std::multiplies<int>(), std::plus<int>(), 1, a, b)){
+		std::cerr << "Failed " << NAME << " mapreduce test!" << std::endl;
+		exit(-1);
+	}
+
+	gold = divconq(Swap(), a);
+	output = divconq(POLICY, Swap(), a);
+	oddgold = divconq(Swap(), odd);
+	oddout = divconq(POLICY, Swap(), odd);
+	if(check(output, gold) || check(oddout, oddgold)){
+		std::cerr << "Failed " << NAME << " divconq test!" << std::endl;
+		exit(-1);
+	}
+
+	std::array<int, LIST_LENGTH + 1> lgold, lout;
+	std::array<int, 2 * LIST_LENGTH> cgold, cout;
+	std::array<int, LIST_LENGTH - 1> tlgold, tlout;
+	lgold = prepend(3, a);
+	lout = prepend(POLICY, 3, a);
+	if(check(lout, lgold)){
+		std::cerr << "Failed " << NAME << " prepend test!" << std::endl;
+		exit(-1);
+	}
+	lgold = append(a, 3);
+	lout = append(POLICY, a, 3);
+	if(check(lout, lgold)){
+		std::cerr << "Failed " << NAME << " append test!" << std::endl;
+		exit(-1);
+	}
+	cgold = concatenate(a, b);
+	cout = concatenate(POLICY, a, b);
+	tlgold = tail(a);
+	tlout = tail(POLICY, a);
+	if(check(cout, cgold) || check(tlout, tlgold)){
+		std::cerr << "Failed " << NAME << " concatenate/tail test!" << std::endl;
+		exit(-1);
+	}
+	std::array<std::array<int, LIST_LENGTH>, 5> pergold = {{
+			reverse(a), rrotate(a), lrotate(a), rshift(3, a), lshift(a, 3)}};
+	std::array<std::array<int, LIST_LENGTH>, 5> perout = {{
+			reverse(POLICY, a), rrotate(POLICY, a), lrotate(POLICY, a),
+			rshift(POLICY, 3, a), lshift(POLICY, a, 3)}};
+	for(std::size_t i = 0; i < pergold.size(); ++i){
+		if(check(perout[i], pergold[i])){
+			std::cerr << "Failed " << NAME << " permutation test!" << std::endl;
+			exit(-1);
+		}
+	}
+
+	std::cout << "Passed " << NAME << " policy tests!" << std::endl;
+	return 0;
+}
+
+int large_test(){
+	static std::array<int, LARGE_LIST_LENGTH> input, output, gold;
+	exec::Parallel par(4, 64);
+	fill_normal(input);
+
+	std::cout << "Running large parallel test... ";
+	gold = map(Square(), input);
+	output = map(par, Square(), input);
+	if(check(output, gold)){
+		std::cerr << "Failed large parallel map test!" << std::endl;
+		exit(-1);
+	}
+
+	if(treereduce(par, std::plus<int>(), input) != treereduce(std::plus<int>(), input)){
+		std::cerr << "Failed large parallel treereduce test!" << std::endl;
+		exit(-1);
+	}
+
+	gold = divconq(Swap(), input);
+	output = divconq(par, Swap(), input);
+	if(check(output, gold)){
+		std::cerr << "Failed large parallel divconq test!" << std::endl;
+		exit(-1);
+	}
+
+	// Forks every level down to the grain, with more tasks than
+	// threads, and reuses each pool for several calls
+	static std::array<int, LARGE_ODD_LIST_LENGTH> odd, oddout, oddgold;
+	fill_normal<11>(odd);
+	oddgold = divconq(Swap(), odd);
+	for(std::size_t threads : {1, 2, 3, 8, 64}){
+		exec::Parallel forks(threads, 16);
+		for(int i = 0; i < 4; ++i){
+			output = divconq(forks, Swap(), input);
+			oddout = divconq(forks, Swap(), odd);
+			if(check(output, gold) || check(oddout, oddgold)){
+				std::cerr << "Failed large parallel divconq test with "
+					  << threads << " threads!" << std::endl;
+				exit(-1);
+			}
+		}
+	}
+	std::cout << "Passed large parallel test!" << std::endl;
+	return 0;
+}
+
+// Floating-point addition is not associative, so the loop and
+// parallel policies only match the unrolled policy bit-for-bit when
+// they add the same pairs of elements
+template <std::size_t LEN>
+int float_tree_test(){
+	static std::array<float, LEN> input;
+	for(std::size_t i = 0; i < LEN; ++i){
+		// Magnitudes from 1e-3 to 1e5, so each sum rounds
+		input[i] = ((i % 3) ? 1.f : -1.f) * (1e-3f + (i * 7919 % 97) * (i * 104729 % 1031));
+	}
+	float gold = treereduce(exec::unrolled, std::plus<float>(), input);
+	float loop = treereduce(exec::loop, std::plus<float>(), input);
+	float par = treereduce(exec::Parallel(4, 1), std::plus<float>(), input);
+	if(loop != gold || par != gold){
+		std::cerr << "Failed " << LEN << "-element float treereduce test! Unrolled: "
+			  << std::setprecision(9) << gold << ", Loop: " << loop << ", Parallel: " << par << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+
+int float_test(){
+	std::cout << "Running float treereduce policy tests... ";
+	float_tree_test<1>();
+	float_tree_test<2>();
+	float_tree_test<3>();
+	float_tree_test<ODD_LIST_LENGTH>();
+	float_tree_test<100>();
+	float_tree_test<LARGE_ODD_LIST_LENGTH>();
+	std::cout << "Passed float treereduce policy tests!" << std::endl;
+	return 0;
+}
+// -------------------- End Policy Test --------------------
+
+int main(){
+	kernel_test();
+	policy_test(exec::unrolled, "unrolled");
+	policy_test(exec::loop, "loop");
+	policy_test(exec::simd, "simd");
+	policy_test(exec::Parallel(4, 1), "parallel");
+	large_test();
+	float_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include "fft.hpp"
+#include "utility.hpp"
+
+// LIST_LENGTH (the number of FFT points) is set by the bench rule in
+// include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 64
+#endif
+#define BENCH_POINTS (1<<22)
+#define BENCH_ITERATIONS (BENCH_POINTS/LIST_LENGTH)
+
+// The butterfly of FFTOP, with the twiddle factors computed by cos
+// and sin on every call instead of read from a table
+struct CosSinFFTOP{
+	template <typename T> 
+	data_t<T> operator()(ctx_t const& CTX, data_t<T> const& DATA) const {
+		std::size_t LEV = CTX.first;
+		std::size_t IDX = CTX.second;
+		FFT_t<T> ti = DATA.first, bi = DATA.second, to, bo;
+		T c = cos((-2*M_PI*IDX)/(1<<(LEV)));
+		T s = sin((-2*M_PI*IDX)/(1<<(LEV)));
+		T temp_r = c*std::real(bi) + s*std::imag(bi);
+		T temp_i = c*std::imag(bi) - s*std::real(bi);
+		to.real(ti.real() + temp_r);
+		to.imag(ti.imag() + temp_i);
+		bo.real(ti.real() - temp_r);
+		bo.imag(ti.imag() - temp_i);
+		data_t<T> out = {to, bo};
+		return out;
+	}
+};
+
+int main(){
+	static std::array<std::complex<float>, LIST_LENGTH> in, rom, cossin, loop_rom, loop_cossin, r4, sr;
+	std::array<int, LIST_LENGTH> re, im;
+	double rom_ns, cossin_ns, loop_rom_ns, loop_cossin_ns, r4_ns, sr_ns;
+
+	fill_normal<3>(re);
+	fill_normal<7>(im);
+	for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+		in[i] = std::complex<float>(re[i], im[i]);
+	}
+
+	// Each iteration consumes the result of the previous
+	// iteration. Multiplying by zero keeps the input unchanged, but
+	// is not folded away for floating-point types.
+	rom_ns = bench_ns([&](){
+			rom = fft(in);
+			in[0] += rom[0] * 0.f;
+		}, BENCH_ITERATIONS);
+	cossin_ns = bench_ns([&](){
+			cossin = hops::butterfly(CosSinFFTOP(), bitreverse(in));
+			in[0] += cossin[0] * 0.f;
+		}, BENCH_ITERATIONS);
+
+	// The loop butterfly computes the twiddle index at run time, so
+	// the compiler cannot fold cos and sin into constants
+	loop_rom_ns = bench_ns([&](){
+			loop_rom = loop::fft(in);
+			in[0] += loop_rom[0] * 0.f;
+		}, BENCH_ITERATIONS);
+	loop_cossin_ns = bench_ns([&](){
+			loop_cossin = hops::loop::butterfly(CosSinFFTOP(), loop::bitreverse(in));
+			in[0] += loop_cossin[0] * 0.f;
+		}, BENCH_ITERATIONS);
+
+	// Radix-4 and split-radix FFTs, with twiddle factors from the ROM
+	r4_ns = bench_ns([&](){
+			r4 = fft4(in);
+			in[0] += r4[0] * 0.f;
+		}, BENCH_ITERATIONS);
+	sr_ns = bench_ns([&](){
+			sr = srfft(in);
+			in[0] += sr[0] * 0.f;
+		}, BENCH_ITERATIONS);
+
+	for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+		if(std::abs(r4[i] - rom[i]) > .01f * LIST_LENGTH ||
+		   std::abs(sr[i] - rom[i]) > .01f * LIST_LENGTH){
+			std::cerr << "Failed fft benchmark! Radix-4 or split-radix "
+				  << "and radix-2 results differ" << std::endl;
+			return -1;
+		}
+		if(std::abs(rom[i] - cossin[i]) > .01f * LIST_LENGTH ||
+		   std::abs(loop_rom[i] - loop_cossin[i]) > .01f * LIST_LENGTH){
+			std::cerr << "Failed fft benchmark! Twiddle factors from the "
+				  << "ROM and from cos and sin differ" << std::endl;
+			return -1;
+		}
+	}
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH << " fft: ROM twiddles: "
+		  << rom_ns << " ns/FFT, cos and sin: " << cossin_ns
+		  << " ns/FFT, speedup " << cossin_ns / rom_ns << "x" << std::endl;
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH << " loop::fft: ROM twiddles: "
+		  << loop_rom_ns << " ns/FFT, cos and sin: " << loop_cossin_ns
+		  << " ns/FFT, speedup " << loop_cossin_ns / loop_rom_ns << "x" << std::endl;
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH << " radix-2 fft: " << rom_ns
+		  << " ns/FFT, radix-2 loop::fft: " << loop_rom_ns
+		  << " ns/FFT, radix-4 fft4: " << r4_ns
+		  << " ns/FFT, split-radix srfft: " << sr_ns << " ns/FFT" << std::endl;
+	return 0;
+}
@@ -36,10 +36,15 @@
 #define __FFT_HPP
 #include <complex>
 #include <cmath>
+#include <tuple>
+#include <type_traits>
 #include "zip.hpp"
 #include "arrayops.hpp"
 #include "divconq.hpp"
+#include "butterfly.hpp"
+#include "cost.hpp"
 #include "reduce.hpp"
+#include "rom.hpp"
 
 template <typename T>
 using FFT_t = std::complex<T>;
@@ -49,32 +54,71 @@ typedef std::pair<std::size_t, std::size_t> ctx_t;
 template <typename T>
 using data_t = std::pair<FFT_t<T>, FFT_t<T>>;
 
+// The cosines of the first quarter-wave of an N-point FFT:
+// cos(2*pi*IDX/N) for IDX < N/4
+template <typename T, std::size_t N>
+struct Twiddle{
+	constexpr T operator()(std::size_t IDX) const{
+		return hops::cosine(2 * M_PI * IDX / N);
+	}
+};
+
+// The type of the table of twiddle factors for an FFT of type T
+template <typename T>
+using twiddle_t = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+
+// Multiplies X by exp(2*pi*j*K/N), the twiddle factor of index K
+// (K < N) of an N-point FFT. The cosine and sine are read from a
+// table of N/4 cosines: sin(x) = cos(pi/2 - x), and each quarter-wave
+// is the first quarter-wave rotated by pi/2. (K must be 0 for N < 4.)
+//
+// The radix-2 FFT (twiddle, FFTOP, NPtFFT and fft) is templated on
+// the complex type C, and uses only its real() and imag() members, so
+// that it can be run on hops::LaneComplex by hops::batch.
+//
+// The helper functions below are declared inline: at -O2, g++ only
+// inlines the smallest functions that are not, and a call per
+// butterfly costs more than the twiddle factor.
+template <std::size_t N, typename C>
+inline C twiddle(C const& X, std::size_t K){
+#pragma HLS INLINE
+	typedef typename C::value_type T;
+	typedef twiddle_t<T> R;
+	static const std::size_t Q = (N/4 > 0) ? N/4 : 1;
+	std::size_t q = K / Q, j = K % Q;
+	R cj = hops::rom<Twiddle<R, N>, Q>(j);
+	R sj = (j == 0) ? R(0) : hops::rom<Twiddle<R, N>, Q>(Q - j);
+	T c = (q == 0) ? cj : (q == 1) ? -sj : (q == 2) ? -cj : sj;
+	T s = (q == 0) ? sj : (q == 1) ? cj : (q == 2) ? -sj : -cj;
+	return C(c*X.real() - s*X.imag(), c*X.imag() + s*X.real());
+}
+
+// FFTOP is the butterfly of an N-point FFT. The butterfly at index IDX
+// of level LEV multiplies its bottom input by the twiddle factor of
+// index IDX*N/2^LEV
+template <std::size_t N>
 struct FFTOP{
-	template <typename T> 
-	data_t<T> operator()(ctx_t const& CTX, data_t<T> const& DATA) const {
+	template <typename C>
+	std::pair<C, C> operator()(ctx_t const& CTX, std::pair<C, C> const& DATA) const {
 #pragma HLS INLINE
 		std::size_t LEV = CTX.first;
 		std::size_t IDX = CTX.second;
-		FFT_t<T> ti = DATA.first, bi = DATA.second, to, bo;
-		T angle = (-2*M_PI*IDX)/(1<<(LEV));
-		T c = cos((-2*M_PI*IDX)/(1<<(LEV)));
-		T s = sin((-2*M_PI*IDX)/(1<<(LEV)));
-		T temp_r = c*std::real(bi) + s*std::imag(bi);
-		T temp_i = c*std::imag(bi) - s*std::real(bi);
-		to.real(ti.real() + temp_r);
-		to.imag(ti.imag() + temp_i);
-		bo.real(ti.real() - temp_r);
-		bo.imag(ti.imag() - temp_i);
-		data_t<T> out = {to, bo};
+		C ti = DATA.first, to, bo;
+		C temp = twiddle<N>(DATA.second, IDX * (N >> LEV));
+		to.real(ti.real() + temp.real());
+		to.imag(ti.imag() + temp.imag());
+		bo.real(ti.real() - temp.real());
+		bo.imag(ti.imag() - temp.imag());
+		std::pair<C, C> out(to, bo);
 		return out;
 	}
-} fftop;
+};
 
 struct NPtFFT{
-	template <typename T, std::size_t LEN>
-	auto operator()(std::array<FFT_t<T>, LEN> const& L,
-			std::array<FFT_t<T>, LEN> const& R) const
-		-> std::array<FFT_t<T>, 2*LEN> {
+	template <typename C, std::size_t LEN>
+	auto operator()(std::array<C, LEN> const& L,
+			std::array<C, LEN> const& R) const
+		-> std::array<C, 2*LEN> {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
 #pragma HLS INLINE
@@ -82,7 +126,7 @@ struct NPtFFT{
 		auto indicies = hops::range<LEN>();
 		auto contexts = hops::zip(depth, indicies);
 		auto inputs = hops::zip(L, R);
-		auto outputs = hops::unzip(hops::zipWith(fftop, contexts, inputs));
+		auto outputs = hops::unzip(hops::zipWith(FFTOP<2*LEN>(), contexts, inputs));
 		return hops::concatenate(outputs.first, outputs.second);
 	}
 } nPtFFT;
@@ -97,6 +141,16 @@ struct Interleave{
 		return hops::rreduce(hops::concatenate,
 				hops::zipWith(hops::construct, L, R), init);
 	}
+
+	// Interleaves four arrays, for divconq4: {A[0], B[0], C[0],
+	// D[0], A[1], ...}
+	template <typename T, std::size_t LEN>
+	auto operator()(std::array<T, LEN> const& A, std::array<T, LEN> const& B,
+			std::array<T, LEN> const& C, std::array<T, LEN> const& D) const
+		-> std::array<T, 4*LEN> {
+#pragma HLS INLINE
+		return (*this)((*this)(A, C), (*this)(B, D));
+	}
 } interleave;
 
 struct Bitreverse{
@@ -108,14 +162,258 @@ struct Bitreverse{
 	}
 } bitreverse;
 
+// Digitreverse is the input permutation of the radix-4 FFT: the
+// inverse of divconq4(interleave, IN). For powers of four it reverses
+// the base-4 digits of each index, and it is its own inverse. For the
+// other powers of two the radix-2 level of divconq4 is the last
+// level, so the permutation divides the array in two first.
+struct Digitreverse{
+	template <typename T, std::size_t LEN>
+	auto operator()(std::array<T, LEN> const& IN) const
+		-> std::array<T, LEN> {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+		static_assert((LEN & (LEN - 1)) == 0, "digitreverse requires a power-of-two length");
+		return reverse(IN, std::integral_constant<bool, hops::log2(LEN) % 2 == 0>());
+	}
+
+private:
+	template <typename T, std::size_t LEN>
+	static std::array<T, LEN> reverse(std::array<T, LEN> const& IN, std::true_type){
+#pragma HLS INLINE
+		return hops::divconq4(interleave, IN);
+	}
+
+	template <typename T, std::size_t LEN>
+	static std::array<T, LEN> reverse(std::array<T, LEN> const& IN, std::false_type){
+#pragma HLS INLINE
+		auto h = hops::split<LEN/2>(IN);
+		return interleave(hops::divconq4(interleave, h.first),
+				hops::divconq4(interleave, h.second));
+	}
+} digitreverse;
+
+template <typename T>
+using quartet_t = std::tuple<FFT_t<T>, FFT_t<T>, FFT_t<T>, FFT_t<T> >;
+
+// The outputs of a radix-4 or split-radix butterfly: P0 + (A + B),
+// P1 + j(A - B), P0 - (A + B) and P1 - j(A - B)
+template <typename T>
+inline quartet_t<T> combine4(FFT_t<T> const& P0, FFT_t<T> const& P1,
+		FFT_t<T> const& A, FFT_t<T> const& B){
+#pragma HLS INLINE
+	T sr = A.real() + B.real(), si = A.imag() + B.imag();
+	T dr = A.real() - B.real(), di = A.imag() - B.imag();
+	return quartet_t<T>(FFT_t<T>(P0.real() + sr, P0.imag() + si),
+			FFT_t<T>(P1.real() - di, P1.imag() + dr),
+			FFT_t<T>(P0.real() - sr, P0.imag() - si),
+			FFT_t<T>(P1.real() + di, P1.imag() - dr));
+}
+
+// Concatenates the four arrays of outputs of a level of radix-4 or
+// split-radix butterflies: X[0 ... N/4), X[N/4 ... N/2), ...
+template <typename T, std::size_t LEN>
+inline std::array<FFT_t<T>, 4*LEN> concatenate4(std::tuple<std::array<FFT_t<T>, LEN>, std::array<FFT_t<T>, LEN>,
+					 std::array<FFT_t<T>, LEN>, std::array<FFT_t<T>, LEN> > const& IN){
+#pragma HLS INLINE
+	return hops::concatenate(hops::concatenate(std::get<0>(IN), std::get<1>(IN)),
+				hops::concatenate(std::get<2>(IN), std::get<3>(IN)));
+}
+
+// Radix4OP is the radix-4 butterfly of index K of an N-point FFT. Its
+// inputs are the K-th outputs of the N/4-point FFTs of x[4n], x[4n+1],
+// x[4n+2] and x[4n+3], and its outputs are X[K], X[K+N/4], X[K+N/2]
+// and X[K+3N/4]. It multiplies by three twiddle factors, where two
+// radix-2 levels multiply by four.
+template <std::size_t N>
+struct Radix4OP{
+	template <typename T>
+	quartet_t<T> operator()(std::size_t K, FFT_t<T> const& A, FFT_t<T> const& B,
+			FFT_t<T> const& C, FFT_t<T> const& D) const {
+#pragma HLS INLINE
+		FFT_t<T> a2 = twiddle<N>(C, 2*K);
+		return combine4(FFT_t<T>(A.real() + a2.real(), A.imag() + a2.imag()),
+				FFT_t<T>(A.real() - a2.real(), A.imag() - a2.imag()),
+				twiddle<N>(B, K), twiddle<N>(D, 3*K));
+	}
+};
+
+// The function passed to divconq4 by fft4: a level of radix-4
+// butterflies for four quarters, or a level of radix-2 butterflies
+// (NPtFFT) for two halves
+struct Radix4{
+	template <typename T, std::size_t LEN>
+	auto operator()(std::array<FFT_t<T>, LEN> const& L,
+			std::array<FFT_t<T>, LEN> const& R) const
+		-> std::array<FFT_t<T>, 2*LEN> {
+#pragma HLS INLINE
+		return nPtFFT(L, R);
+	}
+
+	template <typename T, std::size_t LEN>
+	auto operator()(std::array<FFT_t<T>, LEN> const& A, std::array<FFT_t<T>, LEN> const& B,
+			std::array<FFT_t<T>, LEN> const& C, std::array<FFT_t<T>, LEN> const& D) const
+		-> std::array<FFT_t<T>, 4*LEN> {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
+#pragma HLS INLINE
+		return concatenate4(hops::unzip(hops::zipWith(Radix4OP<4*LEN>(), hops::range<LEN>(),
+							      A, B, C, D)));
+	}
+} radix4;
+
+// SplitOP is the L-shaped butterfly of index K of an N-point
+// split-radix FFT. Its inputs are the K-th and (K+N/4)-th outputs of
+// the N/2-point FFT of x[2n], and the K-th outputs of the N/4-point
+// FFTs of x[4n+1] and x[4n+3]. Its outputs are X[K], X[K+N/4],
+// X[K+N/2] and X[K+3N/4], and it multiplies by two twiddle factors.
+template <std::size_t N>
+struct SplitOP{
+	template <typename T>
+	quartet_t<T> operator()(std::size_t K, FFT_t<T> const& U0, FFT_t<T> const& U1,
+			FFT_t<T> const& Z1, FFT_t<T> const& Z3) const {
+#pragma HLS INLINE
+		return combine4(U0, U1, twiddle<N>(Z1, K), twiddle<N>(Z3, 3*K));
+	}
+};
+
+// SplitRadix is the split-radix FFT of a bit-reversed array: the
+// first half is the bit-reversed x[2n], and the quarters of the
+// second half are the bit-reversed x[4n+1] and x[4n+3]. The split
+// is irregular (N/2, N/4 and N/4 points), so the recursion is
+// written out instead of passed to divconq.
+template <std::size_t LEN>
+struct SplitRadix{
+	template <typename T>
+	std::array<FFT_t<T>, LEN> operator()(std::array<FFT_t<T>, LEN> const& IN) const {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+		static_assert((LEN & (LEN - 1)) == 0, "SplitRadix requires a power-of-two length");
+		auto h = hops::split<LEN/2>(IN);
+		auto q = hops::split<LEN/4>(h.second);
+		auto u = hops::split<LEN/4>(SplitRadix<LEN/2>()(h.first));
+		return concatenate4(hops::unzip(hops::zipWith(SplitOP<LEN>(), hops::range<LEN/4>(),
+							      u.first, u.second,
+							      SplitRadix<LEN/4>()(q.first),
+							      SplitRadix<LEN/4>()(q.second))));
+	}
+};
+
+template <>
+struct SplitRadix<2>{
+	template <typename T>
+	std::array<FFT_t<T>, 2> operator()(std::array<FFT_t<T>, 2> const& IN) const {
+#pragma HLS INLINE
+		auto h = hops::split<1>(IN);
+		return nPtFFT(h.first, h.second);
+	}
+};
+
+template <>
+struct SplitRadix<1>{
+	template <typename T>
+	std::array<FFT_t<T>, 1> operator()(std::array<FFT_t<T>, 1> const& IN) const {
+#pragma HLS INLINE
+		return IN;
+	}
+};
+
+// The FFT figures count complex multiplications by twiddle factors
+// (ops), levels of butterflies (depth) and computed elements
+// (storage). A radix-2 butterfly (FFTOP) multiplies once.
+namespace hops{
+	// Interleave only moves data, so the bit-reversal is wiring
+	template <typename... AS>
+	struct FunctionCost<Interleave, AS...> : public Figures<0, 0, 0>{
+	};
+
+	template <std::size_t N, typename... AS>
+	struct FunctionCost<Radix4OP<N>, AS...> : public Figures<3, 1, 4>{
+	};
+
+	template <std::size_t N, typename... AS>
+	struct FunctionCost<SplitOP<N>, AS...> : public Figures<2, 1, 4>{
+	};
+
+	template <typename T, std::size_t LEN>
+	struct FunctionCost<Radix4, std::array<T, LEN>, std::array<T, LEN> >
+		: public Cost<ZipWith, FFTOP<2*LEN>, std::array<ctx_t, LEN>,
+			      std::array<std::pair<T, T>, LEN> >{
+	};
+
+	template <typename T, std::size_t LEN>
+	struct FunctionCost<Radix4, std::array<T, LEN>, std::array<T, LEN>,
+			    std::array<T, LEN>, std::array<T, LEN> >
+		: public Cost<ZipWith, Radix4OP<4*LEN>, std::array<std::size_t, LEN>,
+			      std::array<T, LEN>, std::array<T, LEN>,
+			      std::array<T, LEN>, std::array<T, LEN> >{
+	};
+}
+
+template<typename C, std::size_t LEN>
+auto fft(std::array<C, LEN> const& IN)
+	-> std::array<C, LEN>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+	return hops::butterfly(FFTOP<LEN>(), bitreverse(IN));
+}
+
+// The figures of fft: a bit-reversal followed by a butterfly of FFTOP
+template<typename T, std::size_t LEN>
+using FFTCost = hops::Sequential<
+	hops::Cost<hops::Divconq, Interleave, std::array<std::complex<T>, LEN> >,
+	hops::Cost<hops::Butterfly, FFTOP<LEN>, std::array<std::complex<T>, LEN> > >;
+
+// Radix-4 FFT: a digit-reversal followed by a divconq4 of radix-4
+// butterflies. When LEN is not a power of four, the first level is
+// radix-2.
 template<typename T, std::size_t LEN>
-auto fft(std::array<std::complex<T>, LEN> const& IN)
+auto fft4(std::array<std::complex<T>, LEN> const& IN)
 	-> std::array<std::complex<T>, LEN>{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-	return hops::divconq(nPtFFT, bitreverse(IN));
+	return hops::divconq4(radix4, digitreverse(IN));
 }
 
+// The figures of fft4. The digit-reversal is wiring.
+template<typename T, std::size_t LEN>
+using FFT4Cost = hops::Cost<hops::Divconq4, Radix4, std::array<std::complex<T>, LEN> >;
+
+// Split-radix FFT: a bit-reversal followed by the recursion of
+// SplitRadix
+template<typename T, std::size_t LEN>
+auto srfft(std::array<std::complex<T>, LEN> const& IN)
+	-> std::array<std::complex<T>, LEN>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+	return SplitRadix<LEN>()(bitreverse(IN));
+}
+
+// The figures of srfft: the N/2-point FFT and the two N/4-point FFTs
+// are computed in parallel, followed by a level of SplitOP
+template<typename T, std::size_t LEN>
+struct SRFFTCost{
+	typedef SRFFTCost<T, LEN/2> half;
+	typedef SRFFTCost<T, LEN/4> quarter;
+	typedef std::array<std::complex<T>, LEN/4> Q;
+	typedef hops::Cost<hops::ZipWith, SplitOP<LEN>, std::array<std::size_t, LEN/4>, Q, Q, Q, Q> fn;
+
+	static constexpr std::size_t ops = half::ops + 2 * quarter::ops + fn::ops;
+	static constexpr std::size_t depth = hops::costmax(half::depth, quarter::depth) + fn::depth;
+	static constexpr std::size_t storage = half::storage + 2 * quarter::storage + fn::storage;
+};
+
+template<typename T>
+struct SRFFTCost<T, 2> : public hops::FunctionCost<Radix4, std::array<std::complex<T>, 1>,
+						   std::array<std::complex<T>, 1> >{
+};
+
+template<typename T>
+struct SRFFTCost<T, 1> : public hops::Figures<0, 0, 0>{
+};
+
 namespace loop{
 	template <typename T, std::size_t LEN>
 	std::array<T, LEN> bitreverse(std::array<T, LEN> const& IN){
@@ -163,7 +461,7 @@ namespace loop{
 			std::size_t base = top + (grp<<(l + 1));
 			std::pair<T, T> d = {in[base], in[base + stride]};
 			std::pair<std::size_t, std::size_t> ctx = {l + 1, top};
-			std::pair<T, T> o = fftop(ctx, d);
+			std::pair<T, T> o = FFTOP<2*LEN>()(ctx, d);
 			out[base]= o.first;
 			out[base + stride] = o.second;
 		}
@@ -171,43 +469,11 @@ namespace loop{
 
 	}
 
-	template <class FN, std::size_t LEN, typename T>
-	std::array<T, LEN> butterfly(FN const& F, std::array<T, LEN> IN){
-#pragma HLS INLINE
-
-		static const int LEV = hops::clog2(LEN);
-		std::array<std::array<T, LEN>, LEV + 1> stagearr;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr._M_instance[0]
-#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
-		stagearr[0]  = IN;
-	bfly_level:
-		for(std::size_t l = 0; l < LEV; ++l){
-#pragma HLS UNROLL
-			std::size_t dftp = (1<<(l + 1));
-			std::size_t stride = 1<<l;
-			std::size_t mask = stride - 1;
-		bfly_pair:
-			for(std::size_t i = 0; i < (1 << (LEV - 1)); ++i){
-#pragma HLS UNROLL
-				std::size_t grp = i >> l;
-				std::size_t top = i & mask;
-				std::size_t base = top + (grp<<(l + 1));
-				std::pair<T, T> in = {stagearr[l][base], stagearr[l][base + stride]};
-				std::pair<std::size_t, std::size_t> ctx = {l + 1, top};
-				std::pair<T, T> o = FN()(ctx, in);
-				stagearr[l+1][base]= o.first;
-				stagearr[l+1][base + stride] = o.second;
-			}
-		}
-		return stagearr[LEV];
-	}
-
 	template<typename T, std::size_t LEN>
 	std::array<std::complex<T>, LEN> fft(std::array<std::complex<T>, LEN> IN){
 #pragma HLS INLINE
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
-		auto res = butterfly(fftop, loop::bitreverse(IN));
+		auto res = hops::loop::butterfly(FFTOP<LEN>(), loop::bitreverse(IN));
 #pragma HLS ARRAY_PARTITION complete VARIABLE=res._M_instance
 		return res;
 	}
@@ -37,10 +37,8 @@
 #include "utility.hpp"
 #include "fft.hpp"
 #ifdef BIT_ACCURATE
-#include "hls_math.h"
-#include "ap_fixed.h"
-#include "ap_int.h"
-#define DTYPE ap_fixed<32, 16, AP_RND>
+#include "fixed.hpp"
+#define DTYPE hops::fixed<32, 16, hops::RND>
 #else 
 #define DTYPE float
 #endif
@@ -48,6 +46,28 @@
 #define LOG_LIST_LENGTH 4
 #define LIST_LENGTH (1<<LOG_LIST_LENGTH)
 
+typedef FFTCost<DTYPE, LIST_LENGTH> fft_cost;
+static_assert(fft_cost::ops == (LIST_LENGTH / 2) * LOG_LIST_LENGTH,
+	"fft_hop_synth has (N/2)log2(N) butterflies");
+static_assert(fft_cost::depth == LOG_LIST_LENGTH,
+	"fft_hop_synth has a depth of log2(N) butterflies");
+
+// Radix-4 butterflies multiply by three twiddle factors, where two
+// levels of radix-2 butterflies multiply by four
+typedef FFT4Cost<DTYPE, LIST_LENGTH> fft4_cost;
+static_assert(fft4_cost::ops == 3 * fft_cost::ops / 4,
+	"fft4_hop_synth has 25% fewer complex multiplications than fft_hop_synth");
+static_assert(fft4_cost::depth == LOG_LIST_LENGTH / 2,
+	"fft4_hop_synth has a depth of log4(N) butterflies");
+static_assert(FFT4Cost<DTYPE, 2*LIST_LENGTH>::ops == LIST_LENGTH + 2 * fft4_cost::ops &&
+	      FFT4Cost<DTYPE, 2*LIST_LENGTH>::depth == LOG_LIST_LENGTH / 2 + 1,
+	"fft4 of other powers of two has a level of radix-2 butterflies");
+typedef SRFFTCost<DTYPE, LIST_LENGTH> srfft_cost;
+static_assert(srfft_cost::ops == 23 && srfft_cost::ops < fft4_cost::ops,
+	"srfft_hop_synth has fewer complex multiplications than fft4_hop_synth");
+static_assert(srfft_cost::depth == LOG_LIST_LENGTH,
+	"srfft_hop_synth has a depth of log2(N) butterflies");
+
 std::array<std::complex<DTYPE>, LIST_LENGTH> fft_loop_synth(std::array<std::complex<DTYPE>, LIST_LENGTH> const& IN){
 #pragma HLS PIPELINE
 #pragma HLS ARRAY_PARTITION variable=IN._M_instance COMPLETE
@@ -72,6 +92,18 @@ std::array<std::complex<DTYPE>, LIST_LENGTH> fft_hop_synth(std::array<std::compl
 	return fft(IN);
 }
 
+std::array<std::complex<DTYPE>, LIST_LENGTH> fft4_hop_synth(std::array<std::complex<DTYPE>, LIST_LENGTH> IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION variable=IN._M_instance COMPLETE
+	return fft4(IN);
+}
+
+std::array<std::complex<DTYPE>, LIST_LENGTH> srfft_hop_synth(std::array<std::complex<DTYPE>, LIST_LENGTH> IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION variable=IN._M_instance COMPLETE
+	return srfft(IN);
+}
+
 std::array<std::complex<DTYPE>, LIST_LENGTH> bitreverse_hop_synth(std::array<std::complex<DTYPE>, LIST_LENGTH> const& IN){
 #pragma HLS PIPELINE
 #pragma HLS ARRAY_PARTITION variable=IN._M_instance COMPLETE
@@ -213,6 +245,95 @@ int fft_test(){
 	return 0;
 }
 
+// The twiddle factors of FFTOP are read from a table of N/4
+// cosines. Check them against cos and sin at every level and index.
+template <std::size_t N>
+int twiddle_test(){
+	for(std::size_t lev = 1; (1u << lev) <= N; ++lev){
+		for(std::size_t idx = 0; idx < (1u << (lev - 1)); ++idx){
+			data_t<double> d = {{0, 0}, {1, 0}};
+			data_t<double> w = FFTOP<N>()(ctx_t(lev, idx), d);
+			double a = (-2*M_PI*idx)/(1<<lev);
+			if(std::abs(w.first - std::complex<double>(cos(a), -sin(a))) > 1e-12){
+				std::cout << "Error! Twiddle factor of a " << N << "-point FFT at level "
+					  << lev << ", index " << idx << " did not match" << std::endl;
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+// Checks fft4 and srfft against a DFT in double precision:
+// X[k] = sum of x[n]*exp(2*pi*j*n*k/N)
+template <std::size_t N>
+int variant_test(){
+	static std::array<std::complex<DTYPE>, N> in, out4, outsr;
+	static std::array<std::complex<double>, N> x, gold;
+	for(std::size_t n = 0; n < N; ++n){
+		x[n] = std::complex<double>((double)(n * 7 % 13) - 6, (double)(n * 5 % 11) - 5) / 8.0;
+		in[n] = {(DTYPE)x[n].real(), (DTYPE)x[n].imag()};
+	}
+	for(std::size_t k = 0; k < N; ++k){
+		gold[k] = 0;
+		for(std::size_t n = 0; n < N; ++n){
+			double a = 2*M_PI*((n * k) % N)/N;
+			gold[k] += x[n] * std::complex<double>(cos(a), sin(a));
+		}
+	}
+
+	out4 = fft4(in);
+	outsr = srfft(in);
+	for(std::size_t k = 0; k < N; ++k){
+		std::complex<double> r4(float(out4[k].real()), float(out4[k].imag()));
+		std::complex<double> rsr(float(outsr[k].real()), float(outsr[k].imag()));
+		if(std::abs(r4 - gold[k]) > .25){
+			std::cout << "Error! " << N << "-point radix-4 FFT value at index "
+				  << k << " did not match" << std::endl;
+			return -1;
+		}
+		if(std::abs(rsr - gold[k]) > .25){
+			std::cout << "Error! " << N << "-point split-radix FFT value at index "
+				  << k << " did not match" << std::endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int variants_test(){
+	std::array<std::complex<DTYPE>, LIST_LENGTH> in, gold, out;
+	for(int i = 0; i < LIST_LENGTH; i ++){
+		in[i] = {(DTYPE)(i + 1), (DTYPE)(LIST_LENGTH - i)};
+	}
+	gold = fft_hop_synth(in);
+	out = fft4_hop_synth(in);
+	for(int i = 0; i < LIST_LENGTH; i ++){
+		if(std::abs(float(gold[i].real() - out[i].real())) > .25 ||
+		   std::abs(float(gold[i].imag() - out[i].imag())) > .25){
+			std::cout << "Error! fft4_hop_synth values at index "
+				  << i << " did not match fft_hop_synth" << std::endl;
+			return -1;
+		}
+	}
+	out = srfft_hop_synth(in);
+	for(int i = 0; i < LIST_LENGTH; i ++){
+		if(std::abs(float(gold[i].real() - out[i].real())) > .25 ||
+		   std::abs(float(gold[i].imag() - out[i].imag())) > .25){
+			std::cout << "Error! srfft_hop_synth values at index "
+				  << i << " did not match fft_hop_synth" << std::endl;
+			return -1;
+		}
+	}
+	if(variant_test<16>() || variant_test<32>() || variant_test<64>() ||
+	   variant_test<128>() || variant_test<256>() || variant_test<512>() ||
+	   variant_test<1024>() || variant_test<2048>() || variant_test<4096>()){
+		return -1;
+	}
+	std::cout << "Passed Radix-4 and Split-Radix FFT tests!" << std::endl;
+	return 0;
+}
+
 int bitreverse_test(){
 	std::array<std::complex<DTYPE>, LIST_LENGTH> in, out;
 	DTYPE gold_real[LIST_LENGTH];
@@ -260,12 +381,23 @@ int bitreverse_test(){
 
 int main(){
 	int err;
+	std::cout << "fft_hop_synth: " << fft_cost::ops << " butterflies, depth "
+		  << fft_cost::depth << ", " << fft_cost::storage
+		  << " intermediate elements" << std::endl;
 	if((err = bitreverse_test())){
 		return err;
 	}
+	if((err = twiddle_test<2>()) || (err = twiddle_test<LIST_LENGTH>()) ||
+	   (err = twiddle_test<4096>())){
+		return err;
+	}
+	std::cout << "Passed Twiddle tests!" << std::endl;
 	if((err = fft_test())){
 		return err;
 	}
+	if((err = variants_test())){
+		return err;
+	}
 	std::cout << "FFT Tests Passed!" << std::endl;
 	return 0;	
 }
@@ -68,4 +68,35 @@
 #define COEFFS_INIT { 10,  11,  11,   8,   3,  -3,  -8, -11, -11, -10, \
 		     -10, -10, -10, -10, -10, -10 }
 #endif // C_NUM_TAPS
-#endif // COEFFS_INIT
+
+#include <array>
+#include <functional>
+#include "mapreduce.hpp"
+#include "window.hpp"
+
+// Dot product of the coefficients and a window of C_NUM_TAPS samples.
+// W is a DelayLineView, so the fused products read the delay line in
+// place
+template <typename T, typename TC>
+struct Taps{
+	std::array<TC, C_NUM_TAPS> const& C;
+	Taps(std::array<TC, C_NUM_TAPS> const& C) : C(C) {}
+	template <class W>
+	T operator()(W const& w) const{
+#pragma HLS INLINE
+		return hops::Mapreduce<hops::Tree>()(std::multiplies<T>(),
+						std::plus<T>(), T(0), C, w);
+	}
+};
+
+// One output sample of the filter, the kernel of fir_hop_synth: IN is
+// pushed into the delay line SIG, and the window of SIG is filtered
+// by the coefficients C. It is templated on the sample type, so
+// hops::batch can filter many signals in lockstep (hops::Lanes).
+template <typename T, typename TC>
+T fir_hop(hops::DelayLine<T, C_NUM_TAPS>& SIG, std::array<TC, C_NUM_TAPS> const& C,
+	T const& IN){
+#pragma HLS INLINE
+	return hops::window<C_NUM_TAPS>(Taps<T, TC>(C), SIG, IN);
+}
+#endif // __FIR_HPP
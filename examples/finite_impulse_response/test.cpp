@@ -39,15 +39,17 @@
 #include "arrayops.hpp"
 #include "reduce.hpp"
 #include "zip.hpp"
+#include "window.hpp"
+#include "mapreduce.hpp"
 #include "utility.hpp"
 
 #include "fir.hpp"
 
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
-typedef ap_fixed<32, 4> coef_t;
-typedef ap_fixed<32, 8> data_t;
-typedef ap_fixed<32, 8> acc_t;
+#include "fixed.hpp"
+typedef hops::fixed<32, 4> coef_t;
+typedef hops::fixed<32, 8> data_t;
+typedef hops::fixed<32, 8> acc_t;
 #else
 typedef float coef_t;
 typedef float data_t;
@@ -67,14 +69,11 @@ data_t gold_fir(data_t signal){
 
 data_t fir_hop_synth(data_t const& IN){
 #pragma HLS PIPELINE
-	static std::array<data_t, C_NUM_TAPS> sig;
+	static hops::DelayLine<data_t, C_NUM_TAPS> sig;
 	static const std::array<data_t, C_NUM_TAPS> coeffs = {COEFFS_INIT};
-#pragma HLS ARRAY_PARTITION variable=sig._M_instance COMPLETE
+#pragma HLS ARRAY_PARTITION variable=sig.line._M_instance COMPLETE
 #pragma HLS ARRAY_PARTITION variable=coeffs._M_instance COMPLETE
-	sig = hops::rshift(IN, sig);
-	return hops::rreduce(std::plus<data_t>(),
-			hops::zipWith(std::multiplies<data_t>(),
-				sig, coeffs), 0);
+	return fir_hop(sig, coeffs, IN);
 }
 
 data_t fir_loop_synth(data_t const& IN){
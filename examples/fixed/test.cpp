@@ -0,0 +1,285 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <iostream>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <random>
+#include "fixed.hpp"
+#include "reduce.hpp"
+#include "mapreduce.hpp"
+#include "zip.hpp"
+#include "utility.hpp"
+
+using hops::intw;
+using hops::uintw;
+using hops::fixed;
+using hops::ufixed;
+
+#define LOG_LIST_LENGTH 4
+#define LIST_LENGTH (1<<LOG_LIST_LENGTH)
+#define RANDOM_TESTS 10000
+
+typedef intw<12> sample_t;
+typedef fixed<16, 8> q8_t;
+typedef fixed<16, 8, hops::RND> q8r_t;
+typedef fixed<16, 8, hops::TRN, hops::SAT> q8s_t;
+
+sample_t sum_hop_synth(std::array<sample_t, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return hops::treereduce(std::plus<sample_t>(), IN);
+}
+
+q8_t dot_hop_synth(std::array<q8_t, LIST_LENGTH> const& L,
+		   std::array<q8_t, LIST_LENGTH> const& R){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
+	return hops::Mapreduce<hops::Tree>()(std::multiplies<q8_t>(), std::plus<q8_t>(), q8_t(0), L, R);
+}
+
+// Returns the value of a Fixed type with F fractional bits that
+// holds RAW, as a double
+double real(long long RAW, int F){
+	return std::ldexp(static_cast<double>(RAW), -F);
+}
+
+// Returns RAW wrapped to W signed bits
+long long wrapped(long long RAW, int W){
+	long long m = 1LL << W;
+	RAW = ((RAW % m) + m) % m;
+	return (RAW >= m / 2) ? RAW - m : RAW;
+}
+
+int test_integer(){
+	// Values are held in the smallest native integer
+	static_assert(sizeof(intw<1>) == 1 && sizeof(uintw<8>) == 1 && sizeof(intw<12>) == 2 &&
+		      sizeof(intw<17>) == 4 && sizeof(uintw<33>) == 8,
+		      "intw is not held in the smallest native integer");
+	static_assert(sizeof(std::array<sample_t, LIST_LENGTH>) == LIST_LENGTH * 2,
+		      "Arrays of intw are not packed");
+
+	// Results hold every value of their operands, and wrap when
+	// they are assigned to a narrower type
+	intw<4> i4 = 7;
+	uintw<4> u4 = 15;
+	intw<1> bit = 1;
+	intw<4> i4w = i4 + 1;
+	uintw<4> u4w = u4 + 1;
+	if(i4 + 1 != 8 || i4w != -8 || u4 + 1 != 16 || u4w != 0 || bit != -1 ||
+	   -intw<4>(-8) != 8 || (i4 << 1) != -2){
+		std::cout << "Error! intw does not wrap" << std::endl;
+		return -1;
+	}
+	// The result types and values below are those of ap_int
+	auto s = intw<8>(100) + intw<12>(100);
+	static_assert(std::is_same<decltype(s), intw<13> >::value, "intw<8> + intw<12> is not intw<13>");
+	static_assert(std::is_same<decltype(intw<8>() * 3), intw<40> >::value, "intw<8> * int is not intw<40>");
+	static_assert(std::is_same<decltype(uintw<8>() - uintw<8>()), intw<9> >::value,
+		      "uintw<8> - uintw<8> is not intw<9>");
+	static_assert(std::is_same<decltype(uintw<8>() + intw<8>()), intw<10> >::value,
+		      "uintw<8> + intw<8> is not intw<10>");
+	static_assert(std::is_same<decltype(intw<8>() / intw<4>()), intw<9> >::value,
+		      "intw<8> / intw<4> is not intw<9>");
+	static_assert(std::is_same<decltype(-uintw<8>()), intw<9> >::value, "-uintw<8> is not intw<9>");
+	static_assert(std::is_same<decltype(uintw<8>() % intw<12>()), uintw<8> >::value,
+		      "uintw<8> % intw<12> is not uintw<8>");
+	static_assert(std::is_same<decltype(intw<12>() % uintw<4>()), intw<5> >::value,
+		      "intw<12> % uintw<4> is not intw<5>");
+	if(s != 200 || intw<8>(100) + intw<8>(100) != 200 || intw<8>(100) * 3 != 300 ||
+	   uintw<8>(3) - uintw<8>(5) != -2 || intw<8>(-128) * intw<8>(-128) != 16384 ||
+	   intw<8>(-128) / intw<8>(-1) != 128 || !(intw<8>(-1) < uintw<8>(255)) ||
+	   !(uintw<64>(~0ULL) > intw<8>(-1)) || intw<8>(-7) / 2 != -3 || intw<8>(-7) % 2 != -1){
+		std::cout << "Error! Mixed intw arithmetic is wrong" << std::endl;
+		return -1;
+	}
+	uintw<12> u = 0xABC;
+	if(u[0] || !u[2] || u.range(11, 4) != 0xAB || (u ^ 0xFFF) != 0x543 || (u >> 4) != 0xAB){
+		std::cout << "Error! uintw bit operations are wrong" << std::endl;
+		return -1;
+	}
+	// Random sums and products are exact, and wrap as two's
+	// complement when they are assigned
+	std::mt19937 gen(0);
+	std::uniform_int_distribution<int> dist(-2048, 2047);
+	for(int t = 0; t < RANDOM_TESTS; ++t){
+		int a = dist(gen), b = dist(gen);
+		sample_t x = a, y = b;
+		sample_t sum = x + y, diff = x - y, prod = x * y;
+		if(x + y != a + b || x - y != a - b || x * y != (long long)a * b ||
+		   sum != wrapped(a + b, 12) || diff != wrapped(a - b, 12) ||
+		   prod != wrapped((long long)a * b, 12) || (x < y) != (a < b)){
+			std::cout << "Error! intw<12> arithmetic on " << a << " and " << b
+				  << " is wrong" << std::endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int test_fixed(){
+	static_assert(sizeof(q8_t) == 2 && sizeof(fixed<32, 16>) == 4, "fixed is not packed");
+
+	// Quantization: TRN rounds toward minus infinity, RND to
+	// the nearest value with halves toward plus infinity
+	if(double(fixed<8, 4>(1.3)) != 1.25 || double(fixed<8, 4, hops::RND>(1.3)) != 1.3125 ||
+	   double(fixed<8, 4>(-1.3)) != -1.3125 || double(fixed<8, 4, hops::RND>(-1.28125)) != -1.25 ||
+	   double(fixed<8, 4, hops::RND>(1.28125)) != 1.3125 || int(fixed<8, 4>(-1.5)) != -1){
+		std::cout << "Error! fixed quantization is wrong" << std::endl;
+		return -1;
+	}
+	// Overflow: WRAP keeps the low bits, and SAT saturates when a
+	// value is assigned
+	fixed<8, 4, hops::TRN, hops::SAT> sat = fixed<8, 4, hops::TRN, hops::SAT>(7) + 7;
+	if(double(fixed<8, 4>(8.0)) != -8.0 || double(fixed<8, 4, hops::TRN, hops::SAT>(8.0)) != 7.9375 ||
+	   double(fixed<8, 4, hops::TRN, hops::SAT>(-100)) != -8.0 ||
+	   double(fixed<8, 4, hops::TRN, hops::SAT>(7) + 7) != 14 || double(sat) != 7.9375 ||
+	   double(ufixed<8, 4, hops::TRN, hops::SAT>(-1.0)) != 0.0 ||
+	   double(ufixed<8, 4>(-1.0)) != 15.0){
+		std::cout << "Error! fixed overflow is wrong" << std::endl;
+		return -1;
+	}
+	// The result types and values below are those of ap_fixed.
+	// Products are exact, and are quantized when they are
+	// assigned. Quotients keep the fractional bits of the
+	// dividend, truncated toward zero.
+	static_assert(std::is_same<decltype(q8_t() * q8_t()), fixed<32, 16> >::value,
+		      "fixed<16, 8> * fixed<16, 8> is not fixed<32, 16>");
+	static_assert(std::is_same<decltype(q8_t() / q8_t()), fixed<25, 17> >::value,
+		      "fixed<16, 8> / fixed<16, 8> is not fixed<25, 17>");
+	static_assert(std::is_same<decltype(fixed<16, 4>() + fixed<16, 4>()), fixed<17, 5> >::value,
+		      "fixed<16, 4> + fixed<16, 4> is not fixed<17, 5>");
+	static_assert(std::is_same<decltype(q8_t() * 2), fixed<48, 40> >::value,
+		      "fixed<16, 8> * int is not fixed<48, 40>");
+	fixed<8, 4> trn = fixed<8, 4>(0.0625) * fixed<8, 4>(0.5);
+	fixed<8, 4, hops::RND> rnd = fixed<8, 4, hops::RND>(0.0625) * fixed<8, 4, hops::RND>(0.5);
+	if(double(q8_t(100) * q8_t(100)) != 10000 || double(fixed<16, 4>(7.5) + fixed<16, 4>(7.5)) != 15 ||
+	   double(q8_t(100) * 2) != 200 || double(-ufixed<8, 4>(15)) != -15 ||
+	   double(fixed<8, 4>(1.5) * fixed<8, 4>(1.5)) != 2.25 ||
+	   double(fixed<8, 4>(0.0625) * fixed<8, 4>(0.5)) != 0.03125 ||
+	   double(trn) != 0 || double(rnd) != 0.0625 ||
+	   (q8_t(2) / q8_t(3)).v != 170 || (q8r_t(2) / q8r_t(3)).v != 170 ||
+	   (q8_t(-2) / q8_t(3)).v != -170 || (q8r_t(-2) / q8r_t(3)).v != -170){
+		std::cout << "Error! fixed multiplication or division is wrong" << std::endl;
+		return -1;
+	}
+	auto m = fixed<8, 6>(3.25) + fixed<8, 2>(0.015625);
+	static_assert(std::is_same<decltype(m), fixed<13, 7> >::value, "fixed<8, 6> + fixed<8, 2> is not fixed<13, 7>");
+	if(double(m) != 3.265625 || !(fixed<8, 6>(3.25) > fixed<8, 2>(1.75)) ||
+	   double(q8_t(intw<4>(-3))) != -3.0){
+		std::cout << "Error! Mixed fixed arithmetic is wrong" << std::endl;
+		return -1;
+	}
+
+	// Random arithmetic matches a model computed exactly with
+	// doubles
+	std::mt19937 gen(0);
+	std::uniform_int_distribution<int> dist(-32768, 32767);
+	for(int t = 0; t < RANDOM_TESTS; ++t){
+		int a = dist(gen), b = dist(gen);
+		q8_t x = q8_t::bits(a), y = q8_t::bits(b);
+		q8r_t xr = q8r_t::bits(a), yr = q8r_t::bits(b);
+		q8s_t xs = q8s_t::bits(a), ys = q8s_t::bits(b);
+		double p = real(a, 8) * real(b, 8) * 256;
+		long long sat = std::max(-32768LL, std::min(32767LL, (long long)std::floor(p)));
+		q8_t sum = x + y, diff = x - y, prod = x * y;
+		q8r_t prodr = xr * yr;
+		q8s_t prods = xs * ys, sums = xs + ys;
+		if((x + y).v != a + b || (x - y).v != a - b || (x * y).v != (long long)a * b ||
+		   sum.v != wrapped(a + b, 16) || diff.v != wrapped(a - b, 16) ||
+		   prod.v != wrapped((long long)std::floor(p), 16) ||
+		   prodr.v != wrapped((long long)std::floor(p + 0.5), 16) ||
+		   prods.v != sat || sums.v != std::max(-32768, std::min(32767, a + b)) ||
+		   (x < y) != (a < b)){
+			std::cout << "Error! fixed<16, 8> arithmetic on " << real(a, 8) << " and "
+				  << real(b, 8) << " is wrong" << std::endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int test_hofs(){
+	std::array<sample_t, LIST_LENGTH> samples;
+	std::array<q8_t, LIST_LENGTH> l, r;
+	long long gold = 0;
+	double dot = 0;
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		samples[i] = 255 * i;
+		gold += 255 * i;
+		l[i] = 0.5 * i - 4;
+		r[i] = 0.25 * i;
+		dot += (0.5 * i - 4) * (0.25 * i);
+	}
+	// The sum wraps in 12 bits, as the hardware adder tree does
+	if(sum_hop_synth(samples) != wrapped(gold, 12)){
+		std::cout << "Error! treereduce of intw<12> is wrong" << std::endl;
+		return -1;
+	}
+	if(double(dot_hop_synth(l, r)) != dot){
+		std::cout << "Error! mapreduce of fixed<16, 8> is wrong" << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int main(){
+	int err;
+	std::cout << "Running intw test... ";
+	err = test_integer();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running fixed test... ";
+	err = test_fixed();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running HOF test... ";
+	err = test_hofs();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -0,0 +1,238 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <iostream>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include "growth.hpp"
+#include "fixed.hpp"
+#include "reduce.hpp"
+#include "exec.hpp"
+#include "zip.hpp"
+#include "utility.hpp"
+
+using hops::intw;
+using hops::uintw;
+using hops::fixed;
+
+#define LOG_LIST_LENGTH 4
+#define LIST_LENGTH (1<<LOG_LIST_LENGTH)
+#define ODD_LIST_LENGTH 13
+
+typedef intw<8> sample_t;
+typedef hops::Accumulator<intw<16>, LIST_LENGTH>::type acc_t;
+
+// Each product is 16 bits, and each level of the adder tree one bit
+// wider, so the result is 16 + clog2(LIST_LENGTH) bits
+auto dot_hop_synth(std::array<sample_t, LIST_LENGTH> const& L,
+		   std::array<sample_t, LIST_LENGTH> const& R)
+	-> intw<16 + LOG_LIST_LENGTH>{
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
+	return hops::treereduce(hops::grow_plus, hops::zipWith(hops::grow_multiplies, L, R));
+}
+
+// A chain shares one accumulator of 16 + clog2(LIST_LENGTH) bits
+acc_t dot_loop_synth(std::array<sample_t, LIST_LENGTH> const& L,
+		     std::array<sample_t, LIST_LENGTH> const& R){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
+	acc_t acc = 0;
+	for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+#pragma HLS UNROLL
+		acc += intw<16>(L[i]) * intw<16>(R[i]);
+	}
+	return acc;
+}
+
+// The result type of a treereduce of LEN elements of type T with F
+template <typename T, std::size_t LEN, class FN = hops::Grow<std::plus> >
+using tree_t = decltype(hops::treereduce(FN(), std::array<T, LEN>()));
+
+// Each level of the tree widens by one bit
+static_assert(std::is_same<tree_t<sample_t, 2>, intw<9> >::value &&
+	      std::is_same<tree_t<sample_t, 4>, intw<10> >::value &&
+	      std::is_same<tree_t<sample_t, LIST_LENGTH>, intw<8 + LOG_LIST_LENGTH> >::value,
+	      "Each level of a growing tree must be one bit wider");
+// Trees of other lengths grow by clog2(LEN) bits in all
+static_assert(std::is_same<tree_t<sample_t, 3>, intw<10> >::value &&
+	      std::is_same<tree_t<sample_t, 5>, intw<11> >::value &&
+	      std::is_same<tree_t<sample_t, ODD_LIST_LENGTH>, intw<12> >::value &&
+	      std::is_same<tree_t<sample_t, 1>, sample_t>::value,
+	      "A growing tree must grow by clog2(LEN) bits");
+// The result type of an lreduce and rreduce of LEN elements of type T
+// with F
+template <typename T, std::size_t LEN, class FN = hops::Grow<std::plus> >
+using lchain_t = decltype(hops::lreduce(FN(), 0, std::array<T, LEN>()));
+
+template <typename T, std::size_t LEN, class FN = hops::Grow<std::plus> >
+using rchain_t = decltype(hops::rreduce(FN(), std::array<T, LEN>(), 0));
+
+// Chains grow by clog2(LEN) bits, not by one bit per element
+static_assert(std::is_same<lchain_t<sample_t, LIST_LENGTH>, intw<12> >::value &&
+	      std::is_same<rchain_t<sample_t, LIST_LENGTH>, intw<12> >::value &&
+	      std::is_same<lchain_t<uintw<8>, ODD_LIST_LENGTH>, uintw<12> >::value &&
+	      std::is_same<lchain_t<fixed<16, 8>, LIST_LENGTH>, fixed<20, 12> >::value,
+	      "A growing chain must grow by clog2(LEN) bits");
+static_assert(std::is_same<hops::Accumulator<sample_t, LIST_LENGTH>::type, intw<12> >::value &&
+	      std::is_same<hops::Accumulator<sample_t, ODD_LIST_LENGTH>::type, intw<12> >::value &&
+	      std::is_same<hops::Accumulator<sample_t, 1>::type, sample_t>::value &&
+	      std::is_same<hops::Accumulator<uintw<8>, 2>::type, uintw<9> >::value,
+	      "An accumulator must grow by clog2(LEN) bits");
+// Fixed-point types grow their integer bits, and products add widths
+static_assert(std::is_same<hops::Accumulator<fixed<16, 8>, LIST_LENGTH>::type, fixed<20, 12> >::value &&
+	      std::is_same<hops::Growth<std::multiplies, fixed<16, 8>, fixed<12, 2> >::type, fixed<28, 10> >::value,
+	      "Fixed-point types must grow their integer bits");
+// Native integers grow to Integers, held in the narrowest native
+// integer, so the sum of 16 bytes uses 16-bit lanes rather than 32-bit
+// lanes
+static_assert(std::is_same<hops::Accumulator<std::uint8_t, LIST_LENGTH>::type, uintw<12> >::value &&
+	      std::is_same<tree_t<std::uint8_t, LIST_LENGTH>, uintw<12> >::value &&
+	      std::is_same<tree_t<std::int16_t, LIST_LENGTH>, intw<20> >::value &&
+	      std::is_same<hops::Common<std::uint8_t, std::int8_t>::type, intw<9> >::value &&
+	      sizeof(uintw<12>) == sizeof(std::uint16_t),
+	      "Native integers must grow to the narrowest Integer");
+
+int test_tree(){
+	std::array<sample_t, LIST_LENGTH> lo, hi;
+	std::array<uintw<8>, ODD_LIST_LENGTH> odd;
+	lo.fill(-128);
+	hi.fill(127);
+	odd.fill(255);
+	// The extremes do not overflow
+	if(hops::treereduce(hops::grow_plus, lo) != -128 * LIST_LENGTH ||
+	   hops::treereduce(hops::grow_plus, hi) != 127 * LIST_LENGTH ||
+	   hops::treereduce(hops::grow_plus, odd) != 255 * ODD_LIST_LENGTH){
+		std::cout << "Error! Growing treereduce overflowed" << std::endl;
+		return -1;
+	}
+	// Without growth, the sum wraps in 8 bits
+	if(hops::treereduce(std::plus<sample_t>(), hi) == 127 * LIST_LENGTH){
+		std::cout << "Error! Non-growing treereduce did not wrap" << std::endl;
+		return -1;
+	}
+	std::array<std::uint8_t, LIST_LENGTH> bytes;
+	bytes.fill(255);
+	if(hops::treereduce(hops::grow_plus, bytes) != 255 * LIST_LENGTH){
+		std::cout << "Error! Growing treereduce of bytes overflowed" << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int test_chain(){
+	std::array<sample_t, LIST_LENGTH> lo, hi;
+	std::array<uintw<8>, ODD_LIST_LENGTH> odd;
+	lo.fill(-128);
+	hi.fill(127);
+	odd.fill(255);
+	// The extremes do not overflow the accumulator
+	if(hops::lreduce(hops::grow_plus, 0, lo) != -128 * LIST_LENGTH ||
+	   hops::rreduce(hops::grow_plus, hi, 0) != 127 * LIST_LENGTH ||
+	   hops::lreduce(hops::grow_plus, 0, odd) != 255 * ODD_LIST_LENGTH ||
+	   hops::rreduce(hops::grow_plus, odd, 0) != 255 * ODD_LIST_LENGTH){
+		std::cout << "Error! Growing chain overflowed" << std::endl;
+		return -1;
+	}
+	// A loop policy shares the same accumulator
+	if(hops::lreduce(hops::exec::loop, hops::grow_plus, 0, lo) != -128 * LIST_LENGTH ||
+	   hops::rreduce(hops::exec::loop, hops::grow_plus, odd, 0) != 255 * ODD_LIST_LENGTH){
+		std::cout << "Error! Growing loop chain overflowed" << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int test_dot(){
+	std::array<sample_t, LIST_LENGTH> l, r;
+	int gold = 0;
+	// The largest product, (-128)(-128), LIST_LENGTH times
+	l.fill(-128);
+	r.fill(-128);
+	gold = 128 * 128 * LIST_LENGTH;
+	if(dot_hop_synth(l, r) != gold || dot_loop_synth(l, r) != gold){
+		std::cout << "Error! Dot product of extremes overflowed" << std::endl;
+		return -1;
+	}
+	gold = 0;
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		l[i] = 17 * i - 128;
+		r[i] = 127 - 13 * i;
+		gold += (17 * i - 128) * (127 - 13 * i);
+	}
+	acc_t chain = hops::lreduce(hops::grow_plus, 0,
+				    hops::zipWith(hops::grow_multiplies, l, r));
+	if(dot_hop_synth(l, r) != gold || dot_loop_synth(l, r) != gold || chain != gold){
+		std::cout << "Error! Dot product is wrong" << std::endl;
+		return -1;
+	}
+	std::array<fixed<16, 8>, LIST_LENGTH> f;
+	f.fill(127.5);
+	if(double(hops::treereduce(hops::grow_plus, f)) != 127.5 * LIST_LENGTH){
+		std::cout << "Error! Growing treereduce of fixed<16, 8> overflowed" << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int main(){
+	int err;
+	std::cout << "Running growing treereduce test... ";
+	err = test_tree();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running growing chain test... ";
+	err = test_chain();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running growing dot product test... ";
+	err = test_dot();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -89,6 +89,27 @@
 #
 #           Paths to any of the library header files included.
 #
+#       SW_FLAGS : String
+#
+#           Additional compiler flags for the sw_test build, such as
+#           -pthread for tests that start threads (Default: empty)
+#
+#       BENCH_FILE : String
+#
+#           BENCH_FILE specifies the name of the benchmark file built
+#           by the bench rule. Only directories that contain this file
+#           can run make bench.
+#
+#       BENCH_LENGTHS : String
+#
+#           A list of LIST_LENGTH values. The bench rule compiles and
+#           runs BENCH_FILE once for each value and records the
+#           compile time and the benchmark output in bench.log
+#
+#       BENCH_FLAGS : String
+#
+#           Compiler flags for the benchmark builds (Default: -O2)
+#
 # AUTHOR : Dustin Richmond (drichmond)
 #
 # **********************************************************************
@@ -103,6 +124,10 @@ SYNTH_PATH    ?= ..
 TEST_FILE     ?= test.cpp
 INCLUDES      +=-I$(LIBRARY_PATH) -I$(UTILITY_PATH)
 LIBRARY_FILES ?= 
+SW_FLAGS      ?=
+BENCH_FILE    ?= bench.cpp
+BENCH_LENGTHS ?= 64 256 1024 4096
+BENCH_FLAGS   ?= -O2
 
 all: sw_test csim
 
@@ -112,7 +137,31 @@ sw_test.log: sw_test.run
 
 sw_test.run: $(TEST_FILE) $(LIBRARY_FILES) $(HEADER_FILES)	\
 		$(UTILITY_PATH)/utility.hpp
-	g++ -std=c++11 $(TEST_FILE) $(INCLUDES) -o $@
+	g++ -std=c++11 $(SW_FLAGS) $(TEST_FILE) $(INCLUDES) -o $@
+
+# The testbench with BIT_ACCURATE defined, using the host types in
+# fixed.hpp in place of the Vivado HLS types
+bit_test: bit_test.log
+bit_test.log: bit_test.run
+	./bit_test.run | tee bit_test.log
+
+bit_test.run: $(TEST_FILE) $(LIBRARY_FILES) $(HEADER_FILES)	\
+		$(UTILITY_PATH)/utility.hpp
+	g++ -std=c++11 -DBIT_ACCURATE $(SW_FLAGS) $(TEST_FILE) $(INCLUDES) -o $@
+
+bench: bench.log
+bench.log: $(BENCH_FILE) $(LIBRARY_FILES) $(HEADER_FILES)	\
+		$(UTILITY_PATH)/utility.hpp
+	@rm -f $@
+	@for len in $(BENCH_LENGTHS); do				\
+		start=$$(date +%s%N);					\
+		g++ -std=c++11 $(BENCH_FLAGS) -DLIST_LENGTH=$$len	\
+			$(BENCH_FILE) $(INCLUDES) -o bench.run || exit 1;	\
+		stop=$$(date +%s%N);					\
+		echo "LIST_LENGTH=$$len compile: $$(((stop - start) / 1000000)) ms" | tee -a $@; \
+		./bench.run | tee -a $@;				\
+	done
+	@rm -f bench.run
 
 csim: csim.log
 csim.log: $(TEST_FILE) $(LIBRARY_FILES) $(HEADER_FILES)	\
@@ -137,8 +186,8 @@ synth.rpt: synth
 	@find synth/*/syn -name "*.rpt" | xargs -I{} grep -H '^|Total' {} >> synth.rpt
 	@find synth/*/syn -name "*.rpt" | xargs -I{} grep -A 10 -H 'Latency' {} >> synth.rpt
 
-.PHONY:clean 
+.PHONY:clean bench
 clean: 
-	rm -rf sw_test.run
+	rm -rf sw_test.run bit_test.run bench.run
 	rm -rf *.log *.rpt
 	rm -rf hls
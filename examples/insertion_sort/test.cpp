@@ -42,11 +42,11 @@
 #define LIST_LENGTH (1<<LOG_LIST_LENGTH)
 
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
+#include "fixed.hpp"
 #endif
 
 #ifdef BIT_ACCURATE
-typedef ap_int<1> last_t;
+typedef hops::intw<1> last_t;
 #else
 typedef bool last_t;
 #endif
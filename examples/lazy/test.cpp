@@ -0,0 +1,276 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include <functional>
+#include "lazy.hpp"
+#include "map.hpp"
+#include "zip.hpp"
+#include "reduce.hpp"
+#include "arrayops.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 32
+
+struct Square{
+	int operator()(int const& V) const{
+#pragma HLS INLINE
+		return V * V;
+	}
+} square;
+
+struct Addone{
+	int operator()(int const& V) const{
+#pragma HLS INLINE
+		return V + 1;
+	}
+} addone;
+
+// -------------------- Pipeline Test --------------------
+std::array<int, LIST_LENGTH>
+pipeline_eager(std::array<int, LIST_LENGTH> const& A,
+	       std::array<int, LIST_LENGTH> const& B){
+	return map(addone, map(square, zipWith(std::plus<int>(), A, B)));
+}
+
+std::array<int, LIST_LENGTH>
+pipeline_lazy_synth(std::array<int, LIST_LENGTH> const& A,
+		    std::array<int, LIST_LENGTH> const& B){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+	return map(addone, map(square, zipWith(std::plus<int>(), lazy(A), B)));
+}
+
+std::array<int, LIST_LENGTH>
+zipwith3_eager(std::array<int, LIST_LENGTH> const& A,
+	       std::array<int, LIST_LENGTH> const& B,
+	       std::array<int, LIST_LENGTH> const& C){
+	return zipWith(std::plus<int>(), A,
+		       zipWith(std::multiplies<int>(), reverse(B), C));
+}
+
+std::array<int, LIST_LENGTH>
+zipwith3_lazy_synth(std::array<int, LIST_LENGTH> const& A,
+		    std::array<int, LIST_LENGTH> const& B,
+		    std::array<int, LIST_LENGTH> const& C){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+	return zipWith(std::plus<int>(), lazy(A),
+		       zipWith(std::multiplies<int>(), reverse(lazy(B)), C));
+}
+
+int pipeline_test(){
+	std::array<int, LIST_LENGTH> a, b, c, output, gold;
+	fill_normal<0>(a);
+	fill_normal<1>(b);
+	fill_normal<2>(c);
+
+	std::cout << "Running pipeline_lazy_synth test... ";
+	gold = pipeline_eager(a, b);
+	output = pipeline_lazy_synth(a, b);
+	if(check(output, gold)){
+		std::cout << "Failed pipeline_lazy_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed pipeline_lazy_synth test!" << std::endl;
+
+	std::cout << "Running zipwith3_lazy_synth test... ";
+	gold = zipwith3_eager(a, b, c);
+	output = zipwith3_lazy_synth(a, b, c);
+	if(check(output, gold)){
+		std::cout << "Failed zipwith3_lazy_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed zipwith3_lazy_synth test!" << std::endl;
+
+	std::cout << "Pipeline Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Pipeline Test --------------------
+
+// -------------------- Permutation Test --------------------
+int permutation_test(){
+	std::array<int, LIST_LENGTH> input, output, gold;
+	std::array<int, LIST_LENGTH - 1> toutput, tgold;
+	fill_normal(input);
+
+	std::cout << "Running lazy reverse test... ";
+	gold = reverse(input);
+	output = reverse(lazy(input));
+	if(check(output, gold)){
+		std::cout << "Failed lazy reverse test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy reverse test!" << std::endl;
+
+	std::cout << "Running lazy rrotate test... ";
+	gold = rrotate(input);
+	output = rrotate(lazy(input));
+	if(check(output, gold)){
+		std::cout << "Failed lazy rrotate test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy rrotate test!" << std::endl;
+
+	std::cout << "Running lazy lrotate test... ";
+	gold = lrotate(input);
+	output = lrotate(lazy(input));
+	if(check(output, gold)){
+		std::cout << "Failed lazy lrotate test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy lrotate test!" << std::endl;
+
+	std::cout << "Running lazy tail test... ";
+	tgold = tail(map(square, rrotate(input)));
+	toutput = tail(map(square, rrotate(lazy(input))));
+	if(check(toutput, tgold)){
+		std::cout << "Failed lazy tail test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy tail test!" << std::endl;
+
+	std::cout << "Permutation Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Permutation Test --------------------
+
+// -------------------- Reduction Test --------------------
+int dot_lazy_synth(std::array<int, LIST_LENGTH> const& A,
+		   std::array<int, LIST_LENGTH> const& B){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+	return treereduce(std::plus<int>(),
+			  zipWith(std::multiplies<int>(), lazy(A), B));
+}
+
+int reduction_test(){
+	std::array<int, LIST_LENGTH> a, b;
+	int output, gold;
+	fill_normal<0>(a);
+	fill_normal<1>(b);
+
+	std::cout << "Running dot_lazy_synth test... ";
+	gold = treereduce(std::plus<int>(), zipWith(std::multiplies<int>(), a, b));
+	output = dot_lazy_synth(a, b);
+	if(output != gold){
+		std::cout << "Failed dot_lazy_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed dot_lazy_synth test!" << std::endl;
+
+	// Subtraction is not associative, so the reduction order
+	// is checked as well
+	std::cout << "Running lazy lreduce test... ";
+	gold = lreduce(std::minus<int>(), 0, map(square, reverse(a)));
+	output = lreduce(std::minus<int>(), 0, map(square, reverse(lazy(a))));
+	if(output != gold){
+		std::cout << "Failed lazy lreduce test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy lreduce test!" << std::endl;
+
+	std::cout << "Running lazy rreduce test... ";
+	gold = rreduce(std::minus<int>(), map(square, reverse(a)), 0);
+	output = rreduce(std::minus<int>(), map(square, reverse(lazy(a))), 0);
+	if(output != gold){
+		std::cout << "Failed lazy rreduce test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy rreduce test!" << std::endl;
+
+	std::cout << "Reduction Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Reduction Test --------------------
+
+// -------------------- Evaluation Test --------------------
+// Counts calls, to check that nothing is computed until the
+// expression is assigned, and that each element is computed once
+struct Count{
+	static int calls;
+	int operator()(int const& V) const{
+		++calls;
+		return V;
+	}
+} count;
+int Count::calls = 0;
+
+int evaluation_test(){
+	std::array<int, LIST_LENGTH> input, output;
+	fill_normal(input);
+
+	std::cout << "Running lazy evaluation test... ";
+	auto expr = map(count, lrotate(map(count, reverse(lazy(input)))));
+	if(Count::calls != 0){
+		std::cout << "Failed lazy evaluation test! Expression was "
+			  << "evaluated before assignment" << std::endl;
+		exit(-1);
+	}
+	output = expr;
+	if(Count::calls != 2 * LIST_LENGTH){
+		std::cout << "Failed lazy evaluation test! Expected "
+			  << 2 * LIST_LENGTH << " calls, got "
+			  << Count::calls << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed lazy evaluation test!" << std::endl;
+
+	std::cout << "Evaluation Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Evaluation Test --------------------
+
+int main(){
+	int err;
+	if((err = pipeline_test())){
+		return err;
+	}
+	if((err = permutation_test())){
+		return err;
+	}
+	if((err = reduction_test())){
+		return err;
+	}
+	if((err = evaluation_test())){
+		return err;
+	}
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
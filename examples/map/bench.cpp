@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include "map.hpp"
+#include "utility.hpp"
+
+// LIST_LENGTH is set by the bench rule in include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 64
+#endif
+#define BENCH_ELEMENTS (1<<26)
+#define BENCH_ITERATIONS (BENCH_ELEMENTS/LIST_LENGTH)
+
+struct Affine{
+	int operator()(int const& V) const{
+		return 3*V + 1;
+	}
+} affine;
+
+int main(){
+	std::array<int, LIST_LENGTH> hop, loop, gold;
+	double hop_ns, loop_ns;
+
+	fill_normal(gold);
+	hop = gold;
+	loop = gold;
+
+	// Each iteration consumes the result of the previous iteration
+	hop_ns = bench_ns([&hop](){
+			hop = hops::map(affine, hop);
+		}, BENCH_ITERATIONS);
+	loop_ns = bench_ns([&loop](){
+			loop = hops::loop::map(affine, loop);
+		}, BENCH_ITERATIONS);
+
+	if(check(hop, loop)){
+		std::cerr << "Failed map benchmark! hops::map and "
+			  << "hops::loop::map results differ" << std::endl;
+		return -1;
+	}
+
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH
+		  << " hops::map: " << hop_ns << " ns/call, "
+		  << "hops::loop::map: " << loop_ns << " ns/call" << std::endl;
+	return 0;
+}
@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include <functional>
+#include "mapreduce.hpp"
+#include "reduce.hpp"
+#include "zip.hpp"
+#include "utility.hpp"
+
+// LIST_LENGTH is set by the bench rule in include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 64
+#endif
+#define BENCH_ELEMENTS (1<<26)
+#define BENCH_ITERATIONS (BENCH_ELEMENTS/LIST_LENGTH)
+
+typedef std::array<int, LIST_LENGTH> vec;
+
+// Runs one dot product implementation. Each iteration feeds part of
+// its result back into the input so that the calls cannot be hoisted.
+template <class FN>
+double dot_ns(FN const& F, vec A, vec const& B, int& RESULT){
+	return bench_ns([&](){
+			RESULT = F(A, B);
+			A[0] = RESULT & 15;
+		}, BENCH_ITERATIONS);
+}
+
+struct Unfused{
+	int operator()(vec const& A, vec const& B) const{
+		return hops::treereduce(std::plus<int>(),
+					hops::zipWith(std::multiplies<int>(), A, B));
+	}
+};
+
+struct FusedChain{
+	int operator()(vec const& A, vec const& B) const{
+		return hops::mapreduce(std::multiplies<int>(), std::plus<int>(), 0, A, B);
+	}
+};
+
+struct FusedTree{
+	int operator()(vec const& A, vec const& B) const{
+		return hops::Mapreduce<hops::Tree>()(std::multiplies<int>(),
+						std::plus<int>(), 0, A, B);
+	}
+};
+
+int main(){
+	vec a, b;
+	int unfused, chain, tree;
+	double unfused_ns, chain_ns, tree_ns;
+
+	fill_normal(a);
+	fill_normal<7>(b);
+
+	unfused_ns = dot_ns(Unfused(), a, b, unfused);
+	chain_ns = dot_ns(FusedChain(), a, b, chain);
+	tree_ns = dot_ns(FusedTree(), a, b, tree);
+
+	if(unfused != chain || unfused != tree){
+		std::cerr << "Failed mapreduce benchmark! Results differ" << std::endl;
+		return -1;
+	}
+
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH
+		  << " treereduce(zipWith): " << unfused_ns << " ns/call, "
+		  << "mapreduce<Chain>: " << chain_ns << " ns/call, "
+		  << "mapreduce<Tree>: " << tree_ns << " ns/call" << std::endl;
+	return 0;
+}
@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include <functional>
+#include "mapreduce.hpp"
+#include "arrayops.hpp"
+#include "reduce.hpp"
+#include "zip.hpp"
+#include "map.hpp"
+#include "lazy.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 16
+#define ODD_LIST_LENGTH 13
+
+// -------------------- Dot Product Test --------------------
+int dot_chain_hop_synth(std::array<int, LIST_LENGTH> const& A,
+			std::array<int, LIST_LENGTH> const& B){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+	return mapreduce(std::multiplies<int>(), std::plus<int>(), 0, A, B);
+}
+
+int dot_tree_hop_synth(std::array<int, LIST_LENGTH> const& A,
+		std::array<int, LIST_LENGTH> const& B){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+	return Mapreduce<Tree>()(std::multiplies<int>(), std::plus<int>(), 0, A, B);
+}
+
+template <std::size_t LEN>
+int dot_test(){
+	std::array<int, LEN> a, b;
+	int gold, output;
+	fill_normal(a);
+	fill_normal<7>(b);
+	gold = rreduce(std::plus<int>(), zipWith(std::multiplies<int>(), a, b), 0);
+
+	std::cout << "Running " << LEN << "-element dot product tests... ";
+	output = mapreduce(std::multiplies<int>(), std::plus<int>(), 0, a, b);
+	if(output != gold){
+		std::cout << "Failed Chain! Output: " << output
+			  << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	output = Mapreduce<Tree>()(std::multiplies<int>(), std::plus<int>(), 0, a, b);
+	if(output != gold){
+		std::cout << "Failed Tree! Output: " << output
+			  << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+int dot_synth_test(){
+	std::array<int, LIST_LENGTH> a, b;
+	int gold, output;
+	fill_normal(a);
+	fill_normal<7>(b);
+	gold = rreduce(std::plus<int>(), zipWith(std::multiplies<int>(), a, b), 0);
+
+	std::cout << "Running dot_chain_hop_synth test... ";
+	output = dot_chain_hop_synth(a, b);
+	if(output != gold){
+		std::cout << "Failed dot_chain_hop_synth test! Output: "
+			  << output << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed dot_chain_hop_synth test!" << std::endl;
+
+	std::cout << "Running dot_tree_hop_synth test... ";
+	output = dot_tree_hop_synth(a, b);
+	if(output != gold){
+		std::cout << "Failed dot_tree_hop_synth test! Output: "
+			  << output << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed dot_tree_hop_synth test!" << std::endl;
+
+	dot_test<1>();
+	dot_test<ODD_LIST_LENGTH>();
+	dot_test<100>();
+	std::cout << "Dot Product Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Dot Product Test --------------------
+
+// -------------------- Arity Test --------------------
+struct Square{
+	int operator()(int const& V) const{
+		return V * V;
+	}
+} square;
+
+struct Fma{
+	int operator()(int const& A, int const& B, int const& C) const{
+		return A * B + C;
+	}
+} fma3;
+
+// Not associative: checks that Chain reduces from left to right
+struct Digits{
+	long operator()(long const& ACC, int const& V) const{
+		return ACC * 3 + V;
+	}
+} digits;
+
+int arity_test(){
+	std::array<int, ODD_LIST_LENGTH> a, b, c;
+	fill_normal(a);
+	fill_normal<7>(b);
+	fill_normal<13>(c);
+
+	std::cout << "Running one-array mapreduce test... ";
+	int sq = lreduce(std::plus<int>(), 0, map(square, a));
+	if(mapreduce(square, std::plus<int>(), 0, a) != sq ||
+		Mapreduce<Tree>()(square, std::plus<int>(), 0, a) != sq){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running three-array mapreduce test... ";
+	int f = lreduce(std::plus<int>(), 0, zipWith(fma3, a, b, c));
+	if(mapreduce(fma3, std::plus<int>(), 0, a, b, c) != f ||
+		Mapreduce<Tree>()(fma3, std::plus<int>(), 0, a, b, c) != f){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running lazy mapreduce test... ";
+	if(mapreduce(fma3, std::plus<int>(), 0, lazy(a), b, lazy(c)) != f ||
+		Mapreduce<Tree>()(fma3, std::plus<int>(), 0, a, lazy(b), c) != f){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running left-to-right Chain test... ";
+	std::array<int, 8> d = {{1, 0, 2, 1, 1, 0, 2, 2}};
+	long gold = 0;
+	for(std::size_t i = 0; i < d.size(); ++i){
+		gold = gold * 3 + d[i] * d[i];
+	}
+	if(mapreduce(square, digits, 0L, d) != gold){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Arity Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Arity Test --------------------
+
+int main(){
+	dot_synth_test();
+	arity_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
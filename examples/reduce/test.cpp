@@ -41,16 +41,20 @@
 #include "arrayops.hpp"
 #include "utility.hpp"
 #include "zip.hpp"
+#include "map.hpp"
 #include "functools.hpp"
 
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
+#include "fixed.hpp"
 #endif
 
 using namespace hops;
 #define MULTCONST 35
 #define LOG_LIST_LENGTH 4
 #define LIST_LENGTH (1<<LOG_LIST_LENGTH)
+#define TREE_LIST_LENGTH 13
+#define LARGE_LIST_LENGTH 65536
+#define ODD_LIST_LENGTH 1000
 
 // -------------------- Min Test --------------------
 int minleft_hop_synth(std::array<int, LIST_LENGTH> const& IN){
@@ -155,6 +159,66 @@ float sum_test(){
 }
 // -------------------- End Sum Test --------------------
 
+// -------------------- Tree Test --------------------
+float sumtree_hop_synth(std::array<float, LIST_LENGTH> const& IN){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS PIPELINE
+	return treereduce(std::plus<float>(), IN);
+}
+
+int mintree_hop_synth(std::array<int, TREE_LIST_LENGTH> const& IN){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS PIPELINE
+	auto lambdamin = [](int const& L, int const& R){
+#pragma HLS INLINE
+		return L < R ? L : R;
+	};
+	return treereduce(lambdamin, IN);
+}
+
+int tree_test(){
+	std::array<float, LIST_LENGTH> input;
+	std::array<int, TREE_LIST_LENGTH> oddinput;
+	float output, gold = 0;
+	int oddoutput, oddgold;
+
+	fill_normal(input);
+	fill_normal(oddinput);
+
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		gold += input[i];
+	}
+
+	oddgold = oddinput[0];
+	for(int i = 1; i < TREE_LIST_LENGTH; ++i){
+		if(oddgold > oddinput[i]){
+			oddgold = oddinput[i];
+		}
+	}
+
+	std::cout << "Running sumtree_hop_synth test... ";
+	output = sumtree_hop_synth(input);
+	if(std::abs(output - gold) > .1){
+		std::cout << "Failed sumtree_hop_synth test! Output: "
+			  << output << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed sumtree_hop_synth test!" << std::endl;
+
+	std::cout << "Running mintree_hop_synth test... ";
+	oddoutput = mintree_hop_synth(oddinput);
+	if(oddoutput != oddgold){
+		std::cout << "Failed mintree_hop_synth test! Output: "
+			  << oddoutput << ", Gold: " << oddgold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed mintree_hop_synth test!" << std::endl;
+
+	std::cout << "Tree Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Tree Test --------------------
+
 // -------------------- Transform Test --------------------
 struct Transform{
 	template<class FN, typename TA, typename TI, std::size_t LEN>
@@ -317,13 +381,108 @@ int interleave_test(){
 
 // -------------------- End Interleave Test --------------------
 
+// -------------------- Large Array Test --------------------
+// These tests are not synthesized. They check that lreduce, rreduce,
+// map and zipWith compile for long arrays at the default template
+// depth, and that lreduce and rreduce still apply the function in
+// order. Horner is not associative, so any reordering is detected.
+struct HornerLeft{
+	unsigned int operator()(unsigned int const& ACC, unsigned int const& X) const{
+#pragma HLS INLINE
+		return ACC * 3 + X;
+	}
+};
+
+struct HornerRight{
+	unsigned int operator()(unsigned int const& X, unsigned int const& ACC) const{
+#pragma HLS INLINE
+		return ACC * 3 + X;
+	}
+};
+
+struct Scale{
+	unsigned int operator()(unsigned int const& X) const{
+#pragma HLS INLINE
+		return X * MULTCONST;
+	}
+};
+
+template <std::size_t LEN>
+int large_test(std::array<unsigned int, LEN> const& input){
+	std::array<unsigned int, LEN> mapped, mgold, zipped, zgold;
+	unsigned int output, lgold = 0, rgold = 0;
+
+	for(std::size_t i = 0; i < LEN; ++i){
+		lgold = lgold * 3 + input[i];
+		rgold = rgold * 3 + input[LEN - 1 - i];
+		mgold[i] = input[i] * MULTCONST;
+		zgold[i] = input[i] + mgold[i];
+	}
+
+	std::cout << "Running large lreduce test (" << LEN << ")... ";
+	output = lreduce(HornerLeft(), 0u, input);
+	if(output != lgold){
+		std::cout << "Failed large lreduce test! Output: "
+			  << output << ", Gold: " << lgold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed large lreduce test!" << std::endl;
+
+	std::cout << "Running large rreduce test (" << LEN << ")... ";
+	output = rreduce(HornerRight(), input, 0u);
+	if(output != rgold){
+		std::cout << "Failed large rreduce test! Output: "
+			  << output << ", Gold: " << rgold << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed large rreduce test!" << std::endl;
+
+	std::cout << "Running large map test (" << LEN << ")... ";
+	mapped = map(Scale(), input);
+	if(check(mapped, mgold)){
+		std::cout << "Failed large map test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed large map test!" << std::endl;
+
+	std::cout << "Running large zipWith test (" << LEN << ")... ";
+	zipped = zipWith(std::plus<unsigned int>(), input, mapped);
+	if(check(zipped, zgold)){
+		std::cout << "Failed large zipWith test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed large zipWith test!" << std::endl;
+	return 0;
+}
+
+int large_test(){
+	static std::array<unsigned int, LARGE_LIST_LENGTH> large;
+	static std::array<unsigned int, ODD_LIST_LENGTH> odd;
+
+	for(std::size_t i = 0; i < LARGE_LIST_LENGTH; ++i){
+		large[i] = (i * 2654435761u) >> 7;
+	}
+	for(std::size_t i = 0; i < ODD_LIST_LENGTH; ++i){
+		odd[i] = large[i];
+	}
+
+	large_test(large);
+	large_test(odd);
+
+	std::cout << "Large Array Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Large Array Test --------------------
+
 int main(){
 	int err;
 	min_test();
 	sum_test();
+	tree_test();
 	trans_test();
 	reverse_test();
 	interleave_test();
+	large_test();
 	std::cout << "Tests passed!" << std::endl;
 	return 0;	
 }
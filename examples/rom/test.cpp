@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <iostream>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include "rom.hpp"
+#include "map.hpp"
+#include "utility.hpp"
+
+#define LOG_LIST_LENGTH 4
+#define LIST_LENGTH (1<<LOG_LIST_LENGTH)
+#define SINE_LENGTH 256
+
+struct Square{
+	constexpr int operator()(std::size_t IDX) const{
+		return IDX * IDX;
+	}
+};
+
+// A quarter-wave of sine, for angles in [0, pi/2)
+struct Sine{
+	constexpr float operator()(std::size_t IDX) const{
+		return hops::sine(M_PI * IDX / (2 * SINE_LENGTH));
+	}
+};
+
+// The table is computed while compiling
+static_assert(hops::Rom<Square, LIST_LENGTH>::table.size() == LIST_LENGTH,
+	"Rom<GEN, N> has N elements");
+static_assert(std::is_same<hops::Rom<Sine, SINE_LENGTH>::value_type, float>::value,
+	"The elements of Rom<GEN, N> have the type returned by GEN");
+
+struct Lookup{
+	int operator()(int const& X) const{
+#pragma HLS INLINE
+		return hops::rom<Square, LIST_LENGTH>(X);
+	}
+};
+
+std::array<int, LIST_LENGTH> square_rom_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return hops::map(Lookup(), IN);
+}
+
+int test_square(){
+	std::array<int, LIST_LENGTH> in, out;
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		in[i] = LIST_LENGTH - 1 - i;
+	}
+	out = square_rom_synth(in);
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		if(out[i] != in[i] * in[i]){
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int test_sine(){
+	for(std::size_t i = 0; i < SINE_LENGTH; ++i){
+		if(std::abs(hops::rom<Sine, SINE_LENGTH>(i) - sin(M_PI * i / (2 * SINE_LENGTH))) > 1e-7){
+			return -1;
+		}
+	}
+	// sine and cosine are accurate to within a few ulps of double
+	// over several periods
+	for(int i = -1000; i <= 1000; ++i){
+		double x = i / 64.0;
+		if(std::abs(hops::sine(x) - sin(x)) > 1e-14 ||
+		   std::abs(hops::cosine(x) - cos(x)) > 1e-14){
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int main(){
+	int err;
+	std::cout << "Running rom lookup test... ";
+	err = test_square();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running constexpr sine and cosine test... ";
+	err = test_sine();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
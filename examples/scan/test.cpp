@@ -0,0 +1,210 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include <functional>
+#include <utility>
+#include "scan.hpp"
+#include "arrayops.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 16
+#define ODD_LIST_LENGTH 13
+
+// Affine functions x -> m*x + c stored as (m, c). Composition is
+// associative, but not commutative, so it checks that every topology
+// preserves the order of the arguments to F.
+typedef std::pair<int, int> affine;
+struct Compose{
+	affine operator()(affine const& F, affine const& G) const{
+#pragma HLS INLINE
+		return affine(G.first * F.first, G.first * F.second + G.second);
+	}
+} affine_compose;
+
+template <typename T, std::size_t LEN, class FN>
+std::array<T, LEN> lscan_gold(FN const& F, std::array<T, LEN> const& IN){
+	std::array<T, LEN> OUT;
+	OUT[0] = IN[0];
+	for(std::size_t i = 1; i < LEN; ++i){
+		OUT[i] = F(OUT[i - 1], IN[i]);
+	}
+	return OUT;
+}
+
+template <typename T, std::size_t LEN, class FN>
+std::array<T, LEN> rscan_gold(FN const& F, std::array<T, LEN> const& IN){
+	std::array<T, LEN> OUT;
+	OUT[LEN - 1] = IN[LEN - 1];
+	for(std::size_t i = LEN - 1; i > 0; --i){
+		OUT[i - 1] = F(IN[i - 1], OUT[i]);
+	}
+	return OUT;
+}
+
+template <std::size_t LEN>
+std::array<affine, LEN> affine_input(){
+	std::array<int, LEN> in;
+	std::array<affine, LEN> out;
+	fill_normal(in);
+	for(std::size_t i = 0; i < LEN; ++i){
+		out[i] = affine(in[i] < 0 ? -1 : 1, in[i]);
+	}
+	return out;
+}
+
+// -------------------- Sklansky Test --------------------
+std::array<int, LIST_LENGTH> lsum_sklansky_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return Lscan<Sklansky>()(std::plus<int>(), IN);
+}
+
+std::array<int, LIST_LENGTH> rsum_sklansky_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return Rscan<Sklansky>()(std::plus<int>(), IN);
+}
+// -------------------- End Sklansky Test --------------------
+
+// -------------------- Kogge-Stone Test --------------------
+std::array<int, LIST_LENGTH> lsum_koggestone_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return Lscan<KoggeStone>()(std::plus<int>(), IN);
+}
+
+std::array<int, LIST_LENGTH> rsum_koggestone_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return Rscan<KoggeStone>()(std::plus<int>(), IN);
+}
+// -------------------- End Kogge-Stone Test --------------------
+
+// -------------------- Brent-Kung Test --------------------
+std::array<int, LIST_LENGTH> lsum_brentkung_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return Lscan<BrentKung>()(std::plus<int>(), IN);
+}
+
+std::array<int, LIST_LENGTH> rsum_brentkung_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return Rscan<BrentKung>()(std::plus<int>(), IN);
+}
+// -------------------- End Brent-Kung Test --------------------
+
+// Checks one synthesizable function against the sequential gold model
+template <std::size_t LEN>
+int sum_test(const char * name,
+	std::array<int, LEN> (*FN)(std::array<int, LEN> const&),
+	std::array<int, LEN> (*GOLD)(std::plus<int> const&,
+				std::array<int, LEN> const&)){
+	std::array<int, LEN> input, output, gold;
+	fill_normal(input);
+	gold = GOLD(std::plus<int>(), input);
+
+	std::cout << "Running " << name << " test... ";
+	output = FN(input);
+	if(check(output, gold)){
+		std::cout << "Failed " << name << " test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed " << name << " test!" << std::endl;
+	return 0;
+}
+
+// Checks a topology with a non-commutative function at length LEN
+template <class TOPOLOGY, std::size_t LEN>
+int order_test(const char * name){
+	std::array<affine, LEN> input, output, gold;
+	input = affine_input<LEN>();
+
+	std::cout << "Running " << LEN << "-element " << name
+		  << " affine lscan test... ";
+	gold = lscan_gold(affine_compose, input);
+	output = Lscan<TOPOLOGY>()(affine_compose, input);
+	if(check(output, gold)){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running " << LEN << "-element " << name
+		  << " affine rscan test... ";
+	gold = rscan_gold(affine_compose, input);
+	output = Rscan<TOPOLOGY>()(affine_compose, input);
+	if(check(output, gold)){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	return 0;
+}
+
+template <class TOPOLOGY>
+int topology_test(const char * name){
+	order_test<TOPOLOGY, 1>(name);
+	order_test<TOPOLOGY, 2>(name);
+	order_test<TOPOLOGY, ODD_LIST_LENGTH>(name);
+	order_test<TOPOLOGY, LIST_LENGTH>(name);
+	order_test<TOPOLOGY, 100>(name);
+	std::cout << name << " Tests Passed!" << std::endl;
+	return 0;
+}
+
+int main(){
+	sum_test<LIST_LENGTH>("lsum_sklansky_hop_synth", lsum_sklansky_hop_synth,
+			lscan_gold<int, LIST_LENGTH, std::plus<int> >);
+	sum_test<LIST_LENGTH>("rsum_sklansky_hop_synth", rsum_sklansky_hop_synth,
+			rscan_gold<int, LIST_LENGTH, std::plus<int> >);
+	topology_test<Sklansky>("Sklansky");
+
+	sum_test<LIST_LENGTH>("lsum_koggestone_hop_synth", lsum_koggestone_hop_synth,
+			lscan_gold<int, LIST_LENGTH, std::plus<int> >);
+	sum_test<LIST_LENGTH>("rsum_koggestone_hop_synth", rsum_koggestone_hop_synth,
+			rscan_gold<int, LIST_LENGTH, std::plus<int> >);
+	topology_test<KoggeStone>("Kogge-Stone");
+
+	sum_test<LIST_LENGTH>("lsum_brentkung_hop_synth", lsum_brentkung_hop_synth,
+			lscan_gold<int, LIST_LENGTH, std::plus<int> >);
+	sum_test<LIST_LENGTH>("rsum_brentkung_hop_synth", rsum_brentkung_hop_synth,
+			rscan_gold<int, LIST_LENGTH, std::plus<int> >);
+	topology_test<BrentKung>("Brent-Kung");
+
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
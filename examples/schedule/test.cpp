@@ -0,0 +1,306 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <iostream>
+#include <array>
+#include <complex>
+#include <functional>
+#include <map>
+#include <cmath>
+#include "schedule.hpp"
+#include "trace.hpp"
+#include "reduce.hpp"
+#include "bitonic.hpp"
+#include "fft.hpp"
+#include "utility.hpp"
+
+using hops::trace::sym;
+using hops::trace::Graph;
+using hops::trace::Timing;
+using hops::trace::Resources;
+using hops::trace::Schedule;
+using hops::trace::Scheduler;
+
+#define SCHED_LEN 16
+
+// Returns the graph of a 16-element treereduce
+Graph sum_graph(){
+	Graph g;
+	std::array<int, SCHED_LEN> in = {};
+	g.output(hops::treereduce(std::plus<sym<int> >(), g.input(in, "x")), "sum");
+	return g;
+}
+
+Graph bitonic_graph(){
+	Graph g;
+	std::array<int, SCHED_LEN> in = {};
+	g.output(bitonic_sort(g.input(in, "x")), "y");
+	return g;
+}
+
+Graph fft_graph(){
+	Graph g;
+	std::array<std::complex<float>, SCHED_LEN> in = {};
+	g.output(fft(g.input(in, "x")), "y");
+	return g;
+}
+
+// Checks that S respects the dependencies of G, that chains of
+// combinational operators stay within a cycle, and that no more than
+// UNITS[OP] operators OP start in a cycle
+int check(Graph const& G, Timing const& T, Schedule const& S, Resources const& UNITS){
+	std::map<std::string, std::map<std::size_t, std::size_t> > used;
+	for(std::size_t i = 0; i < G.nodes.size(); ++i){
+		hops::trace::Node const& n = G.nodes[i];
+		for(std::size_t a : n.args){
+			if(S.start[i] + 1e-9 < S.ready[a]){
+				std::cout << "Error! Node " << i << " starts before its argument "
+					  << a << " is ready" << std::endl;
+				return -1;
+			}
+		}
+		hops::trace::Delay d = T(n.op);
+		if(!n.args.empty() && d.delay <= S.period &&
+		   S.start[i] + d.delay > (S.cycle(i) + 1) * S.period + 1e-9){
+			std::cout << "Error! Node " << i << " crosses a cycle boundary" << std::endl;
+			return -1;
+		}
+		if(UNITS.count(n.op) && ++used[n.op][S.cycle(i)] > UNITS.at(n.op)){
+			std::cout << "Error! Too many " << n.op << " in cycle " << S.cycle(i) << std::endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+void report(char const * NAME, Schedule const& S){
+	std::cout << "\t" << NAME << " at " << S.period << " ns: latency " << S.latency
+		  << ", II " << S.ii << ", " << S.registers << " registers, "
+		  << S.delay << " ns per cycle" << std::endl;
+}
+
+int test_chain(){
+	Graph g = sum_graph();
+	Timing t;
+	t.set("+", 2.0);
+
+	// Four levels of adders fit in a 10 ns cycle, and the sum is
+	// registered at the output
+	Schedule s = Scheduler(t, 10).asap(g);
+	if(s.latency != 1 || s.ii != 1 || s.registers != 1 || s.delay != 8.0 || check(g, t, s, Resources())){
+		std::cout << "Error! Chained treereduce schedule is wrong" << std::endl;
+		return -1;
+	}
+	report("treereduce", s);
+
+	// Two levels fit in a 5 ns cycle, so the four sums of the
+	// second level are registered
+	s = Scheduler(t, 5).asap(g);
+	if(s.latency != 2 || s.registers != 5 || s.delay != 4.0 || check(g, t, s, Resources())){
+		std::cout << "Error! Pipelined treereduce schedule is wrong" << std::endl;
+		return -1;
+	}
+	report("treereduce", s);
+
+	// Two 2.5 ns adders exactly fill a 5 ns cycle. The second-level
+	// sums are ready on the boundary, but are computed in the first
+	// cycle and still registered, under ASAP and ALAP alike
+	Timing exact;
+	exact.set("+", 2.5);
+	s = Scheduler(exact, 5).asap(g);
+	Schedule late = Scheduler(exact, 5).alap(g);
+	if(s.latency != 2 || s.registers != 5 || s.delay != 5.0 || check(g, exact, s, Resources()) ||
+	   late.latency != 2 || late.registers != 5 || check(g, exact, late, Resources())){
+		std::cout << "Error! Treereduce schedule that fills the period is wrong" << std::endl;
+		return -1;
+	}
+	report("treereduce (exact)", s);
+
+	// A 3 ns adder does not fit in a 2 ns cycle, and occupies two
+	s = Scheduler(Timing().set("+", 3.0), 2).asap(g);
+	if(s.latency != 8 || check(g, t, s, Resources())){
+		std::cout << "Error! Multi-cycle treereduce schedule is wrong" << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int test_alap(){
+	Graph g = fft_graph();
+	Timing t;
+	t.set("+", 1.2).set("-", 1.2).set("*", 2.5, 2);
+	Scheduler sched(t, 4);
+	Schedule early = sched.asap(g);
+	Schedule late = sched.alap(g);
+	if(check(g, t, early, Resources()) || check(g, t, late, Resources())){
+		return -1;
+	}
+	if(early.latency != late.latency){
+		std::cout << "Error! ALAP latency " << late.latency << " does not match ASAP latency "
+			  << early.latency << std::endl;
+		return -1;
+	}
+	// Each stage multiplies (2 cycles), then adds twice (one cycle)
+	if(early.latency != 4 * 3){
+		std::cout << "Error! FFT latency is " << early.latency << std::endl;
+		return -1;
+	}
+	if(early.registers != late.registers){
+		std::cout << "Error! ALAP registers " << late.registers << " do not match ASAP registers "
+			  << early.registers << std::endl;
+		return -1;
+	}
+	std::size_t mobile = 0;
+	for(std::size_t i = 0; i < g.nodes.size(); ++i){
+		if(late.start[i] + 1e-9 < early.start[i]){
+			std::cout << "Error! Node " << i << " starts earlier in the ALAP schedule" << std::endl;
+			return -1;
+		}
+		mobile += (late.cycle(i) > early.cycle(i));
+	}
+	// A longer latency bound moves every operator later
+	Schedule later = sched.alap(g, early.latency + 2);
+	if(check(g, t, later, Resources()) || later.latency != early.latency + 2){
+		std::cout << "Error! ALAP schedule with a longer latency is wrong" << std::endl;
+		return -1;
+	}
+	report("fft (ASAP)", early);
+	report("fft (ALAP)", late);
+	std::cout << "\t" << mobile << " of " << g.size() << " nodes are mobile" << std::endl;
+	return 0;
+}
+
+int test_list(){
+	Graph g = sum_graph();
+	Timing t;
+	t.set("+", 2.0);
+
+	// With one adder, the 15 additions take one cycle each, and a
+	// new sum can start every 15 cycles
+	Resources one = {{"+", 1}};
+	Schedule s = Scheduler(t, 10).list(g, one);
+	if(s.latency != 15 || s.ii != 15 || check(g, t, s, one)){
+		std::cout << "Error! Resource-constrained treereduce schedule is wrong" << std::endl;
+		return -1;
+	}
+	report("treereduce (1 adder)", s);
+
+	// With four adders, the first level takes two cycles
+	Resources four = {{"+", 4}};
+	s = Scheduler(t, 10).list(g, four);
+	if(s.ii != 4 || check(g, t, s, four)){
+		std::cout << "Error! Resource-constrained treereduce schedule is wrong" << std::endl;
+		return -1;
+	}
+	report("treereduce (4 adders)", s);
+
+	// Without limits, list scheduling matches ASAP
+	Schedule free = Scheduler(t, 5).list(g, Resources());
+	Schedule early = Scheduler(t, 5).asap(g);
+	if(free.latency != early.latency || free.registers != early.registers || free.ii != 1){
+		std::cout << "Error! Unconstrained list schedule does not match ASAP" << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int test_explore(){
+	// A compare-and-swap is a comparison and a multiplexer
+	Graph b = bitonic_graph();
+	Timing t;
+	t.set("<=", 1.5).set("select", 0.6);
+	std::size_t stages = BitonicCost<int, SCHED_LEN>::depth;
+	std::size_t previous = 0;
+	for(double period : {10.0, 5.0, 4.0, 2.0}){
+		Schedule s = Scheduler(t, period).asap(b);
+		// Compare-and-swaps are chained (and split between a
+		// comparison and its multiplexers) to fill each cycle.
+		// At worst, each takes a cycle for the comparison and
+		// one for the multiplexers.
+		std::size_t bound = static_cast<std::size_t>(std::ceil(stages * 2.1 / period));
+		if(check(b, t, s, Resources()) || s.latency < bound || s.latency > 2 * stages ||
+		   s.latency < previous || s.delay > period){
+			std::cout << "Error! Bitonic sort schedule at " << period << " ns is wrong" << std::endl;
+			return -1;
+		}
+		previous = s.latency;
+		report("bitonic_sort", s);
+	}
+
+	// Sharing 8 comparators and 16 multiplexers
+	Resources units = {{"<=", 8}, {"select", 16}};
+	Schedule s = Scheduler(t, 4).list(b, units);
+	if(check(b, t, s, units) || s.ii != BitonicCost<int, SCHED_LEN>::ops / 8){
+		std::cout << "Error! Shared bitonic sort schedule is wrong" << std::endl;
+		return -1;
+	}
+	report("bitonic_sort (8 comparators)", s);
+	return 0;
+}
+
+int main(){
+	int err;
+	std::cout << "Running chained schedule test... " << std::endl;
+	err = test_chain();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running ASAP/ALAP schedule test... " << std::endl;
+	err = test_alap();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running list schedule test... " << std::endl;
+	err = test_list();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running design-space exploration test... " << std::endl;
+	err = test_explore();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
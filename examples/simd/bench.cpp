@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include "simd.hpp"
+#include "exec.hpp"
+#include "map.hpp"
+#include "mapreduce.hpp"
+#include "zip.hpp"
+#include "reduce.hpp"
+#include "utility.hpp"
+
+// LIST_LENGTH is set by the bench rule in include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 64
+#endif
+// Elements are in {-1, 0, 1}, so that every accumulated value stays
+// below 2^24 and floating-point results are exact in any order
+#define BENCH_ELEMENTS (1<<22)
+#define BENCH_ITERATIONS (BENCH_ELEMENTS/LIST_LENGTH)
+
+template <int SEED, typename T, std::size_t LEN>
+void fill_unit(std::array<T, LEN>& L){
+	std::array<int, LEN> re;
+	fill_normal<SEED>(re);
+	for(std::size_t i = 0; i < LEN; ++i){
+		L[i] = static_cast<T>(re[i] % 2);
+	}
+}
+
+template <int SEED, std::size_t LEN>
+void fill_unit(std::array<std::complex<float>, LEN>& L){
+	std::array<int, LEN> re, im;
+	fill_normal<SEED>(re);
+	fill_normal<SEED + 1>(im);
+	for(std::size_t i = 0; i < LEN; ++i){
+		L[i] = std::complex<float>(re[i] % 2, im[i] % 2);
+	}
+}
+
+void report(char const* TYPE, char const* FUNCTION, char const* LOOP,
+	double HOP_NS, double LOOP_NS, double SIMD_NS){
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH << " " << TYPE << " "
+		  << FUNCTION << ": hops:: " << HOP_NS << " ns/call, "
+		  << LOOP << ": " << LOOP_NS << " ns/call, "
+		  << "exec::simd: " << SIMD_NS << " ns/call" << std::endl;
+}
+
+template <typename T>
+int bench_type(char const* NAME){
+	typedef std::array<T, LIST_LENGTH> array;
+	array a, b, hop, loop, simd;
+	T hop_acc, loop_acc, simd_acc;
+	double hop_ns, loop_ns, simd_ns;
+	fill_unit<3>(a);
+	fill_unit<5>(b);
+
+	// Each iteration consumes the result of the previous iteration
+	hop = loop = simd = a;
+	hop_ns = bench_ns([&hop](){
+			hop = hops::map(std::negate<T>(), hop);
+		}, BENCH_ITERATIONS);
+	loop_ns = bench_ns([&loop](){
+			loop = hops::loop::map(std::negate<T>(), loop);
+		}, BENCH_ITERATIONS);
+	simd_ns = bench_ns([&simd](){
+			simd = hops::map(hops::exec::simd, std::negate<T>(), simd);
+		}, BENCH_ITERATIONS);
+	if(check(hop, loop) || check(simd, loop)){
+		std::cerr << "Failed " << NAME << " map benchmark! Results differ" << std::endl;
+		return -1;
+	}
+	report(NAME, "map(negate)", "hops::loop::", hop_ns, loop_ns, simd_ns);
+
+	hop = loop = simd = a;
+	hop_ns = bench_ns([&hop, &b](){
+			hop = hops::zipWith(std::plus<T>(), hop, b);
+		}, BENCH_ITERATIONS);
+	loop_ns = bench_ns([&loop, &b](){
+			loop = hops::loop::zipWith(std::plus<T>(), loop, b);
+		}, BENCH_ITERATIONS);
+	simd_ns = bench_ns([&simd, &b](){
+			simd = hops::zipWith(hops::exec::simd, std::plus<T>(), simd, b);
+		}, BENCH_ITERATIONS);
+	if(check(hop, loop) || check(simd, loop)){
+		std::cerr << "Failed " << NAME << " zipWith benchmark! Results differ" << std::endl;
+		return -1;
+	}
+	report(NAME, "zipWith(plus)", "hops::loop::", hop_ns, loop_ns, simd_ns);
+
+	hops::Mapreduce<hops::Tree> fma;
+	hop_acc = loop_acc = simd_acc = T();
+	hop_ns = bench_ns([&](){
+			hop_acc = fma(std::multiplies<T>(), std::plus<T>(), hop_acc, a, b);
+		}, BENCH_ITERATIONS);
+	loop_ns = bench_ns([&](){
+			loop_acc = fma(hops::exec::loop, std::multiplies<T>(), std::plus<T>(), loop_acc, a, b);
+		}, BENCH_ITERATIONS);
+	simd_ns = bench_ns([&](){
+			simd_acc = fma(hops::exec::simd, std::multiplies<T>(), std::plus<T>(), simd_acc, a, b);
+		}, BENCH_ITERATIONS);
+	if(hop_acc != loop_acc || simd_acc != loop_acc){
+		std::cerr << "Failed " << NAME << " mapreduce benchmark! Results differ" << std::endl;
+		return -1;
+	}
+	report(NAME, "Mapreduce<Tree>(multiplies, plus)", "exec::loop", hop_ns, loop_ns, simd_ns);
+
+	hop = loop = simd = a;
+	hop_ns = bench_ns([&hop](){
+			hop[0] = hops::treereduce(std::plus<T>(), hop);
+		}, BENCH_ITERATIONS);
+	loop_ns = bench_ns([&loop](){
+			loop[0] = hops::treereduce(hops::exec::loop, std::plus<T>(), loop);
+		}, BENCH_ITERATIONS);
+	simd_ns = bench_ns([&simd](){
+			simd[0] = hops::treereduce(hops::exec::simd, std::plus<T>(), simd);
+		}, BENCH_ITERATIONS);
+	if(check(hop, loop) || check(simd, loop)){
+		std::cerr << "Failed " << NAME << " treereduce benchmark! Results differ" << std::endl;
+		return -1;
+	}
+	report(NAME, "treereduce(plus)", "exec::loop", hop_ns, loop_ns, simd_ns);
+	return 0;
+}
+
+int main(){
+	if(bench_type<std::int8_t>("int8_t") ||
+		bench_type<std::int16_t>("int16_t") ||
+		bench_type<std::int32_t>("int32_t") ||
+		bench_type<float>("float") ||
+		bench_type<double>("double") ||
+		bench_type<std::complex<float> >("complex<float>")){
+		return -1;
+	}
+	return 0;
+}
@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <functional>
+#include <tuple>
+#include "simd.hpp"
+#include "exec.hpp"
+#include "map.hpp"
+#include "mapreduce.hpp"
+#include "zip.hpp"
+#include "reduce.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 64
+#define ODD_LIST_LENGTH 37
+
+// A function without a SIMD form
+struct Square{
+	template <typename T>
+	T operator()(T const& X) const{
+#pragma HLS INLINE
+		return X * X;
+	}
+};
+
+// A function given a SIMD form by specializing SimdFunction
+struct Axpy{
+	template <typename T>
+	T operator()(T const& X, T const& Y) const{
+#pragma HLS INLINE
+		return X + X + X + Y;
+	}
+};
+
+namespace hops{
+	template <>
+	struct SimdFunction<Axpy>{
+		Axpy f;
+		SimdFunction(Axpy const& F) : f(F){
+		}
+
+		template <class V>
+		V operator()(V const& X, V const& Y) const{
+			return f(X, Y);
+		}
+	};
+}
+
+// Fills L with small integer values, so that every result in these
+// tests is exact, whatever the order of the reduction
+template <int SEED, typename T, std::size_t LEN>
+void fill_small(std::array<T, LEN>& L){
+	std::array<int, LEN> re;
+	fill_normal<SEED>(re);
+	for(std::size_t i = 0; i < LEN; ++i){
+		L[i] = static_cast<T>(re[i] % 8);
+	}
+}
+
+template <int SEED, std::size_t LEN>
+void fill_small(std::array<std::complex<float>, LEN>& L){
+	std::array<int, LEN> re, im;
+	fill_normal<SEED>(re);
+	fill_normal<SEED + 1>(im);
+	for(std::size_t i = 0; i < LEN; ++i){
+		L[i] = std::complex<float>(re[i] % 8, im[i] % 8);
+	}
+}
+
+// -------------------- Dot Product Test --------------------
+int dot_simd_synth(std::array<int, LIST_LENGTH> const& A,
+		std::array<int, LIST_LENGTH> const& B){
+	return Mapreduce<Tree>()(exec::simd, std::multiplies<int>(),
+				std::plus<int>(), 0, A, B);
+}
+
+int dot_test(){
+	std::array<int, LIST_LENGTH> a, b;
+	int gold = 0;
+	fill_small<3>(a);
+	fill_small<5>(b);
+	for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+		gold += a[i] * b[i];
+	}
+
+	std::cout << "Running dot_simd_synth test... ";
+	if(dot_simd_synth(a, b) != gold){
+		std::cerr << "Failed dot_simd_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed dot_simd_synth test!" << std::endl;
+	return 0;
+}
+// -------------------- End Dot Product Test --------------------
+
+// -------------------- Type Test --------------------
+// Compares the simd policy against the loop policy, for arrays of T
+// with LEN elements
+template <typename T, std::size_t LEN>
+int type_test(char const* NAME){
+	std::array<T, LEN> a, b, c, output, gold;
+	fill_small<3>(a);
+	fill_small<5>(b);
+	fill_small<7>(c);
+
+	std::cout << "Running simd " << NAME << " tests (LEN=" << LEN << ")... ";
+
+	gold = map(exec::loop, std::negate<T>(), a);
+	output = map(exec::simd, std::negate<T>(), a);
+	if(check(output, gold)){
+		std::cerr << "Failed simd " << NAME << " map test!" << std::endl;
+		exit(-1);
+	}
+
+	gold = map(exec::loop, Square(), a);
+	output = map(exec::simd, Square(), a);
+	if(check(output, gold)){
+		std::cerr << "Failed simd " << NAME << " fallback map test!" << std::endl;
+		exit(-1);
+	}
+
+	std::array<std::array<T, LEN>, 4> zgold = {{
+			zipWith(exec::loop, std::plus<T>(), a, b),
+			zipWith(exec::loop, std::minus<T>(), a, b),
+			zipWith(exec::loop, std::multiplies<T>(), a, b),
+			zipWith(exec::loop, Axpy(), a, b)}};
+	std::array<std::array<T, LEN>, 4> zout = {{
+			zipWith(exec::simd, std::plus<T>(), a, b),
+			zipWith(exec::simd, std::minus<T>(), a, b),
+			zipWith(exec::simd, std::multiplies<T>(), a, b),
+			zipWith(exec::simd, Axpy(), a, b)}};
+	for(std::size_t i = 0; i < zgold.size(); ++i){
+		if(check(zout[i], zgold[i])){
+			std::cerr << "Failed simd " << NAME << " zipWith test!" << std::endl;
+			exit(-1);
+		}
+	}
+
+	if(treereduce(exec::simd, std::plus<T>(), a) !=
+		treereduce(exec::loop, std::plus<T>(), a)){
+		std::cerr << "Failed simd " << NAME << " treereduce test!" << std::endl;
+		exit(-1);
+	}
+
+	if(mapreduce(exec::simd, std::multiplies<T>(), std::plus<T>(), c[0], a, b) !=
+		mapreduce(exec::loop, std::multiplies<T>(), std::plus<T>(), c[0], a, b) ||
+		Mapreduce<Tree>()(exec::simd, std::multiplies<T>(), std::plus<T>(), c[0], a, b) !=
+		Mapreduce<Tree>()(exec::loop, std::multiplies<T>(), std::plus<T>(), c[0], a, b)){
+		std::cerr << "Failed simd " << NAME << " mapreduce test!" << std::endl;
+		exit(-1);
+	}
+
+	std::cout << "Passed simd " << NAME << " tests!" << std::endl;
+	return 0;
+}
+// -------------------- End Type Test --------------------
+
+// -------------------- Dispatch Test --------------------
+int dispatch_test(){
+	std::cout << "Running simd dispatch test... ";
+#ifdef HOPS_SIMD
+	static_assert(SimdCallable<std::plus<int>, std::tuple<int, int> >::value,
+		      "std::plus<int> should have a SIMD form");
+	static_assert(SimdCallable<std::multiplies<std::complex<float> >,
+		      std::tuple<std::complex<float>, std::complex<float> > >::value,
+		      "std::multiplies<std::complex<float>> should have a SIMD form");
+	static_assert(SimdCallable<Axpy, std::tuple<float, float> >::value,
+		      "Axpy should have a SIMD form");
+#endif
+	// Functions without a SIMD form, types without a SIMD form,
+	// results of a different type, and mixed argument types
+	static_assert(!SimdCallable<Square, std::tuple<int> >::value,
+		      "Square should not have a SIMD form");
+	static_assert(!SimdCallable<std::plus<long double>,
+		      std::tuple<long double, long double> >::value,
+		      "long double should not have a SIMD form");
+	static_assert(!SimdCallable<std::plus<int>,
+		      std::tuple<std::int8_t, std::int8_t> >::value,
+		      "std::plus<int> on int8_t should not be vectorized");
+	static_assert(!SimdCallable<Axpy, std::tuple<float, int> >::value,
+		      "Axpy on float and int should not be vectorized");
+	static_assert(!SimdCallable<std::divides<std::complex<float> >,
+		      std::tuple<std::complex<float>, std::complex<float> > >::value,
+		      "Complex division should not be vectorized");
+
+	std::array<std::complex<float>, ODD_LIST_LENGTH> a, b, output, gold;
+	fill_small<3>(a);
+	fill_small<5>(b);
+	for(std::size_t i = 0; i < ODD_LIST_LENGTH; ++i){
+		b[i] += std::complex<float>(9, 1);
+	}
+	gold = zipWith(exec::loop, std::divides<std::complex<float> >(), a, b);
+	output = zipWith(exec::simd, std::divides<std::complex<float> >(), a, b);
+	if(check(output, gold)){
+		std::cerr << "Failed simd dispatch test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed simd dispatch test!" << std::endl;
+	return 0;
+}
+// -------------------- End Dispatch Test --------------------
+
+int main(){
+	dot_test();
+	type_test<std::int8_t, LIST_LENGTH>("int8_t");
+	type_test<std::int8_t, ODD_LIST_LENGTH>("int8_t");
+	type_test<std::int16_t, LIST_LENGTH>("int16_t");
+	type_test<std::int16_t, ODD_LIST_LENGTH>("int16_t");
+	type_test<std::int32_t, LIST_LENGTH>("int32_t");
+	type_test<std::int32_t, ODD_LIST_LENGTH>("int32_t");
+	type_test<float, LIST_LENGTH>("float");
+	type_test<float, ODD_LIST_LENGTH>("float");
+	type_test<double, LIST_LENGTH>("double");
+	type_test<double, ODD_LIST_LENGTH>("double");
+	type_test<std::complex<float>, LIST_LENGTH>("complex<float>");
+	type_test<std::complex<float>, ODD_LIST_LENGTH>("complex<float>");
+	dispatch_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -46,8 +46,8 @@
 
 typedef char base;
 #ifdef BIT_ACCURATE
-#include "ap_int.h"
-typedef ap_uint<2> hw_base;
+#include "fixed.hpp"
+typedef hops::uintw<2> hw_base;
 #else
 typedef char hw_base;
 #endif
@@ -111,6 +111,9 @@ struct score{
 	char v, e, f;
 };
 
+template <typename T, std::size_t W, std::size_t H>
+using matrix = std::array<std::array<T, W>, H>;
+
 struct sw_ref{
 	hw_base b;
 	bool last;
@@ -41,55 +41,20 @@
 #include "utility.hpp"
 #include "map.hpp"
 
-struct SmithWatermanUnit{
-	// Base, recursive operator
-	score operator()(hw_base const& read,
-			sw_ref const& ref,
-			std::array<std::array<score, SW_HIST>, 1> const& smatrix) const{
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix[0]._M_instance
-		score ret = {0,0,0};
-		return ret;
-	}
-
-	// Recursive operator
-	template <std::size_t IDX>
-	score operator()(hw_base const& read,
-			sw_ref const& ref,
-			std::array<std::array<score, SW_HIST>, IDX> const& smatrix) const{
-#pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix[0]._M_instance
-		score ret;
-		char sigma;
-		if(ref.last){
-#ifdef BIT_ACCURATE
-			ret = {(ap_int<hops::clog2(IDX)+1>)-(IDX),
-			       (ap_int<hops::clog2(IDX)+1>)-(IDX),
-			       (ap_int<hops::clog2(IDX)+1>)-(IDX)};
-#else
-			ret = {(char)-(IDX), (char)-(IDX), (char)-(IDX)};
-#endif
-		}else{
-			sigma = (read == ref.b)? MATCH: -MATCH;
-			ret.e = std::max(smatrix[0][0].v - ALPHA, 
-					smatrix[0][0].e - BETA);
-			ret.f = std::max(smatrix[1][0].v - ALPHA,
-					smatrix[1][0].f - BETA);
-			ret.v = std::max((char)(smatrix[1][1].v + sigma),
-					std::max(ret.e, ret.f));
-		}
-		return ret;
-	}
+// Each PE holds the last SW_HIST scores it computed (most recent
+// first). The PE before it in the chain holds the scores above (UP[0])
+// and diagonally above (UP[1]) the current cell.
+typedef std::array<score, SW_HIST> sw_hist;
 
-	score operator()(std::size_t const& IDX,
+struct SmithWatermanUnit{
+	sw_hist operator()(std::size_t const& IDX,
+			sw_hist const& up,
+			sw_hist const& own,
 			hw_base const& read,
-			sw_ref const& ref,
-			std::array<std::array<score, SW_HIST>, READ_LENGTH> const& smatrix) const{
+			sw_ref const& ref) const{
 #pragma HLS INLINE
-#pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix[0]._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=up._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=own._M_instance
 		score ret;
 		char sigma;
 		if(IDX == 0){
@@ -99,19 +64,21 @@ struct SmithWatermanUnit{
 				ret = {(char)-(IDX+1), (char)-(IDX+1), (char)-(IDX+1)};
 			}else{
 				sigma = (read == ref.b)? MATCH: -MATCH;
-				ret.e = std::max(smatrix[IDX + 0][0].v - ALPHA,
-						smatrix[IDX + 0][0].e - BETA);
-				ret.f = std::max(smatrix[IDX - 1][0].v - ALPHA,
-						smatrix[IDX - 1][0].f - BETA);
-				ret.v = std::max((char)(smatrix[IDX - 1][1].v + sigma),
+				ret.e = std::max(own[0].v - ALPHA,
+						own[0].e - BETA);
+				ret.f = std::max(up[0].v - ALPHA,
+						up[0].f - BETA);
+				ret.v = std::max((char)(up[1].v + sigma),
 						std::max(ret.e, ret.f));
 			}
 		}
-		return ret;
+		return hops::rshift(ret, own);
 	}
-
 } sw_op;
 
+// PE 0 computes the first row, and never reads its predecessor
+static const sw_hist sw_boundary = {};
+
 auto systolic_hop_synth(std::array<hw_base, READ_LENGTH> const& left,
 			std::array<sw_ref, READ_LENGTH> const& top,
 			matrix<score, SW_HIST, READ_LENGTH> const& smatrix)
@@ -121,7 +88,7 @@ auto systolic_hop_synth(std::array<hw_base, READ_LENGTH> const& left,
 #pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix[0]._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=top._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=left._M_instance
-	auto result = systolic(sw_op, left, top, smatrix);
+	auto result = hops::systolic(sw_op, sw_boundary, smatrix, left, top);
 #pragma HLS ARRAY_PARTITION complete VARIABLE=result._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=result[0]._M_instance
 	return result;
@@ -136,7 +103,7 @@ auto systolic_loop_synth(std::array<hw_base, READ_LENGTH> const& left,
 #pragma HLS ARRAY_PARTITION complete VARIABLE=smatrix[0]._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=top._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=left._M_instance
-	return sloop::systolic(sw_op, left, top, smatrix);
+	return hops::loop::systolic(sw_op, sw_boundary, smatrix, left, top);
 }
 
 int test_sw(){
@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include "systolic.hpp"
+#include "arrayops.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 16
+#define CYCLES 40
+
+// -------------------- Shift Register Test --------------------
+struct Shift{
+	int operator()(std::size_t const& IDX, int const& UP, int const& OWN) const{
+#pragma HLS INLINE
+		return UP;
+	}
+} shift;
+
+std::array<int, LIST_LENGTH> shift_hop_synth(int const& IN,
+					std::array<int, LIST_LENGTH> const& STATE){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+	return systolic(shift, IN, STATE);
+}
+
+std::array<int, LIST_LENGTH> shift_loop_synth(int const& IN,
+					std::array<int, LIST_LENGTH> const& STATE){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+	return loop::systolic(shift, IN, STATE);
+}
+
+int shift_test(){
+	std::array<int, CYCLES> input;
+	std::array<int, LIST_LENGTH> hop = {}, lp = {}, gold;
+	fill_normal(input);
+
+	std::cout << "Running shift_hop_synth and shift_loop_synth tests... ";
+	for(std::size_t t = 0; t < CYCLES; ++t){
+		hop = shift_hop_synth(input[t], hop);
+		lp = shift_loop_synth(input[t], lp);
+		for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+			gold[i] = (i <= t) ? input[t - i] : 0;
+		}
+		if(check(hop, gold) || check(lp, gold)){
+			std::cout << "Failed on cycle " << t << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Shift Register Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Shift Register Test --------------------
+
+// -------------------- Multiply-Accumulate Test --------------------
+// Each PE accumulates the product of its weight and the value passing
+// through it, and forwards the value to the next PE. The state is a
+// (value, accumulator) pair.
+typedef std::pair<int, int> mac_t;
+struct Mac{
+	mac_t operator()(std::size_t const& IDX, mac_t const& UP, mac_t const& OWN,
+			int const& WEIGHT) const{
+#pragma HLS INLINE
+		return mac_t(UP.first, OWN.second + UP.first * WEIGHT + (int)IDX);
+	}
+} mac;
+
+std::array<mac_t, LIST_LENGTH> mac_hop_synth(int const& IN,
+					std::array<mac_t, LIST_LENGTH> const& STATE,
+					std::array<int, LIST_LENGTH> const& WEIGHTS){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=WEIGHTS._M_instance
+	return systolic(mac, mac_t(IN, 0), STATE, WEIGHTS);
+}
+
+std::array<mac_t, LIST_LENGTH> mac_loop_synth(int const& IN,
+					std::array<mac_t, LIST_LENGTH> const& STATE,
+					std::array<int, LIST_LENGTH> const& WEIGHTS){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=WEIGHTS._M_instance
+	return loop::systolic(mac, mac_t(IN, 0), STATE, WEIGHTS);
+}
+
+int mac_test(){
+	std::array<int, CYCLES> input;
+	std::array<int, LIST_LENGTH> weights;
+	std::array<mac_t, LIST_LENGTH> hop, lp, gold, prev;
+	fill_normal(input);
+	fill_normal<7>(weights);
+	hop = replicate<LIST_LENGTH>(mac_t(0, 0));
+	lp = gold = hop;
+
+	std::cout << "Running mac_hop_synth and mac_loop_synth tests... ";
+	for(std::size_t t = 0; t < CYCLES; ++t){
+		hop = mac_hop_synth(input[t], hop, weights);
+		lp = mac_loop_synth(input[t], lp, weights);
+		prev = gold;
+		for(std::size_t i = 0; i < LIST_LENGTH; ++i){
+			int up = i ? prev[i - 1].first : input[t];
+			gold[i] = mac_t(up, prev[i].second + up * weights[i] + (int)i);
+		}
+		if(check(hop, gold) || check(lp, gold)){
+			std::cout << "Failed on cycle " << t << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Multiply-Accumulate Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Multiply-Accumulate Test --------------------
+
+int main(){
+	shift_test();
+	mac_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
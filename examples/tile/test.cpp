@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "arrayops.hpp"
+#include "divconq.hpp"
+#include "exec.hpp"
+#include "map.hpp"
+#include "reduce.hpp"
+#include "tile.hpp"
+#include "utility.hpp"
+#include "argmin.hpp"
+
+using namespace hops;
+#define TILE_LENGTH 16
+#define MAX_LENGTH 5003
+
+// -------------------- Argmin Test --------------------
+// Combines the argmins of two tiles, each computed by argmin_hop (see
+// ../argminmax/argmin.hpp). OFF is the index of the first element of
+// the tile that produced R.
+struct GlobalArgmin{
+	std::pair<int, std::size_t> operator()(std::pair<int, std::size_t> const& L,
+					std::pair<int, std::size_t> const& R,
+					std::size_t OFF) const{
+		return (R.first < L.first) ? std::make_pair(R.first, R.second + OFF) : L;
+	}
+} global_argmin;
+
+int argmin_test(std::array<int, MAX_LENGTH> const& IN, std::size_t LEN){
+	dyn::Span<int const> in = dyn::span(IN).subspan(0, LEN);
+	std::pair<int, std::size_t> gold(IN[0], 0), output;
+	for(std::size_t i = 1; i < LEN; ++i){
+		if(IN[i] < gold.first){
+			gold = std::make_pair(IN[i], i);
+		}
+	}
+
+	output = tile<TILE_LENGTH>(argmin_hop<int, TILE_LENGTH>, global_argmin, in);
+	if(output != gold){
+		std::cout << "Failed tiled argmin_hop test at length " << LEN
+			  << "! Output: (" << output.first << ", " << output.second
+			  << "), Gold: (" << gold.first << ", " << gold.second
+			  << ")" << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+// -------------------- End Argmin Test --------------------
+
+// -------------------- Sum Test --------------------
+int sum_hop_synth(std::array<int, TILE_LENGTH> const& IN){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS PIPELINE
+	return treereduce(std::plus<int>(), IN);
+}
+
+int sum_test(std::array<int, MAX_LENGTH> const& IN, std::size_t LEN){
+	dyn::Span<int const> in = dyn::span(IN).subspan(0, LEN);
+	int gold = 0, output;
+	for(std::size_t i = 0; i < LEN; ++i){
+		gold += IN[i];
+	}
+
+	// The elements after the end of the input must not change the sum
+	output = tile<TILE_LENGTH>(sum_hop_synth, std::plus<int>(), in, 0);
+	if(output != gold){
+		std::cout << "Failed tiled sum_hop_synth test at length " << LEN
+			  << "! Output: " << output << ", Gold: " << gold << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+// -------------------- End Sum Test --------------------
+
+// Checks the per-tile results of each policy against the kernel
+// applied to each padded tile
+template <class P>
+int policy_test(const char * name, P const& POLICY,
+		std::array<int, MAX_LENGTH> const& IN, std::size_t LEN){
+	dyn::Span<int const> in = dyn::span(IN).subspan(0, LEN);
+	std::size_t tiles = (LEN + TILE_LENGTH - 1) / TILE_LENGTH;
+	std::vector<int> gold(tiles), output(tiles);
+	for(std::size_t t = 0; t < tiles; ++t){
+		std::array<int, TILE_LENGTH> tl;
+		for(std::size_t i = 0; i < TILE_LENGTH; ++i){
+			tl[i] = (t * TILE_LENGTH + i < LEN) ? IN[t * TILE_LENGTH + i] : 0;
+		}
+		gold[t] = sum_hop_synth(tl);
+	}
+
+	tile<TILE_LENGTH>(POLICY, sum_hop_synth, output, in, 0);
+	if(output != gold){
+		std::cout << "Failed " << name << " tiled sum_hop_synth test at length "
+			  << LEN << "!" << std::endl;
+		exit(-1);
+	}
+	return 0;
+}
+
+int main(){
+	std::array<int, MAX_LENGTH> input;
+	std::size_t lengths[] = {1, 5, TILE_LENGTH - 1, TILE_LENGTH, TILE_LENGTH + 1,
+				 100, 1024, MAX_LENGTH};
+	fill_normal(input);
+
+	std::cout << "Running tiled argmin_hop_synth test... ";
+	for(std::size_t len : lengths){
+		argmin_test(input, len);
+	}
+	std::cout << "Passed tiled argmin_hop_synth test!" << std::endl;
+
+	std::cout << "Running tiled sum_hop_synth test... ";
+	for(std::size_t len : lengths){
+		sum_test(input, len);
+	}
+	std::cout << "Passed tiled sum_hop_synth test!" << std::endl;
+
+	std::cout << "Running per-tile policy tests... ";
+	for(std::size_t len : lengths){
+		policy_test("loop", exec::loop, input, len);
+		policy_test("parallel", exec::Parallel(4, 1), input, len);
+	}
+	std::cout << "Passed per-tile policy tests!" << std::endl;
+
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -0,0 +1,284 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <iostream>
+#include <sstream>
+#include <array>
+#include <complex>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include "trace.hpp"
+#include "reduce.hpp"
+#include "systolic.hpp"
+#include "cost.hpp"
+#include "bitonic.hpp"
+#include "fft.hpp"
+#include "utility.hpp"
+
+using hops::trace::sym;
+using hops::trace::Graph;
+
+#define TRACE_LOG_LEN 4
+#define TRACE_LEN (1<<TRACE_LOG_LEN)
+#define TRACE_PES 4
+
+// Prints the figures of G
+void report(char const * NAME, Graph const& G){
+	std::vector<std::size_t> w = G.widths();
+	std::size_t fanout = 0;
+	for(hops::trace::Node const& n : G.nodes){
+		fanout = std::max(fanout, n.fanout);
+	}
+	std::cout << "\t" << NAME << ": " << G.size() << " nodes, depth " << G.depth()
+		  << ", max fan-out " << fanout << ", widths";
+	for(std::size_t l = 1; l < w.size(); ++l){
+		std::cout << " " << w[l];
+	}
+	std::cout << std::endl;
+}
+
+// A linear-gap Smith-Waterman processing element, templated on its
+// score type. UP holds the scores above (UP[0]) and diagonally above
+// (UP[1]) the current cell, and OWN the scores to its left.
+struct AffinePE{
+	template <typename T>
+	std::array<T, 2> operator()(std::size_t const& IDX, std::array<T, 2> const& UP,
+				std::array<T, 2> const& OWN, T const& SIGMA) const{
+		using hops::select;
+		T gap = T(1), zero = T(0);
+		T diag = UP[1] + SIGMA;
+		T up = UP[0] - gap;
+		T left = OWN[0] - gap;
+		T best = select(up < left, left, up);
+		best = select(best < diag, diag, best);
+		best = select(best < zero, zero, best);
+		return std::array<T, 2>{best, OWN[0]};
+	}
+} affinePE;
+
+int test_treereduce(){
+	Graph g;
+	std::array<int, TRACE_LEN> in;
+	for(std::size_t i = 0; i < TRACE_LEN; ++i){
+		in[i] = i;
+	}
+	auto res = hops::treereduce(std::plus<sym<int> >(), g.input(in, "x"));
+	g.output(res, "sum");
+
+	typedef hops::Cost<hops::Treereduce, std::plus<int>, std::array<int, TRACE_LEN> > C;
+	std::vector<std::size_t> w = g.widths();
+	if(res.value != TRACE_LEN*(TRACE_LEN-1)/2 || g.count("+") != C::ops ||
+	   g.depth() != C::depth || w.size() != TRACE_LOG_LEN + 1){
+		std::cout << "Error! Trace of treereduce does not match its cost" << std::endl;
+		return -1;
+	}
+	for(std::size_t l = 1; l <= TRACE_LOG_LEN; ++l){
+		if(w[l] != (TRACE_LEN >> l)){
+			std::cout << "Error! Level " << l << " of treereduce has "
+				  << w[l] << " nodes" << std::endl;
+			return -1;
+		}
+	}
+	std::vector<std::size_t> path = g.critical_path();
+	if(path.size() != TRACE_LOG_LEN + 1 || g.nodes[path[0]].op != "input" ||
+	   path.back() != g.outputs[0].first){
+		std::cout << "Error! Critical path of treereduce is wrong" << std::endl;
+		return -1;
+	}
+	report("treereduce", g);
+	return 0;
+}
+
+int test_bitonic(){
+	Graph g;
+	std::array<int, TRACE_LEN> in, gold;
+	for(std::size_t i = 0; i < TRACE_LEN; ++i){
+		in[i] = (i * 7 + 3) % TRACE_LEN;
+	}
+	gold = in;
+	std::sort(gold.begin(), gold.end(), std::greater<int>());
+
+	auto res = bitonic_sort(g.input(in, "x"));
+	g.output(res, "y");
+	for(std::size_t i = 0; i < TRACE_LEN; ++i){
+		if(res[i].value != gold[i]){
+			std::cout << "Error! Traced bitonic_sort does not sort" << std::endl;
+			return -1;
+		}
+	}
+
+	// Each compare-and-swap is a comparison followed by two
+	// multiplexers
+	typedef BitonicCost<int, TRACE_LEN> C;
+	if(g.count("<=") != C::ops || g.count("select") != 2 * C::ops ||
+	   g.depth() != 2 * C::depth || g.size() != TRACE_LEN + 3 * C::ops){
+		std::cout << "Error! Trace of bitonic_sort does not match its cost" << std::endl;
+		return -1;
+	}
+
+	// The graph is the same for any input
+	Graph h;
+	std::reverse(in.begin(), in.end());
+	h.output(bitonic_sort(h.input(in, "x")), "y");
+	std::ostringstream gs, hs;
+	g.json(gs);
+	h.json(hs);
+	if(gs.str() != hs.str()){
+		std::cout << "Error! Trace of bitonic_sort depends on its input" << std::endl;
+		return -1;
+	}
+	report("bitonic_sort", g);
+	return 0;
+}
+
+int test_fft(){
+	Graph g;
+	std::array<std::complex<float>, TRACE_LEN> in;
+	for(std::size_t i = 0; i < TRACE_LEN; ++i){
+		in[i] = std::complex<float>(i % 3, (i % 5) - 2.0f);
+	}
+	auto gold = fft(in);
+	auto res = fft(g.input(in, "x"));
+	g.output(res, "y");
+	for(std::size_t i = 0; i < TRACE_LEN; ++i){
+		if(res[i].real().value != gold[i].real() || res[i].imag().value != gold[i].imag()){
+			std::cout << "Error! Traced fft does not match fft" << std::endl;
+			return -1;
+		}
+	}
+
+	// Each butterfly multiplies by a twiddle factor (four
+	// multiplications and two additions) and then adds and
+	// subtracts: three levels per stage
+	typedef FFTCost<float, TRACE_LEN> C;
+	if(g.count("*") != 4 * C::ops || g.count("+") + g.count("-") != 6 * C::ops ||
+	   g.depth() != 3 * C::depth){
+		std::cout << "Error! Trace of fft does not match its cost" << std::endl;
+		return -1;
+	}
+	report("fft", g);
+	return 0;
+}
+
+int test_systolic(){
+	Graph g;
+	std::array<std::array<sym<int>, 2>, TRACE_PES> s = {};
+	std::array<int, TRACE_PES> sigma = {1, -1, 1, 1};
+	auto sigmas = g.input(sigma, "sigma");
+	std::array<sym<int>, 2> boundary = {};
+	for(std::size_t t = 0; t < TRACE_PES; ++t){
+		s = hops::systolic(affinePE, boundary, s, sigmas);
+	}
+	g.output(s, "s");
+
+	// Each PE adds SIGMA once per cycle. The states start as
+	// constants, so the first comparison of each PE is folded in
+	// the first cycle.
+	if(s[TRACE_PES-1][0].value != 2 || g.count("+") != TRACE_PES * TRACE_PES ||
+	   g.count("<") != 3 * g.count("+") - TRACE_PES || g.count("select") != g.count("<")){
+		std::cout << "Error! Trace of systolic is wrong" << std::endl;
+		return -1;
+	}
+	report("systolic", g);
+	return 0;
+}
+
+int test_export(){
+	Graph g;
+	auto x = g.input(std::array<int, 2>{{3, 4}}, "x");
+	sym<int> sq = x[0] * x[0];
+	sym<int> y = sq + x[1] * 2;
+	g.output(y, "y");
+
+	std::ostringstream d, j;
+	g.dot(d);
+	g.json(j);
+	std::string dot = d.str(), json = j.str();
+	if(y.value != 17 || g.size() != 6 || g.depth() != 2 || g.nodes[0].fanout != 2 ||
+	   dot.find("digraph hops {") != 0 || dot.find("n0 -> n2 [label=\"1\"]") == std::string::npos ||
+	   dot.find("label=\"x[1]\\nL0\"") == std::string::npos ||
+	   json.find("\"depth\": 2") == std::string::npos ||
+	   json.find("{\"id\": 5, \"op\": \"+\", \"label\": \"\", \"args\": [2, 4], \"level\": 2, \"fanout\": 1}") == std::string::npos ||
+	   json.find("{\"node\": 5, \"name\": \"y\"}") == std::string::npos){
+		std::cout << "Error! DOT or JSON export is wrong" << std::endl;
+		std::cout << dot << json;
+		return -1;
+	}
+	return 0;
+}
+
+int main(){
+	int err;
+	std::cout << "Running treereduce trace test... " << std::endl;
+	err = test_treereduce();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running bitonic_sort trace test... " << std::endl;
+	err = test_bitonic();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running fft trace test... " << std::endl;
+	err = test_fft();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running systolic trace test... " << std::endl;
+	err = test_systolic();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+
+	std::cout << "Running DOT/JSON export test... ";
+	err = test_export();
+	if(err){
+		std::cout << "Failed!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
@@ -43,6 +43,7 @@
 // FUNCTIONS :
 //       void    fill_normal(std::array<T, LEN>)
 //       int     check(std::array<T, LEN>, std::array<T, LEN>)
+//       double  bench_ns(FN const&, std::size_t)
 //
 // NOTES :
 //        This file requires a compiler implementing the C++11 standard.
@@ -55,6 +56,7 @@
 #include <random>
 #include <algorithm>
 #include <array>
+#include <chrono>
 
 // FUNCTION :
 //       fill_normal
@@ -128,4 +130,38 @@ int check(std::array<T, LEN> &TGT, std::array<T, LEN> &GOLD){
 	}
 	return 0;
 }
+
+// FUNCTION :
+//       bench_ns
+//
+// DESCRIPTION :
+//       Calls a function ITERS times and returns the average
+//       wall-clock time of one call in nanoseconds.
+//
+// PARAMETERS :
+//        FN : class
+//            Typename of the function object to measure. Can be
+//            inferred from the call-site.
+//
+// ARGUMENTS :
+//        F : FN const&
+//            A zero-argument function object. F should write its
+//            result to state that the next call reads, so that the
+//            compiler cannot hoist the work out of the loop.
+//
+//        ITERS : std::size_t
+//            The number of calls to F
+// 
+// RETURNS :
+//        double
+//            The average time of one call to F, in nanoseconds
+template <class FN>
+double bench_ns(FN const& F, std::size_t ITERS){
+	auto start = std::chrono::steady_clock::now();
+	for(std::size_t i = 0; i < ITERS; ++i){
+		F();
+	}
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count() / ITERS;
+}
 #endif // __UTILITY_HPP
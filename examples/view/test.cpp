@@ -0,0 +1,363 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include <functional>
+#include "view.hpp"
+#include "arrayops.hpp"
+#include "divconq.hpp"
+#include "map.hpp"
+#include "zip.hpp"
+#include "reduce.hpp"
+#include "scan.hpp"
+#include "butterfly.hpp"
+#include "systolic.hpp"
+#include "window.hpp"
+#include "mapreduce.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 16
+#define DIVCONQ_LENGTH 1024
+
+// -------------------- Slicing Test --------------------
+int slicing_test(){
+	std::array<int, LIST_LENGTH> input, output, gold;
+	std::array<int, LIST_LENGTH / 2> houtput, hgold;
+	std::array<int, LIST_LENGTH - 1> toutput, tgold;
+	fill_normal(input);
+	auto v = make_view(input);
+
+	std::cout << "Running view split test... ";
+	auto gp = split<5>(input);
+	auto vp = split<5>(v);
+	std::array<int, 5> lout = vp.first;
+	std::array<int, LIST_LENGTH - 5> rout = vp.second;
+	if(check(lout, gp.first) || check(rout, gp.second)){
+		std::cout << "Failed view split test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view split test!" << std::endl;
+
+	std::cout << "Running view reverse and tail test... ";
+	tgold = tail(input);
+	toutput = tail(v);
+	if(check(toutput, tgold)){
+		std::cout << "Failed view tail test!" << std::endl;
+		exit(-1);
+	}
+	gold = reverse(input);
+	output = reverse(v);
+	if(check(output, gold)){
+		std::cout << "Failed view reverse test!" << std::endl;
+		exit(-1);
+	}
+	tgold = reverse(tail(reverse(input)));
+	toutput = reverse(tail(reverse(v)));
+	if(check(toutput, tgold)){
+		std::cout << "Failed view reverse and tail test!" << std::endl;
+		exit(-1);
+	}
+	if(head(reverse(v)) != input[LIST_LENGTH - 1] || head(tail(v)) != input[1]){
+		std::cout << "Failed view head test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view reverse and tail test!" << std::endl;
+
+	std::cout << "Running strided view test... ";
+	for(std::size_t i = 0; i < LIST_LENGTH / 2; ++i){
+		hgold[i] = input[2 * i + 1];
+	}
+	houtput = make_view<1, 2, LIST_LENGTH / 2>(input);
+	if(check(houtput, hgold)){
+		std::cout << "Failed strided view test!" << std::endl;
+		exit(-1);
+	}
+	hgold = reverse(hgold);
+	houtput = reverse(make_view<1, 2, LIST_LENGTH / 2>(input));
+	if(check(houtput, hgold)){
+		std::cout << "Failed reversed strided view test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed strided view test!" << std::endl;
+
+	std::cout << "Slicing Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Slicing Test --------------------
+
+// -------------------- Divconq Test --------------------
+// Counts copies, to check that divconq on a view copies each
+// element once (at the leaves) instead of once per level
+struct Tracked{
+	static int copies;
+	int v;
+	Tracked() : v(0){}
+	Tracked(int v) : v(v){}
+	Tracked(Tracked const& o) : v(o.v){
+		++copies;
+	}
+	Tracked& operator=(Tracked const& o){
+		++copies;
+		v = o.v;
+		return *this;
+	}
+};
+int Tracked::copies = 0;
+
+struct Diff{
+	template <std::size_t LL, std::size_t LR>
+	std::array<Tracked, 1> operator()(std::array<Tracked, LL> const& L,
+					  std::array<Tracked, LR> const& R) const{
+#pragma HLS INLINE
+		return {{Tracked(L[0].v - R[0].v)}};
+	}
+};
+
+std::array<int, DIVCONQ_LENGTH> tin;
+
+struct Min{
+	template <std::size_t LL, std::size_t LR>
+	std::array<int, 1> operator()(std::array<int, LL> const& L,
+				      std::array<int, LR> const& R) const{
+#pragma HLS INLINE
+		return {{L[0] < R[0] ? L[0] : R[0]}};
+	}
+};
+
+// Minimum of the odd-index elements
+int oddmin_view_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return divconq(Min(), make_view<1, 2, LIST_LENGTH / 2>(IN))[0];
+}
+
+int divconq_test(){
+	std::array<Tracked, DIVCONQ_LENGTH> input;
+	fill_normal(tin);
+	for(std::size_t i = 0; i < DIVCONQ_LENGTH; ++i){
+		input[i] = Tracked(tin[i]);
+	}
+
+	std::cout << "Running divconq view test... ";
+	Tracked::copies = 0;
+	int gold = divconq(Diff(), input)[0].v;
+	int acopies = Tracked::copies;
+
+	Tracked::copies = 0;
+	int output = divconq(Diff(), make_view(input))[0].v;
+	int vcopies = Tracked::copies;
+	if(output != gold){
+		std::cout << "Failed divconq view test!" << std::endl;
+		exit(-1);
+	}
+	if(vcopies > DIVCONQ_LENGTH){
+		std::cout << "Failed divconq view test! Expected at most "
+			  << DIVCONQ_LENGTH << " copies, got " << vcopies
+			  << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed divconq view test! (" << vcopies
+		  << " copies, " << acopies << " with arrays)" << std::endl;
+
+	std::cout << "Running oddmin_view_synth test... ";
+	std::array<int, LIST_LENGTH> small;
+	fill_normal(small);
+	int mgold = small[1];
+	for(std::size_t i = 3; i < LIST_LENGTH; i += 2){
+		mgold = small[i] < mgold ? small[i] : mgold;
+	}
+	if(oddmin_view_synth(small) != mgold){
+		std::cout << "Failed oddmin_view_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed oddmin_view_synth test!" << std::endl;
+
+	std::cout << "Divconq Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Divconq Test --------------------
+
+// -------------------- Higher-Order Function Test --------------------
+struct Square{
+	int operator()(int const& V) const{
+#pragma HLS INLINE
+		return V * V;
+	}
+} square;
+
+struct Mix{
+	std::pair<int, int> operator()(std::pair<std::size_t, std::size_t> ctx,
+				       std::pair<int, int> const& IN) const{
+#pragma HLS INLINE
+		return {IN.first + IN.second, IN.first - (int)ctx.first * IN.second};
+	}
+} mix;
+
+struct Shift{
+	int operator()(std::size_t IDX, int const& UP, int const& OWN, int const& IN) const{
+#pragma HLS INLINE
+		return UP + IN;
+	}
+} shift;
+
+struct Sum3{
+	int operator()(std::array<int, 3> const& W) const{
+#pragma HLS INLINE
+		return W[0] + W[1] + W[2];
+	}
+} sum3;
+
+int hof_test(){
+	std::array<int, LIST_LENGTH> input, other, output, gold, rin;
+	fill_normal<0>(input);
+	fill_normal<1>(other);
+	rin = reverse(input);
+	auto rv = reverse(make_view(input));
+
+	std::cout << "Running view map test... ";
+	gold = map(square, rin);
+	output = map(square, rv);
+	if(check(output, gold)){
+		std::cout << "Failed view map test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view map test!" << std::endl;
+
+	std::cout << "Running view zipWith test... ";
+	gold = zipWith(std::minus<int>(), other, rin);
+	output = zipWith(std::minus<int>(), other, rv);
+	if(check(output, gold)){
+		std::cout << "Failed view zipWith test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view zipWith test!" << std::endl;
+
+	std::cout << "Running view reduce test... ";
+	if(lreduce(std::minus<int>(), 0, rv) != lreduce(std::minus<int>(), 0, rin) ||
+	   rreduce(std::minus<int>(), rv, 0) != rreduce(std::minus<int>(), rin, 0) ||
+	   treereduce(std::minus<int>(), rv) != treereduce(std::minus<int>(), rin)){
+		std::cout << "Failed view reduce test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view reduce test!" << std::endl;
+
+	std::cout << "Running view scan test... ";
+	gold = lscan(std::plus<int>(), rin);
+	output = lscan(std::plus<int>(), rv);
+	if(check(output, gold)){
+		std::cout << "Failed view lscan test!" << std::endl;
+		exit(-1);
+	}
+	gold = rscan(std::plus<int>(), rin);
+	output = rscan(std::plus<int>(), rv);
+	if(check(output, gold)){
+		std::cout << "Failed view rscan test!" << std::endl;
+		exit(-1);
+	}
+	gold = Lscan<KoggeStone>()(std::minus<int>(), rin);
+	output = Lscan<KoggeStone>()(std::minus<int>(), rv);
+	if(check(output, gold)){
+		std::cout << "Failed view KoggeStone lscan test!" << std::endl;
+		exit(-1);
+	}
+	gold = Rscan<BrentKung>()(std::minus<int>(), rin);
+	output = Rscan<BrentKung>()(std::minus<int>(), rv);
+	if(check(output, gold)){
+		std::cout << "Failed view BrentKung rscan test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view scan test!" << std::endl;
+
+	std::cout << "Running view butterfly test... ";
+	gold = butterfly(mix, rin);
+	output = butterfly(mix, rv);
+	if(check(output, gold)){
+		std::cout << "Failed view butterfly test!" << std::endl;
+		exit(-1);
+	}
+	gold = rbutterfly(mix, rin);
+	output = rbutterfly(mix, rv);
+	if(check(output, gold)){
+		std::cout << "Failed view rbutterfly test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view butterfly test!" << std::endl;
+
+	std::cout << "Running view systolic test... ";
+	gold = systolic(shift, 1, other, rin);
+	output = systolic(shift, 1, other, rv);
+	if(check(output, gold)){
+		std::cout << "Failed view systolic test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view systolic test!" << std::endl;
+
+	std::cout << "Running view window test... ";
+	std::array<int, LIST_LENGTH - 2> wout, wgold;
+	wgold = window<3>(sum3, rin);
+	wout = window<3>(sum3, rv);
+	if(check(wout, wgold)){
+		std::cout << "Failed view window test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view window test!" << std::endl;
+
+	std::cout << "Running view mapreduce test... ";
+	if(mapreduce(std::multiplies<int>(), std::plus<int>(), 0, rv, other) !=
+	   mapreduce(std::multiplies<int>(), std::plus<int>(), 0, rin, other)){
+		std::cout << "Failed view mapreduce test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed view mapreduce test!" << std::endl;
+
+	std::cout << "Higher-Order Function Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Higher-Order Function Test --------------------
+
+int main(){
+	int err;
+	if((err = slicing_test())){
+		return err;
+	}
+	if((err = divconq_test())){
+		return err;
+	}
+	if((err = hof_test())){
+		return err;
+	}
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
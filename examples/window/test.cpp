@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <functional>
+#include "window.hpp"
+#include "lazy.hpp"
+#include "arrayops.hpp"
+#include "reduce.hpp"
+#include "utility.hpp"
+
+using namespace hops;
+#define LIST_LENGTH 32
+#define AVG_TAPS 4
+#define CONV_TAPS 5
+
+// -------------------- Moving Average Test --------------------
+// W is a std::array in the array form, and a DelayLineView in the
+// stream form; both are indexed from the newest sample
+struct Average{
+	template <class W>
+	int operator()(W const& w) const{
+#pragma HLS INLINE
+		int sum = 0;
+		for(std::size_t i = 0; i < w.size(); ++i){
+#pragma HLS UNROLL
+			sum += w[i];
+		}
+		return sum / (int)w.size();
+	}
+} average;
+
+std::array<int, LIST_LENGTH - AVG_TAPS + 1>
+average_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return window<AVG_TAPS>(average, IN);
+}
+
+std::array<int, LIST_LENGTH - AVG_TAPS + 1>
+average_loop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return loop::window<AVG_TAPS>(average, IN);
+}
+
+int average_stream_synth(int const& IN){
+#pragma HLS PIPELINE
+	static DelayLine<int, AVG_TAPS> line;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=line.line._M_instance
+	return window<AVG_TAPS>(average, line, IN);
+}
+
+int average_test(){
+	std::array<int, LIST_LENGTH> input;
+	std::array<int, LIST_LENGTH - AVG_TAPS + 1> output, gold;
+	fill_normal(input);
+
+	for(std::size_t j = 0; j < LIST_LENGTH - AVG_TAPS + 1; ++j){
+		int sum = 0;
+		for(std::size_t i = 0; i < AVG_TAPS; ++i){
+			sum += input[j + i];
+		}
+		gold[j] = sum / AVG_TAPS;
+	}
+
+	std::cout << "Running average_hop_synth test... ";
+	output = average_hop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed average_hop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed average_hop_synth test!" << std::endl;
+
+	std::cout << "Running average_loop_synth test... ";
+	output = average_loop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed average_loop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed average_loop_synth test!" << std::endl;
+
+	std::cout << "Running average_stream_synth test... ";
+	for(std::size_t t = 0; t < LIST_LENGTH; ++t){
+		int out = average_stream_synth(input[t]);
+		if(t >= AVG_TAPS - 1 && out != gold[t - AVG_TAPS + 1]){
+			std::cout << "Failed average_stream_synth test at sample "
+				  << t << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed average_stream_synth test!" << std::endl;
+
+	std::cout << "Moving Average Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Moving Average Test --------------------
+
+// -------------------- Median Filter Test --------------------
+struct Median3{
+	int operator()(std::array<int, 3> const& W) const{
+#pragma HLS INLINE
+		int lo = std::min(W[0], W[1]), hi = std::max(W[0], W[1]);
+		return std::max(lo, std::min(hi, W[2]));
+	}
+} median3;
+
+std::array<int, LIST_LENGTH - 2>
+median_hop_synth(std::array<int, LIST_LENGTH> const& IN){
+#pragma HLS PIPELINE
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return window<3>(median3, IN);
+}
+
+int median_test(){
+	std::array<int, LIST_LENGTH> input;
+	std::array<int, LIST_LENGTH - 2> output, gold;
+	fill_normal(input);
+
+	for(std::size_t j = 0; j < LIST_LENGTH - 2; ++j){
+		std::array<int, 3> w = {input[j], input[j + 1], input[j + 2]};
+		std::sort(w.begin(), w.end());
+		gold[j] = w[1];
+	}
+
+	std::cout << "Running median_hop_synth test... ";
+	output = median_hop_synth(input);
+	if(check(output, gold)){
+		std::cout << "Failed median_hop_synth test!" << std::endl;
+		exit(-1);
+	}
+	std::cout << "Passed median_hop_synth test!" << std::endl;
+	std::cout << "Median Filter Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Median Filter Test --------------------
+
+// -------------------- Convolution Test --------------------
+// Window element i is the i-th newest sample, so F computes
+// y[n] = sum(C[i] * x[n - i])
+struct Convolve{
+	std::array<int, CONV_TAPS> const& C;
+	Convolve(std::array<int, CONV_TAPS> const& C) : C(C) {}
+	template <class W>
+	int operator()(W const& w) const{
+#pragma HLS INLINE
+		int acc = 0;
+		for(std::size_t i = 0; i < CONV_TAPS; ++i){
+			acc += C[i] * w[i];
+		}
+		return acc;
+	}
+};
+
+int convolve_test(){
+	std::array<int, LIST_LENGTH> input;
+	std::array<int, CONV_TAPS> coeffs = {{1, -2, 3, -4, 5}};
+	std::array<int, LIST_LENGTH - CONV_TAPS + 1> output, gold;
+	DelayLine<int, CONV_TAPS> line;
+	Convolve conv(coeffs);
+	fill_normal(input);
+
+	for(std::size_t j = 0; j < LIST_LENGTH - CONV_TAPS + 1; ++j){
+		std::size_t n = j + CONV_TAPS - 1;
+		gold[j] = 0;
+		for(std::size_t i = 0; i < CONV_TAPS; ++i){
+			gold[j] += coeffs[i] * input[n - i];
+		}
+	}
+
+	std::cout << "Running convolution test... ";
+	output = window<CONV_TAPS>(conv, input);
+	if(check(output, gold)){
+		std::cout << "Failed array convolution!" << std::endl;
+		exit(-1);
+	}
+	output = window<CONV_TAPS>(conv, lazy(input));
+	if(check(output, gold)){
+		std::cout << "Failed lazy convolution!" << std::endl;
+		exit(-1);
+	}
+	for(std::size_t t = 0; t < LIST_LENGTH; ++t){
+		int out = loop::window<CONV_TAPS>(conv, line, input[t]);
+		if(line[0] != input[t] || (t >= CONV_TAPS - 1 &&
+						out != gold[t - CONV_TAPS + 1])){
+			std::cout << "Failed stream convolution at sample "
+				  << t << "!" << std::endl;
+			exit(-1);
+		}
+	}
+	std::cout << "Passed!" << std::endl;
+	std::cout << "Convolution Tests Passed!" << std::endl;
+	return 0;
+}
+// -------------------- End Convolution Test --------------------
+
+int main(){
+	average_test();
+	median_test();
+	convolve_test();
+	std::cout << "Tests passed!" << std::endl;
+	return 0;
+}
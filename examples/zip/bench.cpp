@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <array>
+#include <iostream>
+#include "zip.hpp"
+#include "utility.hpp"
+
+// LIST_LENGTH is set by the bench rule in include.mk
+#ifndef LIST_LENGTH
+#define LIST_LENGTH 64
+#endif
+#define BENCH_ELEMENTS (1<<26)
+#define BENCH_ITERATIONS (BENCH_ELEMENTS/LIST_LENGTH)
+
+struct MulAdd{
+	int operator()(int const& A, int const& B) const{
+		return 3*A + B;
+	}
+} muladd;
+
+int main(){
+	std::array<int, LIST_LENGTH> hop, loop, coeffs;
+	std::pair<std::array<int, LIST_LENGTH>, std::array<int, LIST_LENGTH> > hopxip, loopxip;
+	double hop_ns, loop_ns, hopxip_ns, loopxip_ns;
+
+	fill_normal(hop);
+	fill_normal<7>(coeffs);
+	loop = hop;
+
+	// Each iteration consumes the result of the previous iteration
+	hop_ns = bench_ns([&hop, &coeffs](){
+			hop = hops::zipWith(muladd, hop, coeffs);
+		}, BENCH_ITERATIONS);
+	loop_ns = bench_ns([&loop, &coeffs](){
+			loop = hops::loop::zipWith(muladd, loop, coeffs);
+		}, BENCH_ITERATIONS);
+
+	if(check(hop, loop)){
+		std::cerr << "Failed zipWith benchmark! hops::zipWith and "
+			  << "hops::loop::zipWith results differ" << std::endl;
+		return -1;
+	}
+
+	hopxip = {hop, coeffs};
+	loopxip = {loop, coeffs};
+	hopxip_ns = bench_ns([&hopxip](){
+			hopxip = hops::unzip(hops::zip(hopxip.second, hopxip.first));
+		}, BENCH_ITERATIONS);
+	loopxip_ns = bench_ns([&loopxip](){
+			loopxip = hops::loop::unzip(hops::loop::zip(loopxip.second, loopxip.first));
+		}, BENCH_ITERATIONS);
+
+	if(check(hopxip.first, loopxip.first) || check(hopxip.second, loopxip.second)){
+		std::cerr << "Failed zip/unzip benchmark! hops:: and "
+			  << "hops::loop:: results differ" << std::endl;
+		return -1;
+	}
+
+	std::cout << "LIST_LENGTH=" << LIST_LENGTH
+		  << " hops::zipWith: " << hop_ns << " ns/call, "
+		  << "hops::loop::zipWith: " << loop_ns << " ns/call, "
+		  << "hops::unzip(hops::zip): " << hopxip_ns << " ns/call, "
+		  << "hops::loop::unzip(hops::loop::zip): " << loopxip_ns << " ns/call"
+		  << std::endl;
+	return 0;
+}
@@ -35,6 +35,7 @@
 #include <array>
 #include <iostream>
 #include <functional>
+#include <tuple>
 #include "zip.hpp"
 #include "arrayops.hpp"
 #include "utility.hpp"
@@ -306,12 +307,166 @@ int zipmul_test(){
 }
 // -------------------- End ZipWith (Mul) Test --------------------
 
+// -------------------- Tuple Zip/Unzip Test --------------------
+auto zip3_hop_synth(std::array<int, LIST_LENGTH> const& A,
+		std::array<float, LIST_LENGTH> const& B,
+		std::array<int, LIST_LENGTH> const& C)
+	-> std::array<std::tuple<int, float, int>, LIST_LENGTH> {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+	return zip(A, B, C);
+}
+
+auto zip3_loop_synth(std::array<int, LIST_LENGTH> const& A,
+		std::array<float, LIST_LENGTH> const& B,
+		std::array<int, LIST_LENGTH> const& C)
+	-> std::array<std::tuple<int, float, int>, LIST_LENGTH> {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+	return loop::zip(A, B, C);
+}
+
+auto unzip3_hop_synth(std::array<std::tuple<int, float, int>, LIST_LENGTH> const& IN)
+	-> std::tuple<std::array<int, LIST_LENGTH>, std::array<float, LIST_LENGTH>,
+		      std::array<int, LIST_LENGTH> >{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return unzip(IN);
+}
+
+auto unzip3_loop_synth(std::array<std::tuple<int, float, int>, LIST_LENGTH> const& IN)
+	-> std::tuple<std::array<int, LIST_LENGTH>, std::array<float, LIST_LENGTH>,
+		      std::array<int, LIST_LENGTH> >{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+	return loop::unzip(IN);
+}
+
+int tuple_test(){
+	std::array<int, LIST_LENGTH> ainput, cinput;
+	std::array<float, LIST_LENGTH> binput;
+	std::array<std::tuple<int, float, int>, LIST_LENGTH> output, gold;
+	std::tuple<std::array<int, LIST_LENGTH>, std::array<float, LIST_LENGTH>,
+		   std::array<int, LIST_LENGTH> > unzipped;
+	fill_normal(ainput);
+	fill_normal(binput);
+	fill_normal(cinput);
+
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		gold[i] = std::make_tuple(ainput[i], binput[i], cinput[i]);
+	}
+
+	std::cout << "Running zip3_hop_synth test... ";
+	output = zip3_hop_synth(ainput, binput, cinput);
+	if(check(output, gold)){
+		std::cerr << "Failed zip3_hop_synth test!" << std::endl;
+		return -1;
+	}
+	std::cout << "Passed zip3_hop_synth test!" << std::endl;
+
+	std::cout << "Running zip3_loop_synth test... ";
+	output = zip3_loop_synth(ainput, binput, cinput);
+	if(check(output, gold)){
+		std::cerr << "Failed zip3_loop_synth test!" << std::endl;
+		return -1;
+	}
+	std::cout << "Passed zip3_loop_synth test!" << std::endl;
+
+	std::cout << "Running unzip3_hop_synth test... ";
+	unzipped = unzip3_hop_synth(gold);
+	if(check(std::get<0>(unzipped), ainput) ||
+		check(std::get<1>(unzipped), binput) ||
+		check(std::get<2>(unzipped), cinput)){
+		std::cerr << "Failed unzip3_hop_synth test!" << std::endl;
+		return -1;
+	}
+	std::cout << "Passed unzip3_hop_synth test!" << std::endl;
+
+	std::cout << "Running unzip3_loop_synth test... ";
+	unzipped = unzip3_loop_synth(gold);
+	if(check(std::get<0>(unzipped), ainput) ||
+		check(std::get<1>(unzipped), binput) ||
+		check(std::get<2>(unzipped), cinput)){
+		std::cerr << "Failed unzip3_loop_synth test!" << std::endl;
+		return -1;
+	}
+	std::cout << "Passed unzip3_loop_synth test!" << std::endl;
+
+	std::cout << "Passed Tuple Zip/Unzip Tests!" << std::endl;
+	return 0;
+}
+// -------------------- End Tuple Zip/Unzip Test --------------------
+
+// -------------------- ZipWith (Dot4) Test --------------------
+struct Dot4{
+	int operator()(int a0, int a1, int a2, int a3,
+		int b0, int b1, int b2, int b3) const{
+#pragma HLS INLINE
+		return a0*b0 + a1*b1 + a2*b2 + a3*b3;
+	}
+};
+
+typedef std::array<int, LIST_LENGTH> ilist;
+
+auto zipdot4_hop_synth(ilist const& A0, ilist const& A1, ilist const& A2,
+		ilist const& A3, ilist const& B0, ilist const& B1,
+		ilist const& B2, ilist const& B3)
+	-> ilist{
+	return zipWith(Dot4(), A0, A1, A2, A3, B0, B1, B2, B3);
+}
+
+auto zipdot4_loop_synth(ilist const& A0, ilist const& A1, ilist const& A2,
+		ilist const& A3, ilist const& B0, ilist const& B1,
+		ilist const& B2, ilist const& B3)
+	-> ilist{
+	return loop::zipWith(Dot4(), A0, A1, A2, A3, B0, B1, B2, B3);
+}
+
+int zipdot4_test(){
+	std::array<ilist, 8> inputs;
+	ilist output, gold;
+	for(ilist& in : inputs){
+		fill_normal(in);
+	}
+
+	for(int i = 0; i < LIST_LENGTH; ++i){
+		gold[i] = 0;
+		for(int j = 0; j < 4; ++j){
+			gold[i] += inputs[j][i] * inputs[j + 4][i];
+		}
+	}
+
+	std::cout << "Running zipdot4_hop_synth test... ";
+	output = zipdot4_hop_synth(inputs[0], inputs[1], inputs[2], inputs[3],
+				inputs[4], inputs[5], inputs[6], inputs[7]);
+	if(check(output, gold)){
+		std::cerr << "Failed zipdot4_hop_synth test!" << std::endl;
+		return -1;
+	}
+	std::cout << "Passed zipdot4_hop_synth test!" << std::endl;
+
+	std::cout << "Running zipdot4_loop_synth test... ";
+	output = zipdot4_loop_synth(inputs[0], inputs[1], inputs[2], inputs[3],
+				inputs[4], inputs[5], inputs[6], inputs[7]);
+	if(check(output, gold)){
+		std::cerr << "Failed zipdot4_loop_synth test!" << std::endl;
+		return -1;
+	}
+	std::cout << "Passed zipdot4_loop_synth test!" << std::endl;
+
+	std::cout << "Passed zipWith (Dot4) Tests!" << std::endl;
+	return 0;
+}
+// -------------------- End ZipWith (Dot4) Test --------------------
+
 int main(){
 	zip_test();
 	unzip_test();
+	tuple_test();
 	zipadd_test();
 	zipmul_test();
 	zipdiv_test();
+	zipdot4_test();
 	std::cout << "Tests passed!" << std::endl;
 	return 0;	
 }
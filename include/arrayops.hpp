@@ -43,6 +43,7 @@
 //       
 // NAMESPACES :
 //        hops
+//        hops::dyn
 //
 // PUBLIC MODULES :
 //        Range
@@ -59,12 +60,25 @@
 //        Lshift
 //        Construct
 //
+// PUBLIC TYPES :
+//        index_sequence
+//        make_index_sequence
+//
+// PRIVATE MODULES :
+//        IndexSequenceConcat
+//        IndexSequenceBuilder
+//        BlockExpandHelper
+//        IsLazy
+//        AnyLazy
+//        IsPolicy
+//
 // PUBLIC FUNCTIONS :
 //        log2
 //        clog2
 //        range
 //        replicate
 //        split
+//        evaluate
 //
 // PUBLIC VARIABLES :
 //        reverse (Instance of Reverse)
@@ -84,13 +98,24 @@
 //        This file requires a compiler implementing the C++11
 //        standard.
 //
+//        The hops::dyn namespace defines range, replicate, reverse,
+//        prepend, append, concatenate, split, head, last, tail,
+//        rrotate, rshift, lrotate and lshift on runtime-length
+//        arrays (see span.hpp). Functions that return an array in
+//        the hops namespace write it to a caller-provided output,
+//        OUT, which must not overlap the inputs; split and tail
+//        return Spans of their input.
+//
 // AUTHOR : Dustin Richmond (drichmond)
 //
 // **********************************************************************
 #ifndef __ARRAYOPS_HPP
 #define __ARRAYOPS_HPP
 #include <array>
+#include <type_traits>
+#include <utility>
 #include "functools.hpp"
+#include "span.hpp"
 namespace hops {
 	// FUNCTION :
 	//        log2
@@ -136,6 +161,303 @@ namespace hops {
 		return log2(n) + (n > (1 << log2(n)));
 	}
 
+	// MODULE :
+	//        struct index_sequence
+	// 
+	// DESCRIPTION :
+	//        A compile-time sequence of std::size_t values, carried
+	//        as a template parameter pack. It is used to expand an
+	//        expression over every index of an array in a single
+	//        function without recursion.
+	// 
+	// PARAMETERS :
+	//        IDX : std::size_t...
+	//            The sequence of values
+	//
+	// NOTES :
+	//        This is a C++11 equivalent of the C++14
+	//        std::index_sequence.
+	template <std::size_t... IDX>
+	struct index_sequence{
+		static constexpr std::size_t size(){
+			return sizeof...(IDX);
+		}
+	};
+
+	// MODULE :
+	//        struct IndexSequenceConcat
+	// 
+	// DESCRIPTION :
+	//        Concatenates two index_sequence types, where the
+	//        values in the second sequence are offset by the length
+	//        of the first sequence.
+	// 
+	// PARAMETERS :
+	//        TL : class
+	//            An index_sequence type, the lower indicies
+	//
+	//        TR : class
+	//            An index_sequence type, the upper indicies
+	template <class TL, class TR>
+	struct IndexSequenceConcat;
+
+	template <std::size_t... L, std::size_t... R>
+	struct IndexSequenceConcat<index_sequence<L...>, index_sequence<R...> >{
+		typedef index_sequence<L..., (sizeof...(L) + R)...> type;
+	};
+
+	// MODULE :
+	//        struct IndexSequenceBuilder
+	// 
+	// DESCRIPTION :
+	//        Builds the index_sequence 0, 1, ... LEN-1 by halving LEN,
+	//        so that the template recursion depth is clog2(LEN)
+	//        instead of LEN.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the sequence
+	template <std::size_t LEN>
+	struct IndexSequenceBuilder{
+		typedef typename IndexSequenceConcat<
+			typename IndexSequenceBuilder<LEN/2>::type,
+			typename IndexSequenceBuilder<LEN - LEN/2>::type>::type type;
+	};
+
+	template <>
+	struct IndexSequenceBuilder<0>{
+		typedef index_sequence<> type;
+	};
+
+	template <>
+	struct IndexSequenceBuilder<1>{
+		typedef index_sequence<0> type;
+	};
+
+	// TYPE :
+	//        make_index_sequence
+	// 
+	// DESCRIPTION :
+	//        The index_sequence type 0, 1, ... LEN-1
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the sequence
+	//
+	// EXAMPLE :
+	//        make_index_sequence<4> // index_sequence<0, 1, 2, 3>
+	template <std::size_t LEN>
+	using make_index_sequence = typename IndexSequenceBuilder<LEN>::type;
+
+	// MODULE :
+	//        struct BlockExpandHelper
+	// 
+	// DESCRIPTION :
+	//        Applies a function to the elements at each index of one
+	//        or more arrays, BLOCK indicies at a time. A braced
+	//        initializer with one expression per index (e.g.
+	//        {{F(IN[IDX])...}}) costs the compiler time and memory
+	//        per element, so host-side emulation of arrays with tens
+	//        of thousands of elements becomes impractical. Here a
+	//        single block of BLOCK assignments is instantiated and
+	//        called once per block with a different base index.
+	//
+	//        The struct is also a std::integral_constant that is
+	//        true when LEN is larger than BLOCK. Higher-Order
+	//        Functions pass an instance as a tag to select between
+	//        their braced-initializer implementation and this one.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            Length of the input and output arrays
+	//
+	//        BLOCK : std::size_t
+	//            Number of indicies expanded by one block
+	//
+	// FUNCTIONS :
+	//        auto expand(FN const&, std::array<TS, LEN> const&...)
+	//
+	// NOTES :
+	//        The type of the output elements must be default
+	//        constructible, because the output array is assigned
+	//        after it is declared.
+	template <std::size_t LEN, std::size_t BLOCK = 256>
+	struct BlockExpandHelper
+		: public std::integral_constant<bool, (LEN > BLOCK)>{
+		// FUNCTION :
+		//        expand
+		// 
+		// DESCRIPTION :
+		//        Returns an array where the output at each index
+		//        is the result of F's operator() function applied
+		//        to the values at that index in the input arrays
+		// 
+		// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a class-wrapped function. 
+		//
+		//        TS : typename... (Inferred)
+		//            Types of the the std::array values in
+		//            each input array
+		//
+		// ARGUMENTS : 
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function used to compute an output value
+		//            at each array index
+		//
+		//        IN : std::array<TS, LEN> const&...
+		//            Input arrays whose elements will be
+		//            passed, in order, as the arguments to
+		//            F's operator() function
+		// 
+		// RETURNS : std::array<decltype(F(IN[0]...)), LEN>
+		template<class FN, typename... TS>
+		static auto expand(FN const& F, std::array<TS, LEN> const&... IN)
+			-> std::array<decltype(F(IN[0]...)), LEN>{
+#pragma HLS INLINE
+			std::array<decltype(F(IN[0]...)), LEN> res;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=res._M_instance
+			blocks(F, res, make_index_sequence<LEN/BLOCK>(), IN...);
+			block(F, res, (LEN/BLOCK)*BLOCK,
+				make_index_sequence<LEN%BLOCK>(), IN...);
+			return res;
+		}
+
+	private:
+		// Expands one block per index in the index_sequence
+		template<class FN, typename TR, std::size_t... BIDX, typename... TS>
+		static void blocks(FN const& F, std::array<TR, LEN>& OUT,
+				index_sequence<BIDX...> SEQ,
+				std::array<TS, LEN> const&... IN){
+#pragma HLS INLINE
+			int unused[] = {0, (block(F, OUT, BIDX*BLOCK,
+						make_index_sequence<BLOCK>(), IN...), 0)...};
+			(void)unused;
+		}
+
+		// Assigns OUT[BASE + IDX] for every IDX in the
+		// index_sequence
+		template<class FN, typename TR, std::size_t... IDX, typename... TS>
+		static void block(FN const& F, std::array<TR, LEN>& OUT,
+				std::size_t BASE, index_sequence<IDX...> SEQ,
+				std::array<TS, LEN> const&... IN){
+#pragma HLS INLINE
+			int unused[] = {0, (OUT[BASE + IDX] = at(F, BASE + IDX, IN...), 0)...};
+			(void)unused;
+		}
+
+		// Applies F to the elements at index IDX
+		template<class FN, typename... TS>
+		static auto at(FN const& F, std::size_t IDX,
+			std::array<TS, LEN> const&... IN)
+			-> decltype(F(IN[0]...)) {
+#pragma HLS INLINE
+			return F(IN[IDX]...);
+		}
+	};
+
+	// FUNCTION :
+	//        evaluate
+	// 
+	// DESCRIPTION :
+	//        Returns an array argument unchanged, and evaluates a
+	//        lazy expression or view (see lazy.hpp and view.hpp)
+	//        into an array. Higher-Order Functions that index their
+	//        inputs as std::arrays use it to accept expressions.
+	//
+	// PARAMETERS :
+	//        T : typename (Inferred)
+	//            Type of the elements in the input std::array
+	//
+	//        LEN : std::size_t (Inferred)
+	//            Length of the std::array input argument
+	//
+	//        E : class (Inferred)
+	//            Type of the lazy expression
+	//
+	// ARGUMENTS :
+	//        IN : std::array<T, LEN> const& or E const&
+	//            The input array or expression
+	// 
+	// RETURNS : std::array<T, LEN> const& or E::array_type
+	//            The input array, or the evaluated expression
+	template <typename T, std::size_t LEN>
+	std::array<T, LEN> const& evaluate(std::array<T, LEN> const& IN){
+#pragma HLS INLINE
+		return IN;
+	}
+
+	template <class E>
+	auto evaluate(E const& IN) -> decltype(IN.eval()){
+#pragma HLS INLINE
+		return IN.eval();
+	}
+
+	// MODULE :
+	//        struct IsLazy
+	// 
+	// DESCRIPTION :
+	//        IsLazy<X>::value is true when X is a lazy expression or
+	//        view, identified by its array_type member type.
+	// 
+	// PARAMETERS :
+	//        X : class
+	//            The type to test
+	template <class X, class ARRAY = std::array<int, 0> >
+	struct IsLazy : public std::false_type{
+	};
+
+	template <class X>
+	struct IsLazy<X, typename std::conditional<true, std::array<int, 0>,
+						   typename X::array_type>::type>
+		: public std::true_type{
+	};
+
+	// MODULE :
+	//        struct AnyLazy
+	// 
+	// DESCRIPTION :
+	//        AnyLazy<XS...>::value is true when at least one of XS
+	//        is a lazy expression or view. Higher-Order Functions
+	//        with several array arguments use it to select the
+	//        overload that evaluates its arguments.
+	// 
+	// PARAMETERS :
+	//        XS : class...
+	//            The types to test
+	template <class... XS>
+	struct AnyLazy : public std::false_type{
+	};
+
+	template <class X, class... XS>
+	struct AnyLazy<X, XS...>
+		: public std::integral_constant<bool, IsLazy<X>::value ||
+						AnyLazy<XS...>::value>{
+	};
+
+	// MODULE :
+	//        struct IsPolicy
+	// 
+	// DESCRIPTION :
+	//        IsPolicy<X>::value is true when X is an execution
+	//        policy (see exec.hpp), identified by its policy_type
+	//        member type. Higher-Order Functions use it to select
+	//        the overload that forwards to the policy.
+	// 
+	// PARAMETERS :
+	//        X : class
+	//            The type to test
+	template <class X, class POLICY = void>
+	struct IsPolicy : public std::false_type{
+	};
+
+	template <class X>
+	struct IsPolicy<X, typename std::conditional<true, void,
+						     typename X::policy_type>::type>
+		: public std::true_type{
+	};
+
 	// FUNCTION :
 	//        range
 	// 
@@ -238,6 +560,12 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(E const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        When the input is a lazy expression (see lazy.hpp)
+	//        the result is a lazy expression.
 	struct Reverse{
 		// FUNCTION :
 		//        operator() const
@@ -281,6 +609,21 @@ namespace hops {
 			}
 			return res;
 		}
+
+		template <class E>
+		auto operator()(E const& IN) const
+			-> decltype(IN.reverse()) {
+#pragma HLS INLINE
+			return IN.reverse();
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.reverse(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.reverse(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        reverse (Instance of Reverse)
@@ -303,6 +646,7 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(T const&, std::array<T, LEN> const&) const
+	//        auto operator()(P const&, AS const&...) const
 	struct Prepend{
 		// FUNCTION :
 		//        operator() const
@@ -351,6 +695,14 @@ namespace hops {
 			}
 			return res;
 		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.prepend(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.prepend(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        prepend (Instance of Prepend)
@@ -375,6 +727,7 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&, T const&) const
+	//        auto operator()(P const&, AS const&...) const
 	struct Append{
 		// FUNCTION :
 		//        operator() const
@@ -423,6 +776,14 @@ namespace hops {
 			res[LEN] = V;
 			return res;
 		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.append(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.append(ARGS...);
+		}
 	};	
 	// VARIABLE :
 	//        append (Instance of Append)
@@ -448,6 +809,7 @@ namespace hops {
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LLEN> const&,
 	//                        std::array<T, RLEN> const&) const
+	//        auto operator()(P const&, AS const&...) const
 	struct Concatenate{
 		// FUNCTION :
 		//        operator() const
@@ -506,6 +868,14 @@ namespace hops {
 			}
 			return res;
 		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.concatenate(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.concatenate(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        concatenate (Instance of Concatenate)
@@ -676,6 +1046,14 @@ namespace hops {
 		return {l, r};
 	}
 
+	// When IN is a lazy expression or view, the result is a pair
+	// of expressions that refer to IN, and no elements are copied
+	template<std::size_t IDX, class E>
+	auto split(E const& IN) -> decltype(IN.template split<IDX>()){
+#pragma HLS INLINE
+		return IN.template split<IDX>();
+	}
+
 	// MODULE :
 	//        struct Split
 	//
@@ -690,6 +1068,12 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<std::size_t, T> const&) const
+	//        auto operator()(E const&) const
+	//
+	// NOTES :
+	//        When the input is a lazy expression or view (see
+	//        lazy.hpp and view.hpp) the result is a pair of
+	//        expressions.
 	template<typename std::size_t IDX>
 	struct Split{
 		// FUNCTION :
@@ -742,6 +1126,13 @@ namespace hops {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=temp.second._M_instance
 			return temp;
 		}
+
+		template<class E>
+		auto operator()(E const& IN) const
+			-> decltype(IN.template split<IDX>()) {
+#pragma HLS INLINE
+			return IN.template split<IDX>();
+		}
 	};
 
 	// MODULE :
@@ -753,6 +1144,7 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(E const&) const
 	struct Head{
 		// FUNCTION :
 		//        operator()
@@ -786,6 +1178,12 @@ namespace hops {
 #pragma HLS INLINE
 			return t[0];
 		}
+
+		template<class E>
+		typename E::array_type::value_type operator()(E const& IN) const{
+#pragma HLS INLINE
+			return IN[0];
+		}
 	};
 	// VARIABLE :
 	//        head (Instance of Head)
@@ -935,6 +1333,12 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(E const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        When the input is a lazy expression (see lazy.hpp)
+	//        the result is a lazy expression.
 	struct Tail{
 		// FUNCTION :
 		//        operator()
@@ -978,6 +1382,21 @@ namespace hops {
 			}
 			return res;
 		}
+
+		template <class E>
+		auto operator()(E const& IN) const
+			-> decltype(IN.tail()) {
+#pragma HLS INLINE
+			return IN.tail();
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.tail(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.tail(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        tail (Instance of Tail)
@@ -1001,6 +1420,12 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(E const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        When the input is a lazy expression (see lazy.hpp)
+	//        the result is a lazy expression.
 	struct Rrotate{
 		// FUNCTION :
 		//        operator()
@@ -1039,6 +1464,21 @@ namespace hops {
 #pragma HLS INLINE
 			return uncurry(flip(concatenate))(split<LEN-1>(IN));
 		}
+
+		template <class E>
+		auto operator()(E const& IN) const
+			-> decltype(IN.rrotate()) {
+#pragma HLS INLINE
+			return IN.rrotate();
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.rrotate(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.rrotate(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        rrotate (Instance of Rrotate)
@@ -1061,6 +1501,7 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(P const&, AS const&...) const
 	struct Rshift{
 		// FUNCTION :
 		//        operator()
@@ -1105,6 +1546,14 @@ namespace hops {
 #pragma HLS INLINE
 			return prepend(V, split<LEN-1>(IN).first);
 		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.rshift(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.rshift(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        Rshift (Instance of Rshift)
@@ -1128,6 +1577,7 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(P const&, AS const&...) const
 	struct Lshift{
 		// FUNCTION :
 		//        operator()
@@ -1169,6 +1619,14 @@ namespace hops {
 #pragma HLS INLINE
 			return append(tail(IN), V);
 		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.lshift(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.lshift(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        Lshift (Instance of Lshift)
@@ -1192,6 +1650,12 @@ namespace hops {
 	// 
 	// FUNCTIONS :
 	//        auto operator()(std::array<T, LEN> const&) const
+	//        auto operator()(E const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        When the input is a lazy expression (see lazy.hpp)
+	//        the result is a lazy expression.
 	struct Lrotate{
 		// FUNCTION :
 		//        operator()
@@ -1231,6 +1695,21 @@ namespace hops {
 #pragma HLS INLINE
 			return uncurry(flip(concatenate))(split<1>(IN));
 		}
+
+		template <class E>
+		auto operator()(E const& IN) const
+			-> decltype(IN.lrotate()) {
+#pragma HLS INLINE
+			return IN.lrotate();
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.lrotate(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.lrotate(ARGS...);
+		}
 	};
 	// VARIABLE :
 	//        lrotate (Instance of Lrotate)
@@ -1436,6 +1915,320 @@ namespace hops {
 	//            std::array<int, 2> a;
 	//            a = construct(1, 2); // a === {1, 2}
 	Construct construct;
+
+	namespace dyn{
+		// FUNCTION :
+		//        range
+		// 
+		// DESCRIPTION :
+		//        Writes START, START + STEP, START + 2*STEP, ... to
+		//        the elements of OUT
+		//
+		// RETURNS : Span<T>
+		//        A Span of OUT
+		template <class CO>
+		auto range(CO&& OUT, std::size_t START = 0, std::size_t STEP = 1)
+			-> decltype(span(OUT)){
+			auto out = span(OUT);
+			for(std::size_t i = 0; i < out.size(); ++i){
+				out[i] = START + i * STEP;
+			}
+			return out;
+		}
+
+		// FUNCTION :
+		//        replicate
+		// 
+		// DESCRIPTION :
+		//        Writes V to every element of OUT
+		//
+		// RETURNS : Span<T>
+		//        A Span of OUT
+		template <class CO, typename T>
+		auto replicate(CO&& OUT, T const& V)
+			-> decltype(span(OUT)){
+			auto out = span(OUT);
+			for(std::size_t i = 0; i < out.size(); ++i){
+				out[i] = V;
+			}
+			return out;
+		}
+
+		// MODULE :
+		//        struct Reverse
+		// 
+		// DESCRIPTION :
+		//        Writes the elements of IN to OUT in reverse order.
+		//        OUT has the length of IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, CA const&) const
+		struct Reverse{
+			template <class CO, class CA>
+			auto operator()(CO&& OUT, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				std::size_t const n = out.size();
+				assert(n == IN.size());
+				for(std::size_t i = 0; i < n; ++i){
+					out[i] = IN.data()[n - 1 - i];
+				}
+				return out;
+			}
+		};
+		Reverse reverse;
+
+		// MODULE :
+		//        struct Prepend
+		// 
+		// DESCRIPTION :
+		//        Writes V followed by the elements of IN to OUT.
+		//        OUT has one more element than IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, T const&, CA const&) const
+		struct Prepend{
+			template <class CO, typename T, class CA>
+			auto operator()(CO&& OUT, T const& V, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				assert(out.size() == IN.size() + 1);
+				out[0] = V;
+				for(std::size_t i = 0; i < IN.size(); ++i){
+					out[i + 1] = IN.data()[i];
+				}
+				return out;
+			}
+		};
+		Prepend prepend;
+
+		// MODULE :
+		//        struct Append
+		// 
+		// DESCRIPTION :
+		//        Writes the elements of IN followed by V to OUT.
+		//        OUT has one more element than IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, CA const&, T const&) const
+		struct Append{
+			template <class CO, class CA, typename T>
+			auto operator()(CO&& OUT, CA const& IN, T const& V) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				assert(out.size() == IN.size() + 1);
+				for(std::size_t i = 0; i < IN.size(); ++i){
+					out[i] = IN.data()[i];
+				}
+				out[IN.size()] = V;
+				return out;
+			}
+		};
+		Append append;
+
+		// MODULE :
+		//        struct Concatenate
+		// 
+		// DESCRIPTION :
+		//        Writes the elements of L followed by the elements
+		//        of R to OUT. OUT has the combined length of L and
+		//        R.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, CL const&, CR const&) const
+		struct Concatenate{
+			template <class CO, class CL, class CR>
+			auto operator()(CO&& OUT, CL const& L, CR const& R) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				assert(out.size() == L.size() + R.size());
+				for(std::size_t i = 0; i < L.size(); ++i){
+					out[i] = L.data()[i];
+				}
+				for(std::size_t i = 0; i < R.size(); ++i){
+					out[L.size() + i] = R.data()[i];
+				}
+				return out;
+			}
+		};
+		Concatenate concatenate;
+
+		// FUNCTION :
+		//        split
+		// 
+		// DESCRIPTION :
+		//        Returns Spans of the first IDX elements of IN, and
+		//        of the remaining elements. Nothing is copied.
+		//
+		// EXAMPLE :
+		//        std::vector<int> a(10);
+		//        auto p = dyn::split(a, 4); // p.first.size() === 4
+		template <class CA>
+		auto split(CA&& IN, std::size_t IDX)
+			-> std::pair<decltype(span(IN)), decltype(span(IN))>{
+			auto in = span(IN);
+			return std::make_pair(in.subspan(0, IDX),
+					in.subspan(IDX, in.size() - IDX));
+		}
+
+		// MODULE :
+		//        struct Head
+		// 
+		// DESCRIPTION :
+		//        Returns the first element of IN, which must not
+		//        be empty.
+		// 
+		// FUNCTIONS :
+		//        T operator()(CA const&) const
+		struct Head{
+			template <class CA>
+			auto operator()(CA const& IN) const
+				-> typename std::decay<decltype(IN.data()[0])>::type{
+				assert(IN.size() > 0);
+				return IN.data()[0];
+			}
+		};
+		Head head;
+
+		// MODULE :
+		//        struct Last
+		// 
+		// DESCRIPTION :
+		//        Returns the last element of IN, which must not be
+		//        empty.
+		// 
+		// FUNCTIONS :
+		//        T operator()(CA const&) const
+		struct Last{
+			template <class CA>
+			auto operator()(CA const& IN) const
+				-> typename std::decay<decltype(IN.data()[0])>::type{
+				assert(IN.size() > 0);
+				return IN.data()[IN.size() - 1];
+			}
+		};
+		Last last;
+
+		// MODULE :
+		//        struct Tail
+		// 
+		// DESCRIPTION :
+		//        Returns a Span of all but the first element of IN,
+		//        which must not be empty. Nothing is copied.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CA&&) const
+		struct Tail{
+			template <class CA>
+			auto operator()(CA&& IN) const
+				-> decltype(span(IN)){
+				auto in = span(IN);
+				assert(in.size() > 0);
+				return in.subspan(1, in.size() - 1);
+			}
+		};
+		Tail tail;
+
+		// MODULE :
+		//        struct Rrotate
+		// 
+		// DESCRIPTION :
+		//        Writes the elements of IN to OUT, rotated right by
+		//        one: {IN[N-1], IN[0], ..., IN[N-2]}. OUT has the
+		//        length of IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, CA const&) const
+		struct Rrotate{
+			template <class CO, class CA>
+			auto operator()(CO&& OUT, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				std::size_t const n = out.size();
+				assert(n == IN.size());
+				for(std::size_t i = 0; i < n; ++i){
+					out[(i + 1) % n] = IN.data()[i];
+				}
+				return out;
+			}
+		};
+		Rrotate rrotate;
+
+		// MODULE :
+		//        struct Rshift
+		// 
+		// DESCRIPTION :
+		//        Writes V followed by all but the last element of
+		//        IN to OUT. OUT has the length of IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, T const&, CA const&) const
+		struct Rshift{
+			template <class CO, typename T, class CA>
+			auto operator()(CO&& OUT, T const& V, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				std::size_t const n = out.size();
+				assert(n == IN.size() && n > 0);
+				for(std::size_t i = n - 1; i > 0; --i){
+					out[i] = IN.data()[i - 1];
+				}
+				out[0] = V;
+				return out;
+			}
+		};
+		Rshift rshift;
+
+		// MODULE :
+		//        struct Lrotate
+		// 
+		// DESCRIPTION :
+		//        Writes the elements of IN to OUT, rotated left by
+		//        one: {IN[1], ..., IN[N-1], IN[0]}. OUT has the
+		//        length of IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, CA const&) const
+		struct Lrotate{
+			template <class CO, class CA>
+			auto operator()(CO&& OUT, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				std::size_t const n = out.size();
+				assert(n == IN.size());
+				for(std::size_t i = 0; i < n; ++i){
+					out[i] = IN.data()[(i + 1) % n];
+				}
+				return out;
+			}
+		};
+		Lrotate lrotate;
+
+		// MODULE :
+		//        struct Lshift
+		// 
+		// DESCRIPTION :
+		//        Writes all but the first element of IN followed by
+		//        V to OUT. OUT has the length of IN.
+		// 
+		// FUNCTIONS :
+		//        Span<T> operator()(CO&&, CA const&, T const&) const
+		struct Lshift{
+			template <class CO, class CA, typename T>
+			auto operator()(CO&& OUT, CA const& IN, T const& V) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				std::size_t const n = out.size();
+				assert(n == IN.size() && n > 0);
+				for(std::size_t i = 0; i + 1 < n; ++i){
+					out[i] = IN.data()[i + 1];
+				}
+				out[n - 1] = V;
+				return out;
+			}
+		};
+		Lshift lshift;
+	} // namespace dyn
 } // namespace hops
 #endif // __ARRAYOPS_HPP
 
@@ -0,0 +1,911 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        batch.hpp
+//
+// DESCRIPTION :
+//        This file implements the batch function, which runs one
+//        kernel over many independent problems in lockstep. The
+//        problems are transposed so that each value of the kernel
+//        holds one lane per problem (see Lanes): a kernel on a
+//        32-element array of int is run on a 32-element array of
+//        Lanes<int, B>, and computes B problems at once. The loops
+//        over lanes have a fixed length, B, and are vectorized by
+//        the host compiler, or unrolled into B copies of the
+//        kernel during synthesis.
+//
+//        Kernels that are templated on their element type (like
+//        the Higher-Order Functions in this library) can be run in
+//        lockstep. Other kernels are run once per problem.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Lanes
+//        LanesOf
+//        LaneComplex
+//        Batched
+//        Batch
+// 
+// PRIVATE MODULES :
+//        LaneMask
+//        BatchCallable
+//
+// PUBLIC FUNCTIONS :
+//        select
+//        batch
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        A kernel run in lockstep cannot branch on the value of a
+//        lane. Comparisons of Lanes return a mask of Lanes holding
+//        1 or 0, and select is used in place of the ?: operator.
+//
+//        The problems and their results are held in runtime-length
+//        buffers (dyn::Span, see span.hpp), and batch loops over
+//        them B problems at a time, so only one group of B problems
+//        is transposed at once.
+//
+//        On the host, batch transposes the inputs and results of
+//        each group of B problems. It pays off for kernels that do
+//        much more work than the size of their inputs (e.g. an
+//        FFT), or that cannot be vectorized within one problem.
+//        Inputs that are already transposed can be passed to the
+//        kernel directly, as Batched<T, B>::type.
+//
+//        std::complex<T> problems are transposed to
+//        LaneComplex<T, B>, because the C++ standard only specifies
+//        std::complex for floating-point types. Kernels on complex
+//        values must use the real() and imag() members (rather than
+//        std::real and std::imag) to run in lockstep.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __BATCH_HPP
+#define __BATCH_HPP
+#include <array>
+#include <cassert>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "arrayops.hpp"
+#include "span.hpp"
+namespace hops{
+	// MODULE :
+	//        struct LaneMask
+	// 
+	// DESCRIPTION :
+	//        Defines type, the type of one lane of the result of
+	//        comparing two Lanes<T, B>: a signed integer as wide as
+	//        T when one exists, and bool otherwise. Because the
+	//        mask and the values have the same width, the loops of
+	//        a comparison followed by a select are vectorized
+	//        together.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the value in each lane
+	template <typename T, std::size_t S = sizeof(T)>
+	struct LaneMask{
+		typedef bool type;
+	};
+
+	template <typename T>
+	struct LaneMask<T, 1>{
+		typedef std::int8_t type;
+	};
+
+	template <typename T>
+	struct LaneMask<T, 2>{
+		typedef std::int16_t type;
+	};
+
+	template <typename T>
+	struct LaneMask<T, 4>{
+		typedef std::int32_t type;
+	};
+
+	template <typename T>
+	struct LaneMask<T, 8>{
+		typedef std::int64_t type;
+	};
+
+	// MODULE :
+	//        struct Lanes
+	// 
+	// DESCRIPTION :
+	//        B values of type T, one per problem, that are computed
+	//        in lockstep. The arithmetic, bitwise and comparison
+	//        operators apply to each lane, and a value of type T is
+	//        converted to Lanes by copying it to every lane, so
+	//        that kernel code written for T compiles for Lanes.
+	//        Comparisons return mask, Lanes holding 1 or 0 (see
+	//        LaneMask).
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the value in each lane
+	//
+	//        B : std::size_t
+	//            The number of lanes
+	// 
+	// FUNCTIONS :
+	//        Lanes()
+	//        Lanes(T const&)
+	//        explicit Lanes(Lanes<U, B> const&)
+	//        T& operator[](std::size_t)
+	//        T const& operator[](std::size_t) const
+	//        Lanes& operator+=(Lanes const&) (and -=, *=, /=)
+	//        Lanes operator+(Lanes const&, Lanes const&) (and -,
+	//                  *, /, %, &, |, ^, <<, >>)
+	//        Lanes operator-(Lanes const&) (and ~)
+	//        mask operator<(Lanes const&, Lanes const&)
+	//                  (and >, <=, >=, ==, !=, &&, ||)
+	//        mask operator!(Lanes const&)
+	//
+	// NOTES :
+	//        && and || evaluate both operands.
+	template <typename T, std::size_t B>
+	struct Lanes{
+		typedef Lanes<typename LaneMask<T>::type, B> mask;
+
+		std::array<T, B> lane;
+
+		Lanes() : lane(){
+#pragma HLS INLINE
+		}
+
+		Lanes(T const& V){
+#pragma HLS INLINE
+			lane.fill(V);
+		}
+
+		// Converts each lane of IN to T
+		template <typename U>
+		explicit Lanes(Lanes<U, B> const& IN){
+#pragma HLS INLINE
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				lane[b] = T(IN.lane[b]);
+			}
+		}
+
+		T& operator[](std::size_t IDX){
+#pragma HLS INLINE
+			return lane[IDX];
+		}
+
+		T const& operator[](std::size_t IDX) const{
+#pragma HLS INLINE
+			return lane[IDX];
+		}
+
+		Lanes& operator+=(Lanes const& R){
+#pragma HLS INLINE
+			return *this = *this + R;
+		}
+
+		Lanes& operator-=(Lanes const& R){
+#pragma HLS INLINE
+			return *this = *this - R;
+		}
+
+		Lanes& operator*=(Lanes const& R){
+#pragma HLS INLINE
+			return *this = *this * R;
+		}
+
+		Lanes& operator/=(Lanes const& R){
+#pragma HLS INLINE
+			return *this = *this / R;
+		}
+
+		friend Lanes operator+(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::plus<T>());
+		}
+
+		friend Lanes operator-(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::minus<T>());
+		}
+
+		friend Lanes operator*(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::multiplies<T>());
+		}
+
+		friend Lanes operator/(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::divides<T>());
+		}
+
+		friend Lanes operator%(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::modulus<T>());
+		}
+
+		friend Lanes operator&(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::bit_and<T>());
+		}
+
+		friend Lanes operator|(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::bit_or<T>());
+		}
+
+		friend Lanes operator^(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, std::bit_xor<T>());
+		}
+
+		friend Lanes operator<<(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, Lshift());
+		}
+
+		friend Lanes operator>>(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<T>(L, R, Rshift());
+		}
+
+		friend mask operator<(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::less<T>());
+		}
+
+		friend mask operator>(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::greater<T>());
+		}
+
+		friend mask operator<=(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::less_equal<T>());
+		}
+
+		friend mask operator>=(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::greater_equal<T>());
+		}
+
+		friend mask operator==(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::equal_to<T>());
+		}
+
+		friend mask operator!=(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::not_equal_to<T>());
+		}
+
+		friend mask operator&&(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::logical_and<T>());
+		}
+
+		friend mask operator||(Lanes const& L, Lanes const& R){
+#pragma HLS INLINE
+			return zip<typename LaneMask<T>::type>(L, R, std::logical_or<T>());
+		}
+
+		friend Lanes operator-(Lanes const& IN){
+#pragma HLS INLINE
+			Lanes res;
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				res.lane[b] = -IN.lane[b];
+			}
+			return res;
+		}
+
+		friend Lanes operator~(Lanes const& IN){
+#pragma HLS INLINE
+			Lanes res;
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				res.lane[b] = ~IN.lane[b];
+			}
+			return res;
+		}
+
+		friend mask operator!(Lanes const& IN){
+#pragma HLS INLINE
+			mask res;
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				res.lane[b] = !IN.lane[b];
+			}
+			return res;
+		}
+
+	private:
+		struct Lshift{
+			T operator()(T const& L, T const& R) const{
+#pragma HLS INLINE
+				return L << R;
+			}
+		};
+
+		struct Rshift{
+			T operator()(T const& L, T const& R) const{
+#pragma HLS INLINE
+				return L >> R;
+			}
+		};
+
+		// Applies F to each pair of lanes of L and R
+		template <typename TR, class FN>
+		static Lanes<TR, B> zip(Lanes const& L, Lanes const& R, FN const& F){
+#pragma HLS INLINE
+			Lanes<TR, B> res;
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				res.lane[b] = F(L.lane[b], R.lane[b]);
+			}
+			return res;
+		}
+	};
+
+	// FUNCTION :
+	//        select
+	// 
+	// DESCRIPTION :
+	//        Returns A if M is true and B otherwise. The Lanes
+	//        overload selects each lane, so kernels that use
+	//        select in place of the ?: operator can be run in
+	//        lockstep.
+	// 
+	// EXAMPLE :
+	//        T lo = select(R < L, R, L);
+	template <typename T>
+	T select(bool M, T const& A, T const& B){
+#pragma HLS INLINE
+		return M ? A : B;
+	}
+
+	template <typename TM, typename T, std::size_t B>
+	Lanes<T, B> select(Lanes<TM, B> const& M, Lanes<T, B> const& A,
+			Lanes<T, B> const& OTHER){
+#pragma HLS INLINE
+		Lanes<T, B> res;
+		for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+			res.lane[b] = M.lane[b] ? A.lane[b] : OTHER.lane[b];
+		}
+		return res;
+	}
+
+	// MODULE :
+	//        struct LanesOf
+	// 
+	// DESCRIPTION :
+	//        Defines type, the type of a value of type U in a
+	//        kernel whose values have type T: Lanes<U, B> when T is
+	//        Lanes<X, B>, and U otherwise. A kernel that is
+	//        templated on its element type uses it for values that
+	//        differ from problem to problem but are not of the
+	//        element type (e.g. an index).
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the values of the kernel
+	//
+	//        U : typename
+	//            Type of the value in each lane
+	template <typename T, typename U>
+	struct LanesOf{
+		typedef U type;
+	};
+
+	template <typename T, std::size_t B, typename U>
+	struct LanesOf<Lanes<T, B>, U>{
+		typedef Lanes<U, B> type;
+	};
+
+	// MODULE :
+	//        struct LaneComplex
+	// 
+	// DESCRIPTION :
+	//        B complex values of type std::complex<T>, held as the
+	//        Lanes of their real and imaginary parts. It provides
+	//        the members of std::complex that kernels use, so that
+	//        kernel code written for std::complex<T> compiles for
+	//        LaneComplex<T, B>.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the real and imaginary parts of each lane
+	//
+	//        B : std::size_t
+	//            The number of lanes
+	// 
+	// FUNCTIONS :
+	//        LaneComplex()
+	//        LaneComplex(value_type const&, value_type const&)
+	//        value_type real() const
+	//        value_type imag() const
+	//        void real(value_type const&)
+	//        void imag(value_type const&)
+	//        LaneComplex& operator+=(LaneComplex const&) (and -=, *=)
+	//        LaneComplex operator+(LaneComplex const&,
+	//                  LaneComplex const&) (and -, *)
+	//        LaneComplex operator-(LaneComplex const&)
+	template <typename T, std::size_t B>
+	struct LaneComplex{
+		typedef Lanes<T, B> value_type;
+
+		value_type re, im;
+
+		LaneComplex() : re(), im(){
+#pragma HLS INLINE
+		}
+
+		LaneComplex(value_type const& RE, value_type const& IM = value_type())
+			: re(RE), im(IM){
+#pragma HLS INLINE
+		}
+
+		value_type real() const{
+#pragma HLS INLINE
+			return re;
+		}
+
+		value_type imag() const{
+#pragma HLS INLINE
+			return im;
+		}
+
+		void real(value_type const& V){
+#pragma HLS INLINE
+			re = V;
+		}
+
+		void imag(value_type const& V){
+#pragma HLS INLINE
+			im = V;
+		}
+
+		LaneComplex& operator+=(LaneComplex const& R){
+#pragma HLS INLINE
+			return *this = *this + R;
+		}
+
+		LaneComplex& operator-=(LaneComplex const& R){
+#pragma HLS INLINE
+			return *this = *this - R;
+		}
+
+		LaneComplex& operator*=(LaneComplex const& R){
+#pragma HLS INLINE
+			return *this = *this * R;
+		}
+
+		friend LaneComplex operator+(LaneComplex const& L, LaneComplex const& R){
+#pragma HLS INLINE
+			return LaneComplex(L.re + R.re, L.im + R.im);
+		}
+
+		friend LaneComplex operator-(LaneComplex const& L, LaneComplex const& R){
+#pragma HLS INLINE
+			return LaneComplex(L.re - R.re, L.im - R.im);
+		}
+
+		friend LaneComplex operator*(LaneComplex const& L, LaneComplex const& R){
+#pragma HLS INLINE
+			return LaneComplex(L.re * R.re - L.im * R.im, L.re * R.im + L.im * R.re);
+		}
+
+		friend LaneComplex operator-(LaneComplex const& IN){
+#pragma HLS INLINE
+			return LaneComplex(-IN.re, -IN.im);
+		}
+	};
+
+	// MODULE :
+	//        struct Batched
+	// 
+	// DESCRIPTION :
+	//        Defines type, the transposed form of B values of type
+	//        T: Lanes<T, B> for a value, LaneComplex<T, B> for
+	//        std::complex<T>, and the same structure with
+	//        transposed members for std::array and std::pair. pack
+	//        transposes B values of type T, and unpack is its
+	//        inverse.
+	//
+	//        The B values are accessed through a function of the
+	//        lane index, so that they are transposed in place,
+	//        without copying each problem into an intermediate
+	//        array.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            The type of one problem's value
+	//
+	//        B : std::size_t
+	//            The number of problems
+	//
+	// FUNCTIONS :
+	//        static type pack(FN const& IN)
+	//                  IN(b) returns the value in lane b
+	//        static void unpack(type const& IN, FN const& OUT)
+	//                  OUT(b) returns a reference to the value in
+	//                  lane b
+	template <typename T, std::size_t B>
+	struct Batched{
+		typedef Lanes<T, B> type;
+
+		template <class FN>
+		static type pack(FN const& IN){
+#pragma HLS INLINE
+			type res;
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				res.lane[b] = IN(b);
+			}
+			return res;
+		}
+
+		template <class FN>
+		static void unpack(type const& IN, FN const& OUT){
+#pragma HLS INLINE
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				OUT(b) = IN.lane[b];
+			}
+		}
+	};
+
+	template <typename T, std::size_t B>
+	struct Batched<std::complex<T>, B>{
+		typedef LaneComplex<T, B> type;
+
+		template <class FN>
+		static type pack(FN const& IN){
+#pragma HLS INLINE
+			type res;
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				std::complex<T> const& v = IN(b);
+				res.re.lane[b] = v.real();
+				res.im.lane[b] = v.imag();
+			}
+			return res;
+		}
+
+		template <class FN>
+		static void unpack(type const& IN, FN const& OUT){
+#pragma HLS INLINE
+			for(std::size_t b = 0; b < B; ++b){
+#pragma HLS UNROLL
+				OUT(b) = std::complex<T>(IN.re.lane[b], IN.im.lane[b]);
+			}
+		}
+	};
+
+	template <typename T, std::size_t N, std::size_t B>
+	struct Batched<std::array<T, N>, B>{
+		typedef std::array<typename Batched<T, B>::type, N> type;
+
+		template <class FN>
+		static type pack(FN const& IN){
+#pragma HLS INLINE
+			type res;
+			for(std::size_t n = 0; n < N; ++n){
+#pragma HLS UNROLL
+				res[n] = Batched<T, B>::pack([&IN, n](std::size_t b) -> T const& {
+						return IN(b)[n];
+					});
+			}
+			return res;
+		}
+
+		template <class FN>
+		static void unpack(type const& IN, FN const& OUT){
+#pragma HLS INLINE
+			for(std::size_t n = 0; n < N; ++n){
+#pragma HLS UNROLL
+				Batched<T, B>::unpack(IN[n], [&OUT, n](std::size_t b) -> T& {
+						return OUT(b)[n];
+					});
+			}
+		}
+	};
+
+	template <typename TL, typename TR, std::size_t B>
+	struct Batched<std::pair<TL, TR>, B>{
+		typedef std::pair<typename Batched<TL, B>::type,
+				  typename Batched<TR, B>::type> type;
+
+		template <class FN>
+		static type pack(FN const& IN){
+#pragma HLS INLINE
+			return type(Batched<TL, B>::pack([&IN](std::size_t b) -> TL const& {
+						return IN(b).first;
+					}),
+				Batched<TR, B>::pack([&IN](std::size_t b) -> TR const& {
+						return IN(b).second;
+					}));
+		}
+
+		template <class FN>
+		static void unpack(type const& IN, FN const& OUT){
+#pragma HLS INLINE
+			Batched<TL, B>::unpack(IN.first, [&OUT](std::size_t b) -> TL& {
+					return OUT(b).first;
+				});
+			Batched<TR, B>::unpack(IN.second, [&OUT](std::size_t b) -> TR& {
+					return OUT(b).second;
+				});
+		}
+	};
+
+	// MODULE :
+	//        struct BatchCallable
+	// 
+	// DESCRIPTION :
+	//        BatchCallable<FN, B, XS...>::value is true when FN can
+	//        be called with the transposed forms of XS, and returns
+	//        the transposed form of the type it returns for XS
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of the kernel
+	//
+	//        B : std::size_t
+	//            The number of problems
+	//
+	//        XS : typename...
+	//            The types of one problem's arguments
+	template <class FN, std::size_t B, class ARGS, class = void>
+	struct BatchCallable : public std::false_type{
+	};
+
+	template <class FN, std::size_t B, typename... XS>
+	struct BatchCallable<FN, B, std::tuple<XS...>,
+			     typename std::conditional<true, void,
+			     decltype(std::declval<FN const&>()
+				      (std::declval<typename Batched<XS, B>::type const&>()...))>::type>
+		: public std::is_same<decltype(std::declval<FN const&>()
+			 (std::declval<typename Batched<XS, B>::type const&>()...)),
+			 typename Batched<typename std::decay<decltype(std::declval<FN const&>()
+			 (std::declval<XS const&>()...))>::type, B>::type>{
+	};
+
+	// MODULE :
+	//        struct Batch
+	// 
+	// DESCRIPTION :
+	//        Wraps the batch function with the () operator to
+	//        provide a function-like API.
+	// 
+	// PARAMETERS :
+	//        B : std::size_t
+	//            The number of problems computed in lockstep
+	// 
+	// FUNCTIONS :
+	//        void operator()(FN const&, dyn::Span<R>,
+	//                        dyn::Span<XS>...) const
+	template <std::size_t B>
+	struct Batch{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes OUT[i] = K(IN[i]...) for each of the
+		//        OUT.size() problems i, B problems at a time
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the kernel
+		//
+		//        R : typename (Inferred)
+		//            The type of one problem's result
+		//
+		//        XS : typename... (Inferred)
+		//            The types of one problem's arguments (const
+		//            or not)
+		//
+		// ARGUMENTS :
+		//        K : FN const&
+		//            The kernel. It is called with the transposed
+		//            arguments of B problems when BatchCallable is
+		//            true, and with the arguments of one problem
+		//            otherwise.
+		//
+		//        OUT : dyn::Span<R>
+		//            The result of K for each problem
+		//
+		//        IN : dyn::Span<XS>...
+		//            One or more buffers, holding one argument of
+		//            K for each problem. Each holds at least
+		//            OUT.size() problems.
+		//
+		// NOTES :
+		//        When OUT.size() is not a multiple of B, the lanes
+		//        after the last problem compute copies of the last
+		//        problem.
+		template <class FN, typename R, typename... XS>
+		void operator()(FN const& K, dyn::Span<R> OUT, dyn::Span<XS>... IN) const{
+#pragma HLS INLINE
+			static_assert(B > 0, "batch requires at least one lane");
+			static_assert(sizeof...(XS) > 0, "batch requires at least one argument");
+			std::size_t const sizes[] = {IN.size()...};
+			for(std::size_t i = 0; i < sizeof...(XS); ++i){
+				assert(sizes[i] >= OUT.size());
+			}
+			run(K, BatchCallable<FN, B, std::tuple<typename std::remove_cv<XS>::type...> >(),
+				OUT, IN...);
+		}
+
+	private:
+		template <class FN, typename R, typename... XS>
+		static void run(FN const& K, std::true_type LOCKSTEP,
+				dyn::Span<R> OUT, dyn::Span<XS>... IN){
+#pragma HLS INLINE
+			static_assert(std::is_same<R, typename std::decay<decltype(K(IN[0]...))>::type>::value,
+				      "batch in lockstep requires OUT to hold the type that K returns");
+			std::size_t base = 0;
+			for(; base + B <= OUT.size(); base += B){
+				group(K, Results<R>(OUT, base), Problems<XS>(IN, base)...);
+			}
+			if(base < OUT.size()){
+				R pad;
+				group(K, TailResults<R>(OUT, base, pad),
+					TailProblems<XS>(IN, base, OUT.size())...);
+			}
+		}
+
+		// Computes the B problems read by IN and writes their
+		// results to OUT. It is a function of its own so that the
+		// host compiler inlines K into it, rather than into the
+		// loop over groups.
+		template <class FN, class RS, class... PS>
+		static void group(FN const& K, RS const& OUT, PS const&... IN){
+#pragma HLS INLINE
+			typedef typename std::decay<decltype(K(IN(0)...))>::type R;
+			Batched<R, B>::unpack(K(Batched<typename std::decay<decltype(IN(0))>::type, B>
+						::pack(IN)...), OUT);
+		}
+
+		template <class FN, typename R, typename... XS>
+		static void run(FN const& K, std::false_type LOCKSTEP,
+				dyn::Span<R> OUT, dyn::Span<XS>... IN){
+#pragma HLS INLINE
+			for(std::size_t i = 0; i < OUT.size(); ++i){
+				OUT[i] = K(IN[i]...);
+			}
+		}
+
+		// Lane b reads problem BASE+b of IN
+		template <typename X>
+		struct Problems{
+			dyn::Span<X> const& IN;
+			std::size_t const BASE;
+
+			Problems(dyn::Span<X> const& IN, std::size_t BASE)
+				: IN(IN), BASE(BASE){
+#pragma HLS INLINE
+			}
+
+			X const& operator()(std::size_t b) const{
+#pragma HLS INLINE
+				return IN[BASE + b];
+			}
+		};
+
+		// Lane b writes problem BASE+b of OUT
+		template <typename R>
+		struct Results{
+			dyn::Span<R> const& OUT;
+			std::size_t const BASE;
+
+			Results(dyn::Span<R> const& OUT, std::size_t BASE)
+				: OUT(OUT), BASE(BASE){
+#pragma HLS INLINE
+			}
+
+			R& operator()(std::size_t b) const{
+#pragma HLS INLINE
+				return OUT[BASE + b];
+			}
+		};
+
+		// As Problems, for the last group: lanes after the last of
+		// the N problems read the last problem
+		template <typename X>
+		struct TailProblems{
+			dyn::Span<X> const& IN;
+			std::size_t const BASE, N;
+
+			TailProblems(dyn::Span<X> const& IN, std::size_t BASE, std::size_t N)
+				: IN(IN), BASE(BASE), N(N){
+#pragma HLS INLINE
+			}
+
+			X const& operator()(std::size_t b) const{
+#pragma HLS INLINE
+				return IN[(BASE + b < N) ? BASE + b : N - 1];
+			}
+		};
+
+		// As Results, for the last group: lanes after the end of
+		// OUT write PAD
+		template <typename R>
+		struct TailResults{
+			dyn::Span<R> const& OUT;
+			std::size_t const BASE;
+			R& PAD;
+
+			TailResults(dyn::Span<R> const& OUT, std::size_t BASE, R& PAD)
+				: OUT(OUT), BASE(BASE), PAD(PAD){
+#pragma HLS INLINE
+			}
+
+			R& operator()(std::size_t b) const{
+#pragma HLS INLINE
+				return (BASE + b < OUT.size()) ? OUT[BASE + b] : PAD;
+			}
+		};
+	};
+
+	// FUNCTION :
+	//        batch
+	// 
+	// DESCRIPTION :
+	//        Runs K on each problem in IN, B problems at a time in
+	//        lockstep, and writes the results to OUT, using the
+	//        Batch struct
+	// 
+	// EXAMPLE :
+	//        std::vector<std::array<int, 32> > in(1024);
+	//        std::vector<std::pair<int, std::size_t> > mins(1024);
+	//        batch<8>(argmin, dyn::span(mins), dyn::span(in));
+	//        // 128 steps of 8 lanes
+	template <std::size_t B, class FN, typename R, typename... XS>
+	void batch(FN const& K, dyn::Span<R> OUT, dyn::Span<XS>... IN){
+#pragma HLS INLINE
+		Batch<B>()(K, OUT, IN...);
+	}
+} // namespace hops
+#endif // __BATCH_HPP
@@ -0,0 +1,808 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        butterfly.hpp
+//
+// DESCRIPTION :
+//        This file implements the butterfly and rbutterfly
+//        Higher-Order Functions, which apply a function to every
+//        pair of elements in each stage of a butterfly network (as
+//        used in the FFT and bitonic sorting networks).
+//       
+// NAMESPACES :
+//        hops
+//        hops::loop
+//
+// PUBLIC MODULES :
+//        Butterfly
+//        RButterfly
+//        loop::Butterfly
+//        loop::RButterfly
+// 
+// PRIVATE MODULES :
+//        ButterflyHelper
+//        RButterflyHelper
+//
+// PUBLIC VARIABLES :
+//        butterfly (an instance of Butterfly)
+//        rbutterfly (an instance of RButterfly)
+//        loop::butterfly (an instance of loop::Butterfly)
+//        loop::rbutterfly (an instance of loop::RButterfly)
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        A butterfly network on LEN = 2^LEV elements has LEV
+//        stages. Each stage of level L (1 <= L <= LEV) divides the
+//        array into blocks of 2^L elements and pairs element i of
+//        the first half of each block with element i of the second
+//        half. The function F is called as
+//
+//            F(std::pair<std::size_t, std::size_t>(L, i),
+//              std::pair<T, T>(top, bottom))
+//
+//        and must return a std::pair<T, T>. butterfly applies the
+//        stages in increasing order of L (stride 1 first, as in a
+//        decimation-in-time FFT) and rbutterfly applies them in
+//        decreasing order (stride LEN/2 first, as in a
+//        decimation-in-frequency FFT or a bitonic merge).
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __BUTTERFLY_HPP
+#define __BUTTERFLY_HPP
+#include <array>
+#include <utility>
+#include "arrayops.hpp"
+#include "zip.hpp"
+namespace hops{
+	// MODULE :
+	//        struct ButterflyHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the increasing-stride butterfly network
+	//        using C++ Template Meta-Programming and Partial
+	//        Template Specialization.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input list (a power of two),
+	//            and the iteration variable for C++ Template
+	//            Meta-Programming.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//        std::array<T, LEN> stage(FN const&, std::array<T, LEN/2>,
+	//                                 std::array<T, LEN/2>, index_sequence)
+	//        std::array<T, LEN> stage(FN const&, EL const&, ER const&,
+	//                                 index_sequence)
+	template <std::size_t LEN>
+	struct ButterflyHelper{
+		// Length of each half of a block
+		static const std::size_t HALF = LEN / 2;
+		// Level of the stage that combines the two halves
+		static const std::size_t LEVEL = ButterflyHelper<HALF>::LEVEL + 1;
+
+		// FUNCTION :
+		//        stage
+		// 
+		// DESCRIPTION :
+		//        Applies F to corresponding elements of the
+		//        two halves of a block of LEN elements.
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input arrays.
+		//
+		//        IDX : Variadic std::size_t (Inferred)
+		//            Indices 0 to LEN/2 - 1
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to each pair.
+		//
+		//        L : std::array<T, LEN/2> const&
+		//            The first (top) half of the block
+		//
+		//        R : std::array<T, LEN/2> const&
+		//            The second (bottom) half of the block
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The concatenated top and bottom outputs of F
+		template <class FN, typename T, std::size_t... IDX>
+		static std::array<T, LEN> stage(FN const& F,
+						std::array<T, HALF> const& L,
+						std::array<T, HALF> const& R,
+						index_sequence<IDX...>){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
+#pragma HLS INLINE
+			// LEVEL is copied so that it is not odr-used
+			std::array<std::pair<T, T>, HALF> o = {{
+					F(std::pair<std::size_t, std::size_t>(std::size_t(LEVEL), IDX),
+						std::pair<T, T>(L[IDX], R[IDX]))...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=o._M_instance
+			auto p = unzip(o);
+			return concatenate(p.first, p.second);
+		}
+
+		// As above, for halves that are lazy expressions (see
+		// lazy.hpp), whose elements are computed as they are
+		// paired
+		template <class FN, class EL, class ER, std::size_t... IDX>
+		static std::array<typename EL::value_type, LEN> stage(FN const& F,
+						EL const& L, ER const& R,
+						index_sequence<IDX...>){
+#pragma HLS INLINE
+			typedef typename EL::value_type T;
+			std::array<std::pair<T, T>, HALF> o = {{
+					F(std::pair<std::size_t, std::size_t>(std::size_t(LEVEL), IDX),
+						std::pair<T, T>(L[IDX], R[IDX]))...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=o._M_instance
+			auto p = unzip(o);
+			return concatenate(p.first, p.second);
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies the butterfly network to each half of
+		//        the input array, and then applies the final
+		//        stage to the two halves.
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to each pair.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The output of the butterfly network
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			auto p = split<HALF>(IN);
+			return stage(F, ButterflyHelper<HALF>()(F, p.first),
+				ButterflyHelper<HALF>()(F, p.second),
+				make_index_sequence<HALF>());
+		}
+
+		// As above, for a lazy expression IN. Its halves are
+		// split without copies, and each element is computed
+		// once, at the first stage
+		template <class FN, class E>
+		std::array<typename E::value_type, LEN> operator()(FN const& F,
+								E const& IN) const{
+#pragma HLS INLINE
+			auto p = split<HALF>(IN);
+			return stage(F, ButterflyHelper<HALF>()(F, p.first),
+				ButterflyHelper<HALF>()(F, p.second),
+				make_index_sequence<HALF>());
+		}
+	};
+
+	// MODULE :
+	//        struct ButterflyHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the base case (LEN = 1) of the butterfly
+	//        network, which has no stages.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, 1> operator()(FN const&, std::array<T, 1>) const
+	//        std::array<T, 1> operator()(FN const&, E const&) const
+	template <>
+	struct ButterflyHelper<1>{
+		// Level of the (empty) network on one element
+		static const std::size_t LEVEL = 0;
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Returns the one-element input array
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function. Unused in the base case.
+		//
+		//        IN : std::array<T, 1> const&
+		//            The one-element input array
+		// 
+		// RETURNS : std::array<T, 1>
+		//        The input array, unmodified.
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, 1> operator()(FN const& F,
+					std::array<T, 1> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return IN;
+		}
+
+		template <class FN, class E>
+		std::array<typename E::value_type, 1> operator()(FN const& F,
+								E const& IN) const{
+#pragma HLS INLINE
+			return {{IN[0]}};
+		}
+	};
+
+	// MODULE :
+	//        struct RButterflyHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the decreasing-stride butterfly network
+	//        using C++ Template Meta-Programming and Partial
+	//        Template Specialization.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input list (a power of two),
+	//            and the iteration variable for C++ Template
+	//            Meta-Programming.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	template <std::size_t LEN>
+	struct RButterflyHelper{
+		// Length of each half of a block
+		static const std::size_t HALF = LEN / 2;
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies the first stage to the two halves of
+		//        the input array, and then applies the
+		//        butterfly network to each half of the result.
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to each pair.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The output of the butterfly network
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			auto p = split<HALF>(IN);
+			auto s = split<HALF>(ButterflyHelper<LEN>::stage(F, p.first, p.second,
+							make_index_sequence<HALF>()));
+			return concatenate(RButterflyHelper<HALF>()(F, s.first),
+					RButterflyHelper<HALF>()(F, s.second));
+		}
+
+		// As above, for a lazy expression IN. Each element is
+		// computed once, at the first stage
+		template <class FN, class E>
+		std::array<typename E::value_type, LEN> operator()(FN const& F,
+								E const& IN) const{
+#pragma HLS INLINE
+			auto p = split<HALF>(IN);
+			auto s = split<HALF>(ButterflyHelper<LEN>::stage(F, p.first, p.second,
+							make_index_sequence<HALF>()));
+			return concatenate(RButterflyHelper<HALF>()(F, s.first),
+					RButterflyHelper<HALF>()(F, s.second));
+		}
+	};
+
+	// MODULE :
+	//        struct RButterflyHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the base case (LEN = 1) of the
+	//        decreasing-stride butterfly network, which has no
+	//        stages.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, 1> operator()(FN const&, std::array<T, 1>) const
+	//        std::array<T, 1> operator()(FN const&, E const&) const
+	template <>
+	struct RButterflyHelper<1>{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Returns the one-element input array
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function. Unused in the base case.
+		//
+		//        IN : std::array<T, 1> const&
+		//            The one-element input array
+		// 
+		// RETURNS : std::array<T, 1>
+		//        The input array, unmodified.
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, 1> operator()(FN const& F,
+					std::array<T, 1> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return IN;
+		}
+
+		template <class FN, class E>
+		std::array<typename E::value_type, 1> operator()(FN const& F,
+								E const& IN) const{
+#pragma HLS INLINE
+			return {{IN[0]}};
+		}
+	};
+
+	// MODULE :
+	//        struct Butterfly
+	// 
+	// DESCRIPTION :
+	//        Wraps the increasing-stride butterfly network
+	//        provided by ButterflyHelper with the () operator to
+	//        provide a function-like API.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        A corresponding loop-based implementation is defined
+	//        in the hops::loop namespace
+	//
+	//        The elements of a view or lazy expression (see
+	//        view.hpp and lazy.hpp) are computed as they are read
+	//        by the first stage, without an intermediate array.
+	struct Butterfly{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies the stages of a butterfly network to
+		//        the input array, from level 1 (stride 1) to
+		//        level log2(LEN) (stride LEN/2).
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input
+		//            argument. Must be a power of two.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to each pair. F is
+		//            passed the (level, index) context and
+		//            the pair, and returns a pair.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The output of the butterfly network
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			static_assert(LEN && !(LEN & (LEN - 1)),
+				"butterfly requires a power-of-two length");
+			return ButterflyHelper<LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			static_assert(E::size() && !(E::size() & (E::size() - 1)),
+				"butterfly requires a power-of-two length");
+			return ButterflyHelper<E::size()>()(F, IN);
+		}
+	};
+
+	// MODULE :
+	//        struct RButterfly
+	// 
+	// DESCRIPTION :
+	//        Wraps the decreasing-stride butterfly network
+	//        provided by RButterflyHelper with the () operator to
+	//        provide a function-like API.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        A corresponding loop-based implementation is defined
+	//        in the hops::loop namespace
+	//
+	//        The elements of a view or lazy expression (see
+	//        view.hpp and lazy.hpp) are computed as they are read
+	//        by the first stage, without an intermediate array.
+	struct RButterfly{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies the stages of a butterfly network to
+		//        the input array, from level log2(LEN) (stride
+		//        LEN/2) to level 1 (stride 1).
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input
+		//            argument. Must be a power of two.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to each pair. F is
+		//            passed the (level, index) context and
+		//            the pair, and returns a pair.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The output of the butterfly network
+		//
+		// NOTES :
+		//        rbutterfly(F, IN) computes the same result as
+		//        bitreverse(butterfly(F, bitreverse(IN))) for any
+		//        F that ignores its context argument, without
+		//        the two permutations.
+		//
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			static_assert(LEN && !(LEN & (LEN - 1)),
+				"rbutterfly requires a power-of-two length");
+			return RButterflyHelper<LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			static_assert(E::size() && !(E::size() & (E::size() - 1)),
+				"rbutterfly requires a power-of-two length");
+			return RButterflyHelper<E::size()>()(F, IN);
+		}
+	};
+
+	// VARIABLE :
+	//        butterfly (Instance of Butterfly)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Butterfly struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//        // Radix-2 decimation-in-time FFT
+	//        out = butterfly(FFTOP<LEN>(), bitreverse(in));
+	Butterfly butterfly;
+
+	// VARIABLE :
+	//        rbutterfly (Instance of RButterfly)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the RButterfly struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//        // Bitonic merge of a bitonic sequence
+	//        out = rbutterfly(compare_and_swap, in);
+	RButterfly rbutterfly;
+
+	namespace loop{
+		// MODULE :
+		//        struct Butterfly
+		// 
+		// DESCRIPTION :
+		//        Implements the increasing-stride butterfly
+		//        network using nested loops in the operator()
+		//        function to provide a function-like API.
+		// 
+		// FUNCTIONS :
+		//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+		struct Butterfly{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Applies the stages of a butterfly
+			//        network to the input array, from
+			//        level 1 (stride 1) to level log2(LEN)
+			//        (stride LEN/2), using unrolled
+			//        for-loops.
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a class-wrapped function. 
+			// 
+			//        T : typename (Inferred)
+			//            Type of the std::array values in the
+			//            input array.
+			//
+			//        LEN : std::size_t (Inferred)
+			//            Length of the std::array input
+			//            argument. Must be a power of two.
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Instantiation of the class-wrapped
+			//            function to apply to each pair.
+			//
+			//        IN : std::array<T, LEN> const&
+			//            The input array
+			// 
+			// RETURNS : std::array<T, LEN>
+			//        The output of the butterfly network
+			//
+			// NOTES :
+			//        The trailing const declaration on the
+			//        operator() function is required by our
+			//        library, and indicates to the compiler that
+			//        the method modifies no internal state
+			template <class FN, typename T, std::size_t LEN>
+			std::array<T, LEN> operator()(FN const& F,
+						std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+				static_assert(LEN && !(LEN & (LEN - 1)),
+					"butterfly requires a power-of-two length");
+				static const std::size_t LEV = ButterflyHelper<LEN>::LEVEL;
+				std::array<std::array<T, LEN>, LEV + 1> stagearr;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr[0]._M_instance
+				stagearr[0] = IN;
+			bfly_level:
+				for(std::size_t l = 0; l < LEV; ++l){
+#pragma HLS UNROLL
+					std::size_t stride = std::size_t(1) << l;
+				bfly_pair:
+					for(std::size_t i = 0; i < LEN / 2; ++i){
+#pragma HLS UNROLL
+						std::size_t top = i & (stride - 1);
+						std::size_t base = top + ((i >> l) << (l + 1));
+						std::pair<T, T> o = F(std::pair<std::size_t, std::size_t>(l + 1, top),
+								std::pair<T, T>(stagearr[l][base],
+										stagearr[l][base + stride]));
+						stagearr[l + 1][base] = o.first;
+						stagearr[l + 1][base + stride] = o.second;
+					}
+				}
+				return stagearr[LEV];
+			}
+		};
+
+		// MODULE :
+		//        struct RButterfly
+		// 
+		// DESCRIPTION :
+		//        Implements the decreasing-stride butterfly
+		//        network using nested loops in the operator()
+		//        function to provide a function-like API.
+		// 
+		// FUNCTIONS :
+		//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+		struct RButterfly{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Applies the stages of a butterfly
+			//        network to the input array, from level
+			//        log2(LEN) (stride LEN/2) to level 1
+			//        (stride 1), using unrolled for-loops.
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a class-wrapped function. 
+			// 
+			//        T : typename (Inferred)
+			//            Type of the std::array values in the
+			//            input array.
+			//
+			//        LEN : std::size_t (Inferred)
+			//            Length of the std::array input
+			//            argument. Must be a power of two.
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Instantiation of the class-wrapped
+			//            function to apply to each pair.
+			//
+			//        IN : std::array<T, LEN> const&
+			//            The input array
+			// 
+			// RETURNS : std::array<T, LEN>
+			//        The output of the butterfly network
+			//
+			// NOTES :
+			//        The trailing const declaration on the
+			//        operator() function is required by our
+			//        library, and indicates to the compiler that
+			//        the method modifies no internal state
+			template <class FN, typename T, std::size_t LEN>
+			std::array<T, LEN> operator()(FN const& F,
+						std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+				static_assert(LEN && !(LEN & (LEN - 1)),
+					"rbutterfly requires a power-of-two length");
+				static const std::size_t LEV = ButterflyHelper<LEN>::LEVEL;
+				std::array<std::array<T, LEN>, LEV + 1> stagearr;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=stagearr[0]._M_instance
+				stagearr[0] = IN;
+			rbfly_level:
+				for(std::size_t s = 0; s < LEV; ++s){
+#pragma HLS UNROLL
+					std::size_t l = LEV - 1 - s;
+					std::size_t stride = std::size_t(1) << l;
+				rbfly_pair:
+					for(std::size_t i = 0; i < LEN / 2; ++i){
+#pragma HLS UNROLL
+						std::size_t top = i & (stride - 1);
+						std::size_t base = top + ((i >> l) << (l + 1));
+						std::pair<T, T> o = F(std::pair<std::size_t, std::size_t>(l + 1, top),
+								std::pair<T, T>(stagearr[s][base],
+										stagearr[s][base + stride]));
+						stagearr[s + 1][base] = o.first;
+						stagearr[s + 1][base + stride] = o.second;
+					}
+				}
+				return stagearr[LEV];
+			}
+		};
+
+		// VARIABLE :
+		//        butterfly (Instance of loop::Butterfly)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the loop::Butterfly struct that
+		//        provides a function-like API with the operator()
+		//        function.
+		Butterfly butterfly;
+
+		// VARIABLE :
+		//        rbutterfly (Instance of loop::RButterfly)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the loop::RButterfly struct that
+		//        provides a function-like API with the operator()
+		//        function.
+		RButterfly rbutterfly;
+	} // namespace loop
+} // namespace hops
+#endif // __BUTTERFLY_HPP
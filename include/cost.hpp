@@ -0,0 +1,586 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        cost.hpp
+//
+// DESCRIPTION :
+//        This file implements a compile-time cost model of the
+//        Higher-Order Functions. For a Higher-Order Function, a
+//        function object and the types of the arguments, Cost
+//        reports three figures:
+//
+//            ops     : The number of applications of the function
+//            depth   : The length of the critical path, in
+//                      applications of the function
+//            storage : The number of array elements computed by
+//                      the applications of the function
+//
+//        The figures are static constants, so a design can be sized
+//        (and checked with static_assert) when it is compiled,
+//        before it is synthesized:
+//
+//            typedef Cost<Divconq, Sum, std::array<int, 16> > C;
+//            static_assert(C::ops == 15 && C::depth == 4, "");
+//
+//        Each application of a function costs the figures of
+//        FunctionCost, which are 1, 1 and 0 unless FunctionCost is
+//        specialized for the function. A function that is built
+//        from Higher-Order Functions (e.g. the merge of a bitonic
+//        sort) specializes FunctionCost to the Cost of its body,
+//        and its figures are included in the figures of every
+//        Higher-Order Function that applies it.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Figures
+//        FunctionCost
+//        Cost
+//        Sequential
+// 
+// PRIVATE MODULES :
+//        Elements
+//        TreeCost
+//        Tree4Cost
+//        ScanShape
+//
+// PUBLIC FUNCTIONS :
+//        cost
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        Cost models the structure that a Higher-Order Function
+//        builds by template recursion (the unrolled policy, see
+//        exec.hpp). Moving data with split, concatenate, reverse,
+//        zip and unzip is wiring, and is not counted. Elements of
+//        std::pair, std::tuple and std::array values are counted
+//        individually; any other type is one element.
+//
+//        Depth is the number of applications on the critical path
+//        multiplied by the depth of one application, which is
+//        exact when every application has the same depth.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __COST_HPP
+#define __COST_HPP
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "arrayops.hpp"
+#include "butterfly.hpp"
+#include "divconq.hpp"
+#include "map.hpp"
+#include "mapreduce.hpp"
+#include "reduce.hpp"
+#include "scan.hpp"
+#include "zip.hpp"
+namespace hops{
+	// MODULE :
+	//        struct Figures
+	// 
+	// DESCRIPTION :
+	//        Holds the figures of a cost as static constants.
+	//        Every Cost and FunctionCost is derived from Figures.
+	// 
+	// PARAMETERS :
+	//        OPS : std::size_t
+	//            Number of applications of the function
+	//
+	//        DEPTH : std::size_t
+	//            Length of the critical path
+	//
+	//        STORAGE : std::size_t
+	//            Number of array elements computed
+	template <std::size_t OPS, std::size_t DEPTH, std::size_t STORAGE>
+	struct Figures{
+		static constexpr std::size_t ops = OPS;
+		static constexpr std::size_t depth = DEPTH;
+		static constexpr std::size_t storage = STORAGE;
+	};
+
+	// MODULE :
+	//        struct Elements
+	// 
+	// DESCRIPTION :
+	//        Elements<T>::value is the number of elements in a
+	//        value of type T: the sum of the elements of its
+	//        members for std::array, std::pair and std::tuple, and
+	//        1 otherwise.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            The type to count
+	template <typename T>
+	struct Elements : public std::integral_constant<std::size_t, 1>{
+	};
+
+	template <typename T, std::size_t LEN>
+	struct Elements<std::array<T, LEN> >
+		: public std::integral_constant<std::size_t, LEN * Elements<T>::value>{
+	};
+
+	template <typename TL, typename TR>
+	struct Elements<std::pair<TL, TR> >
+		: public std::integral_constant<std::size_t,
+						Elements<TL>::value + Elements<TR>::value>{
+	};
+
+	template <>
+	struct Elements<std::tuple<> > : public std::integral_constant<std::size_t, 0>{
+	};
+
+	template <typename T, typename... TS>
+	struct Elements<std::tuple<T, TS...> >
+		: public std::integral_constant<std::size_t,
+						Elements<T>::value + Elements<std::tuple<TS...> >::value>{
+	};
+
+	// FUNCTION :
+	//        costmax
+	// 
+	// DESCRIPTION :
+	//        Returns the larger of A and B. (std::max is not
+	//        constexpr in C++11.)
+	constexpr std::size_t costmax(std::size_t A, std::size_t B){
+		return A < B ? B : A;
+	}
+
+	// MODULE :
+	//        struct FunctionCost
+	// 
+	// DESCRIPTION :
+	//        The figures of one application of a function of type
+	//        FN to arguments of types AS...: one application, with
+	//        a depth of one, that computes the elements of its
+	//        result.
+	//
+	//        Specialize FunctionCost for functions that are
+	//        composed from Higher-Order Functions, e.g.
+	//
+	//            template <typename T, std::size_t LEN>
+	//            struct FunctionCost<Merge, std::array<T, LEN>,
+	//                                std::array<T, LEN> >
+	//                : public Cost<RButterfly, CAS,
+	//                              std::array<T, 2*LEN> >{};
+	//
+	//        or for functions that only move data, with
+	//        Figures<0, 0, 0>.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Type of the function
+	//
+	//        AS : typename...
+	//            Types of the arguments of the function
+	template <class FN, typename... AS>
+	struct FunctionCost
+		: public Figures<1, 1, Elements<typename std::decay<decltype(std::declval<FN const&>()
+									    (std::declval<AS const&>()...))>::type>::value>{
+	};
+
+	// MODULE :
+	//        struct Cost
+	// 
+	// DESCRIPTION :
+	//        The figures of a Higher-Order Function, HOF, applied
+	//        to a function of type FN and arguments of types AS...
+	//        Cost is specialized for each Higher-Order Function,
+	//        with the same arguments as its operator():
+	//
+	//            Cost<Map, FN, std::array<TA, LEN> >
+	//            Cost<ZipWith, FN, std::array<TA, LEN>,
+	//                 std::array<TS, LEN>... >
+	//            Cost<Lreduce, FN, TI, std::array<TA, LEN> >
+	//            Cost<Rreduce, FN, std::array<TA, LEN>, TI>
+	//            Cost<Treereduce, FN, std::array<TA, LEN> >
+	//            Cost<Divconq, FN, std::array<T, LEN> >
+	//            Cost<Divconq4, FN, std::array<T, LEN> >
+	//            Cost<Lscan<TOPOLOGY>, FN, std::array<T, LEN> >
+	//            Cost<Rscan<TOPOLOGY>, FN, std::array<T, LEN> >
+	//            Cost<Mapreduce<TOPOLOGY>, FNM, FNR, TI,
+	//                 std::array<TA, LEN>, std::array<TS, LEN>... >
+	//            Cost<Butterfly, FN, std::array<T, LEN> >
+	//            Cost<RButterfly, FN, std::array<T, LEN> >
+	// 
+	// PARAMETERS :
+	//        HOF : class
+	//            The Higher-Order Function (the type of its
+	//            instance, e.g. Map for hops::map)
+	//
+	//        FN : class
+	//            Type of the function passed to HOF
+	//
+	//        AS : typename...
+	//            Types of the remaining arguments of HOF
+	template <class HOF, class FN, typename... AS>
+	struct Cost;
+
+	// MODULE :
+	//        struct Sequential
+	// 
+	// DESCRIPTION :
+	//        The figures of a sequence of steps, where each step
+	//        consumes the result of the previous one: the sum of
+	//        the figures of each step.
+	// 
+	// PARAMETERS :
+	//        CS : class...
+	//            The Cost (or Figures) of each step
+	template <class... CS>
+	struct Sequential : public Figures<0, 0, 0>{
+	};
+
+	template <class C, class... CS>
+	struct Sequential<C, CS...>
+		: public Figures<C::ops + Sequential<CS...>::ops,
+				 C::depth + Sequential<CS...>::depth,
+				 C::storage + Sequential<CS...>::storage>{
+	};
+
+	// MODULE :
+	//        struct TreeCost
+	// 
+	// DESCRIPTION :
+	//        The figures of a binary tree of applications of FN
+	//        over LEN leaves of type LEAF, where a range of LEN
+	//        leaves is divided at LLEN. The type of the result of
+	//        each subtree is computed from FN, so that functions
+	//        whose results grow (e.g. concatenate) are counted
+	//        exactly.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Type of the function
+	//
+	//        LEAF : typename
+	//            Type of the leaves
+	//
+	//        LEN : std::size_t
+	//            The number of leaves
+	//
+	//        POW2 : bool
+	//            True to divide at the largest power of two less
+	//            than LEN (divconq), and false to divide at LEN/2
+	//            (treereduce)
+	template <class FN, typename LEAF, std::size_t LEN, bool POW2>
+	struct TreeCost{
+		static constexpr std::size_t LLEN = POW2 ? (std::size_t(1) << (clog2(LEN) - 1)) : LEN / 2;
+		typedef TreeCost<FN, LEAF, LLEN, POW2> left;
+		typedef TreeCost<FN, LEAF, LEN - LLEN, POW2> right;
+		typedef typename std::decay<decltype(std::declval<FN const&>()
+						     (std::declval<typename left::type const&>(),
+						      std::declval<typename right::type const&>()))>::type type;
+		typedef FunctionCost<FN, typename left::type, typename right::type> fn;
+
+		static constexpr std::size_t ops = left::ops + right::ops + fn::ops;
+		static constexpr std::size_t depth = costmax(left::depth, right::depth) + fn::depth;
+		static constexpr std::size_t storage = left::storage + right::storage + fn::storage;
+	};
+
+	template <class FN, typename LEAF, bool POW2>
+	struct TreeCost<FN, LEAF, 1, POW2> : public Figures<0, 0, 0>{
+		typedef LEAF type;
+	};
+
+	// MODULE :
+	//        struct Tree4Cost
+	// 
+	// DESCRIPTION :
+	//        The figures of the tree of divconq4 over LEN leaves of
+	//        type LEAF: a range of LEN leaves is divided into four
+	//        quarters when LEN is a multiple of four, and as by
+	//        TreeCost (divconq) otherwise.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Type of the function
+	//
+	//        LEAF : typename
+	//            Type of the leaves
+	//
+	//        LEN : std::size_t
+	//            The number of leaves
+	//
+	//        QUAD : bool
+	//            True when LEN is divided into quarters
+	template <class FN, typename LEAF, std::size_t LEN, bool QUAD = (LEN % 4 == 0)>
+	struct Tree4Cost{
+		typedef Tree4Cost<FN, LEAF, LEN / 4> quarter;
+		typedef typename quarter::type qtype;
+		typedef typename std::decay<decltype(std::declval<FN const&>()
+						     (std::declval<qtype const&>(), std::declval<qtype const&>(),
+						      std::declval<qtype const&>(), std::declval<qtype const&>()))>::type type;
+		typedef FunctionCost<FN, qtype, qtype, qtype, qtype> fn;
+
+		static constexpr std::size_t ops = 4 * quarter::ops + fn::ops;
+		static constexpr std::size_t depth = quarter::depth + fn::depth;
+		static constexpr std::size_t storage = 4 * quarter::storage + fn::storage;
+	};
+
+	template <class FN, typename LEAF, std::size_t LEN>
+	struct Tree4Cost<FN, LEAF, LEN, false>{
+		static constexpr std::size_t LLEN = std::size_t(1) << (clog2(LEN) - 1);
+		typedef Tree4Cost<FN, LEAF, LLEN> left;
+		typedef Tree4Cost<FN, LEAF, LEN - LLEN> right;
+		typedef typename std::decay<decltype(std::declval<FN const&>()
+						     (std::declval<typename left::type const&>(),
+						      std::declval<typename right::type const&>()))>::type type;
+		typedef FunctionCost<FN, typename left::type, typename right::type> fn;
+
+		static constexpr std::size_t ops = left::ops + right::ops + fn::ops;
+		static constexpr std::size_t depth = costmax(left::depth, right::depth) + fn::depth;
+		static constexpr std::size_t storage = left::storage + right::storage + fn::storage;
+	};
+
+	template <class FN, typename LEAF>
+	struct Tree4Cost<FN, LEAF, 1, false> : public Figures<0, 0, 0>{
+		typedef LEAF type;
+	};
+
+	// MODULE :
+	//        struct ScanShape
+	// 
+	// DESCRIPTION :
+	//        Counts the applications of F (ops) and the depth, in
+	//        applications of F (levels), of the network built by a
+	//        scan topology on LEN elements.
+	// 
+	// PARAMETERS :
+	//        TOPOLOGY : class
+	//            Sklansky, KoggeStone or BrentKung
+	// 
+	// FUNCTIONS :
+	//        static constexpr std::size_t ops(std::size_t)
+	//        static constexpr std::size_t levels(std::size_t)
+	template <class TOPOLOGY>
+	struct ScanShape;
+
+	// Sklansky is divconq: the right half of each split is
+	// combined with the last element of the left half
+	template <>
+	struct ScanShape<Sklansky>{
+		static constexpr std::size_t left(std::size_t LEN){
+			return std::size_t(1) << (clog2(LEN) - 1);
+		}
+
+		static constexpr std::size_t ops(std::size_t LEN){
+			return LEN <= 1 ? 0 :
+				ops(left(LEN)) + ops(LEN - left(LEN)) + (LEN - left(LEN));
+		}
+
+		static constexpr std::size_t levels(std::size_t LEN){
+			return LEN <= 1 ? 0 :
+				costmax(levels(left(LEN)), levels(LEN - left(LEN))) + 1;
+		}
+	};
+
+	// Kogge-Stone has one level for each STRIDE = 1, 2, 4, ... less
+	// than LEN, with LEN - STRIDE applications
+	template <>
+	struct ScanShape<KoggeStone>{
+		static constexpr std::size_t ops(std::size_t LEN, std::size_t STRIDE = 1){
+			return STRIDE >= LEN ? 0 : (LEN - STRIDE) + ops(LEN, 2 * STRIDE);
+		}
+
+		static constexpr std::size_t levels(std::size_t LEN){
+			return LEN <= 1 ? 0 : clog2(LEN);
+		}
+	};
+
+	// Brent-Kung combines LEN/2 pairs, scans the pairs, and
+	// completes the (LEN-1)/2 remaining even elements. The deepest
+	// element is not always the last, so the depth of each element
+	// is computed.
+	template <>
+	struct ScanShape<BrentKung>{
+		static constexpr std::size_t ops(std::size_t LEN){
+			return LEN <= 1 ? 0 : LEN / 2 + ops(LEN / 2) + (LEN - 1) / 2;
+		}
+
+		// The depth of element IDX of the result
+		static constexpr std::size_t at(std::size_t LEN, std::size_t IDX){
+			return (LEN <= 1 || IDX == 0) ? 0 :
+				(IDX % 2) ? 1 + at(LEN / 2, IDX / 2) : 2 + at(LEN / 2, IDX / 2 - 1);
+		}
+
+		// The largest depth of the elements from LO to HI - 1
+		static constexpr std::size_t deepest(std::size_t LEN, std::size_t LO, std::size_t HI){
+			return (HI - LO == 1) ? at(LEN, LO) :
+				costmax(deepest(LEN, LO, LO + (HI - LO) / 2),
+					deepest(LEN, LO + (HI - LO) / 2, HI));
+		}
+
+		static constexpr std::size_t levels(std::size_t LEN){
+			return LEN <= 1 ? 0 : deepest(LEN, 0, LEN);
+		}
+	};
+
+	template <class FN, typename TA, std::size_t LEN>
+	struct Cost<Map, FN, std::array<TA, LEN> >{
+		typedef typename std::decay<decltype(std::declval<FN const&>()
+						     (std::declval<TA const&>()))>::type type;
+		typedef FunctionCost<FN, TA> fn;
+
+		static constexpr std::size_t ops = LEN * fn::ops;
+		static constexpr std::size_t depth = LEN ? fn::depth : 0;
+		static constexpr std::size_t storage = LEN * fn::storage;
+	};
+
+	template <class FN, typename TA, std::size_t LEN, typename... TS>
+	struct Cost<ZipWith, FN, std::array<TA, LEN>, std::array<TS, LEN>...>{
+		typedef typename std::decay<decltype(std::declval<FN const&>()
+						     (std::declval<TA const&>(),
+						      std::declval<TS const&>()...))>::type type;
+		typedef FunctionCost<FN, TA, TS...> fn;
+
+		static constexpr std::size_t ops = LEN * fn::ops;
+		static constexpr std::size_t depth = LEN ? fn::depth : 0;
+		static constexpr std::size_t storage = LEN * fn::storage;
+	};
+
+	template <class FN, typename TI, typename TA, std::size_t LEN>
+	struct Cost<Lreduce, FN, TI, std::array<TA, LEN> >{
+		typedef FunctionCost<FN, TI, TA> fn;
+
+		static constexpr std::size_t ops = LEN * fn::ops;
+		static constexpr std::size_t depth = LEN * fn::depth;
+		static constexpr std::size_t storage = LEN * fn::storage;
+	};
+
+	template <class FN, typename TA, std::size_t LEN, typename TI>
+	struct Cost<Rreduce, FN, std::array<TA, LEN>, TI>{
+		typedef FunctionCost<FN, TA, TI> fn;
+
+		static constexpr std::size_t ops = LEN * fn::ops;
+		static constexpr std::size_t depth = LEN * fn::depth;
+		static constexpr std::size_t storage = LEN * fn::storage;
+	};
+
+	template <class FN, typename TA, std::size_t LEN>
+	struct Cost<Treereduce, FN, std::array<TA, LEN> >
+		: public TreeCost<FN, TA, LEN, false>{
+		static_assert(LEN > 0, "treereduce requires at least one element");
+	};
+
+	template <class FN, typename T, std::size_t LEN>
+	struct Cost<Divconq, FN, std::array<T, LEN> >
+		: public TreeCost<FN, std::array<T, 1>, LEN, true>{
+		static_assert(LEN > 0, "divconq requires at least one element");
+	};
+
+	template <class FN, typename T, std::size_t LEN>
+	struct Cost<Divconq4, FN, std::array<T, LEN> >
+		: public Tree4Cost<FN, std::array<T, 1>, LEN>{
+		static_assert(LEN > 0, "divconq4 requires at least one element");
+	};
+
+	template <class TOPOLOGY, class FN, typename T, std::size_t LEN>
+	struct Cost<Lscan<TOPOLOGY>, FN, std::array<T, LEN> >{
+		typedef FunctionCost<FN, T, T> fn;
+
+		static constexpr std::size_t ops = ScanShape<TOPOLOGY>::ops(LEN) * fn::ops;
+		static constexpr std::size_t depth = ScanShape<TOPOLOGY>::levels(LEN) * fn::depth;
+		static constexpr std::size_t storage = ScanShape<TOPOLOGY>::ops(LEN) * fn::storage;
+	};
+
+	template <class TOPOLOGY, class FN, typename T, std::size_t LEN>
+	struct Cost<Rscan<TOPOLOGY>, FN, std::array<T, LEN> >
+		: public Cost<Lscan<TOPOLOGY>, FN, std::array<T, LEN> >{
+	};
+
+	template <class FNM, class FNR, typename TI, typename TA, std::size_t LEN,
+		  typename... TS>
+	struct Cost<Mapreduce<Chain>, FNM, FNR, TI, std::array<TA, LEN>,
+		    std::array<TS, LEN>...>{
+		typedef Cost<ZipWith, FNM, std::array<TA, LEN>, std::array<TS, LEN>...> mapped;
+		typedef FunctionCost<FNR, TI, typename mapped::type> fn;
+
+		static constexpr std::size_t ops = mapped::ops + LEN * fn::ops;
+		static constexpr std::size_t depth = mapped::depth + LEN * fn::depth;
+		static constexpr std::size_t storage = mapped::storage + LEN * fn::storage;
+	};
+
+	template <class FNM, class FNR, typename TI, typename TA, std::size_t LEN,
+		  typename... TS>
+	struct Cost<Mapreduce<Tree>, FNM, FNR, TI, std::array<TA, LEN>,
+		    std::array<TS, LEN>...>{
+		typedef Cost<ZipWith, FNM, std::array<TA, LEN>, std::array<TS, LEN>...> mapped;
+		typedef FunctionCost<FNR, TI, typename mapped::type> fn;
+
+		static constexpr std::size_t ops = mapped::ops + LEN * fn::ops;
+		static constexpr std::size_t depth = mapped::depth +
+			((LEN > 1 ? clog2(LEN) : 0) + 1) * fn::depth;
+		static constexpr std::size_t storage = mapped::storage + LEN * fn::storage;
+	};
+
+	template <class FN, typename T, std::size_t LEN>
+	struct Cost<Butterfly, FN, std::array<T, LEN> >{
+		static_assert((LEN & (LEN - 1)) == 0, "butterfly requires a power-of-two length");
+		typedef FunctionCost<FN, std::pair<std::size_t, std::size_t>, std::pair<T, T> > fn;
+
+		static constexpr std::size_t ops = (LEN / 2) * log2(LEN) * fn::ops;
+		static constexpr std::size_t depth = (LEN > 1 ? log2(LEN) : 0) * fn::depth;
+		static constexpr std::size_t storage = (LEN / 2) * log2(LEN) * fn::storage;
+	};
+
+	template <class FN, typename T, std::size_t LEN>
+	struct Cost<RButterfly, FN, std::array<T, LEN> >
+		: public Cost<Butterfly, FN, std::array<T, LEN> >{
+	};
+
+	// FUNCTION :
+	//        cost
+	// 
+	// DESCRIPTION :
+	//        Returns the Cost of applying HOF to F and ARGS...,
+	//        without applying it. The figures are static members
+	//        of the result.
+	//
+	// EXAMPLE :
+	//        std::array<float, 16> a;
+	//        auto c = cost<Treereduce>(std::plus<float>(), a);
+	//        // c.ops === 15, c.depth === 4, c.storage === 15
+	template <class HOF, class FN, typename... AS>
+	constexpr Cost<HOF, FN, AS...> cost(FN const& F, AS const&... ARGS){
+		return Cost<HOF, FN, AS...>();
+	}
+} // namespace hops
+#endif // __COST_HPP
@@ -39,30 +39,46 @@
 // DESCRIPTION :
 //        This file implements the divconq Higher-Order Function that
 //        is useful for implementing explicit recursive tree
-//        algorithms.
+//        algorithms, and divconq4, which divides each array into
+//        four (e.g. for radix-4 algorithms).
 //       
 // NAMESPACES :
 //        hops
+//        hops::dyn
 //
 // PUBLIC MODULES :
 //        Divconq
+//        Divconq4
 // 
 // PRIVATE MODULES :
 //        DivconqHelper
+//        Divconq4Helper
 //
 // PUBLIC VARIABLES :
 //        divconq (an instance of Divconq)
+//        divconq4 (an instance of Divconq4)
 //
 // NOTES :
 //        This file requires a compiler implementing the C++11 standard.
 //
+//        When the input is a view or lazy expression (see view.hpp
+//        and lazy.hpp) it is split into expressions at every level
+//        instead of being copied, and elements are read only at
+//        the leaves.
+//
+//        The hops::dyn namespace defines divconq on runtime-length
+//        arrays (see span.hpp).
+//
 // AUTHOR : Dustin Richmond (drichmond)
 //
 // **********************************************************************
 #ifndef __DIVCONQ_HPP
 #define __DIVCONQ_HPP
 #include <array>
+#include <type_traits>
+#include <utility>
 #include "arrayops.hpp"
+#include "span.hpp"
 namespace hops{
 	// MODULE :
 	//        struct DivconqHelper
@@ -73,18 +89,26 @@ namespace hops{
 	//        Partial Template Specialization
 	// 
 	// PARAMETERS :
-	//        LEV : std::size_t
-	//            Iteration variable for C++ Template
-	//            Meta-Programming.
+	//        LEN : std::size_t
+	//            The length of the input list, and the iteration
+	//            variable for C++ Template Meta-Programming.
 	// 
 	// FUNCTIONS :
-	//        auto operator()(std::array<T, (1<<LEV)>) const
+	//        auto operator()(FN const&, std::array<T, LEN>) const
+	//        auto operator()(FN const&, E const&) const
 	//
 	// NOTES :
-	//        The operator() function can only operate on
-	//        power-of-two-length arrays
-	template <std::size_t LEV>
+	//        The input array is split at the largest power of two
+	//        less than LEN. Power-of-two-length arrays are split
+	//        into equal halves, and for all other lengths the
+	//        left sub-tree is a complete power-of-two tree.
+	template <std::size_t LEN>
 	struct DivconqHelper{
+		// Length of the left sub-array
+		static const std::size_t LLEN = std::size_t(1) << (clog2(LEN) - 1);
+		// Length of the right sub-array
+		static const std::size_t RLEN = LEN - LLEN;
+
 		// FUNCTION :
 		//        operator()
 		// 
@@ -106,7 +130,7 @@ namespace hops{
 		//            Instantiation of the class-wrapped
 		//            function to apply to the input array.
 		//
-		//        IN : std::array<T, (1<<LEV)> const&
+		//        IN : std::array<T, LEN> const&
 		//            The input array to apply the
 		//            Divide-and-Conquer function on.
 		// 
@@ -116,55 +140,67 @@ namespace hops{
 		//        that parameterizes DivconqHelper.
 		//
 		// NOTES :
-		//        The operator() function can only operate on
-		//        power-of-two-length arrays
+		//        When LEN is not a power of two the two
+		//        arguments passed to F may have different
+		//        types, and the right argument may be an
+		//        unmodified one-element leaf array.
 		//
 		//        The trailing const declaration on the
 		//        operator() function is required by our
 		//        library, and indicates to the compiler that
 		//        the method modifies no internal state
 		template <class FN, typename T>
-		auto operator()(FN const& F, std::array<T, (1<<LEV)> const& IN) const
-			-> decltype(F(DivconqHelper<LEV-1>()
-					(F, std::array<T, (1<<(LEV-1))>()),
-					DivconqHelper<LEV-1>()
-					(F, std::array<T, (1<<(LEV-1))>()))) {
+		auto operator()(FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(F(DivconqHelper<LLEN>()
+					(F, std::array<T, LLEN>()),
+					DivconqHelper<RLEN>()
+					(F, std::array<T, RLEN>()))) {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
 
-			auto p = split<(1<<(LEV-1))>(IN);
-			auto dh = DivconqHelper<LEV-1>();
-			return F(dh(F, p.first), dh(F, p.second));
+			auto p = split<LLEN>(IN);
+			return F(DivconqHelper<LLEN>()(F, p.first),
+				DivconqHelper<RLEN>()(F, p.second));
+		}
+
+		// The return type is the same as for an array input
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(DivconqHelper<LEN>()
+				    (F, std::declval<typename E::array_type const&>())) {
+#pragma HLS INLINE
+			auto p = split<LLEN>(IN);
+			return F(DivconqHelper<LLEN>()(F, p.first),
+				DivconqHelper<RLEN>()(F, p.second));
 		}
-		// TODO: In order to handle non-power-of-two-length
-		// arrays, we need overloading (and there's a bug in
-		// GCC)
 	};
 
 	// MODULE :
 	//        struct DivconqHelper
 	// 
 	// DESCRIPTION :
-	//        Implements the base-case (LEV = 1)
+	//        Implements the base-case (LEN = 1)
 	//        Divide-and-Conquer recurisve structure using C++
 	//        Template Meta-Programming and Partial Template
 	//        Specialization
 	// 
 	// FUNCTIONS :
-	//        auto divconq(std::array<T, 2>)
+	//        auto operator()(FN const&, std::array<T, 1>) const
+	//        auto operator()(FN const&, E const&) const
 	//
 	// NOTES :
-	//        The divconq function can only operate on two-element
-	//        arrays
+	//        The base case does not apply the function, it
+	//        returns the one-element leaf array unmodified. A
+	//        one-element expression is evaluated into an array.
 	template<>
 	struct DivconqHelper<1>{
 		// FUNCTION :
-		//        divconq
+		//        operator()
 		// 
 		// DESCRIPTION :
-		//        Implements the Divide-and-Conquer function
-		//        application from within the recursive
-		//        structure defined by DivconqHelper.
+		//        Implements a leaf of the Divide-and-Conquer
+		//        recursive structure defined by
+		//        DivconqHelper.
 		// 
         	// PARAMETERS :
         	//        FN : class (Inferred)
@@ -176,36 +212,33 @@ namespace hops{
 		// ARGUMENTS :
 		//        F : FN const&
 		//            Instantiation of the class-wrapped
-		//            function to apply to the input array.
+		//            function. Unused in the base case.
 		//
-		//        IN : std::array<T, 2> const&
-		//            The input array to apply the
-		//            Divide-and-Conquer function on.
+		//        IN : std::array<T, 1> const&
+		//            The one-element leaf array.
 		// 
-		// RETURNS : auto
-		//        The return type is determined from the
-		//        return type of the class-wrapped function FN
-		//        that parameterizes DivconqHelper.
+		// RETURNS : std::array<T, 1>
+		//        The input array, unmodified.
 		//
 		// NOTES :
-		//        The divconq function can only operate on
-		//        two-element arrays
-		//
 		//        The trailing const declaration on the
 		//        operator() function is required by our
 		//        library, and indicates to the compiler that
 		//        the method modifies no internal state
 		template <class FN, typename T>
-		auto operator()(FN const& F, std::array<T, 2> const& IN) ->
-			decltype(F(std::array<T, 1>(), std::array<T, 1>())){
+		auto operator()(FN const& F, std::array<T, 1> const& IN) const
+			-> std::array<T, 1> {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			auto p = split<1>(IN);
-			return F(p.first, p.second);
+			return IN;
+		}
+
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> typename E::array_type {
+#pragma HLS INLINE
+			return IN.eval();
 		}
-		// TODO: In order to handle non-power-of-2-length
-		// arrays, we need overloading (and there's a bug in
-		// GCC)
 	};
 
 	// MODULE :
@@ -218,10 +251,12 @@ namespace hops{
 	// 
 	// FUNCTIONS :
 	//        auto operator()(FN const& F, std::array<T, LEN>) const
+	//        auto operator()(FN const& F, E const&) const
+	//        auto operator()(P const&, AS const&...) const
 	//
 	// NOTES :
-	//        The operator function can only operate on two-element
-	//        arrays
+	//        The operator() function operates on arrays, views
+	//        and lazy expressions of any non-zero length
 	struct Divconq{
 		// FUNCTION :
 		//        operator()
@@ -256,8 +291,10 @@ namespace hops{
 		//        parameter FN.
 		//
 		// NOTES :
-		//        The operator() function can only operate on
-		//        power-of-two-legnth arrays
+		//        When LEN is not a power of two, F must accept
+		//        arguments of different lengths (the left
+		//        argument is always the result of a complete
+		//        power-of-two sub-tree)
 		//
 		//        The trailing const declaration on the
 		//        operator() function is required by our
@@ -265,10 +302,27 @@ namespace hops{
 		//        the method modifies no internal state
 		template <class FN, typename T, std::size_t LEN>
 		auto operator()(FN const& F, std::array<T, LEN> const& IN) const
-			-> decltype(DivconqHelper<clog2(LEN)>()(F, IN)){
+			-> decltype(DivconqHelper<LEN>()(F, IN)){
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return DivconqHelper<clog2(LEN)>()(F, IN);
+			return DivconqHelper<LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(DivconqHelper<std::tuple_size<typename E::array_type>::value>()
+				    (F, IN)){
+#pragma HLS INLINE
+			return DivconqHelper<std::tuple_size<typename E::array_type>::value>()
+				(F, IN);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.divconq(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.divconq(ARGS...);
 		}
 	};
 
@@ -280,12 +334,320 @@ namespace hops{
 	//        function-like API with the operator() function.
 	// 
 	// EXAMPLE:
-	//            std::array<int, 2> a = {1, 2, 3, 4}, b;
+	//            std::array<int, 4> a = {1, 2, 3, 4}, b;
 	//            b = divconq(concatenate, a); // b = {1, 2, 3, 4}
 	//
+	//            std::array<int, 5> c = {1, 2, 3, 4, 5}, d;
+	//            d = divconq(concatenate, c); // d = {1, 2, 3, 4, 5}
+	//
 	// NOTES :
-	//        The operator() function can only operate on
-	//        power-of-two-legnth arrays
+	//        Arrays are split at the largest power of two less
+	//        than their length, so a LEN-element array produces a
+	//        tree of depth clog2(LEN).
 	Divconq divconq;
+
+	// MODULE :
+	//        struct Divconq4Helper
+	// 
+	// DESCRIPTION :
+	//        Implements the four-way Divide-and-Conquer recursive
+	//        structure. Arrays with a length that is a multiple of
+	//        four are divided into four equal quarters, and the
+	//        results of the quarters are passed to a four-argument
+	//        function. All other arrays are divided in two, as by
+	//        DivconqHelper, and the results of the halves are passed
+	//        to a two-argument function.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input list, and the iteration
+	//            variable for C++ Template Meta-Programming.
+	//
+	//        QUAD : bool
+	//            True when LEN is divided into quarters
+	// 
+	// FUNCTIONS :
+	//        auto operator()(FN const&, std::array<T, LEN>) const
+	//        auto operator()(FN const&, E const&) const
+	template <std::size_t LEN, bool QUAD = (LEN % 4 == 0)>
+	struct Divconq4Helper{
+		// Length of each quarter
+		static const std::size_t QLEN = LEN / 4;
+
+		template <class FN, typename T>
+		auto operator()(FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(F(Divconq4Helper<QLEN>()(F, std::array<T, QLEN>()),
+				      Divconq4Helper<QLEN>()(F, std::array<T, QLEN>()),
+				      Divconq4Helper<QLEN>()(F, std::array<T, QLEN>()),
+				      Divconq4Helper<QLEN>()(F, std::array<T, QLEN>()))) {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			auto h = split<2*QLEN>(IN);
+			auto l = split<QLEN>(h.first);
+			auto r = split<QLEN>(h.second);
+			return F(Divconq4Helper<QLEN>()(F, l.first),
+				Divconq4Helper<QLEN>()(F, l.second),
+				Divconq4Helper<QLEN>()(F, r.first),
+				Divconq4Helper<QLEN>()(F, r.second));
+		}
+
+		// The return type is the same as for an array input
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(Divconq4Helper<LEN>()
+				    (F, std::declval<typename E::array_type const&>())) {
+#pragma HLS INLINE
+			auto h = split<2*QLEN>(IN);
+			auto l = split<QLEN>(h.first);
+			auto r = split<QLEN>(h.second);
+			return F(Divconq4Helper<QLEN>()(F, l.first),
+				Divconq4Helper<QLEN>()(F, l.second),
+				Divconq4Helper<QLEN>()(F, r.first),
+				Divconq4Helper<QLEN>()(F, r.second));
+		}
+	};
+
+	template <std::size_t LEN>
+	struct Divconq4Helper<LEN, false>{
+		// Length of the left sub-array
+		static const std::size_t LLEN = std::size_t(1) << (clog2(LEN) - 1);
+		// Length of the right sub-array
+		static const std::size_t RLEN = LEN - LLEN;
+
+		template <class FN, typename T>
+		auto operator()(FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(F(Divconq4Helper<LLEN>()(F, std::array<T, LLEN>()),
+				      Divconq4Helper<RLEN>()(F, std::array<T, RLEN>()))) {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			auto p = split<LLEN>(IN);
+			return F(Divconq4Helper<LLEN>()(F, p.first),
+				Divconq4Helper<RLEN>()(F, p.second));
+		}
+
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(Divconq4Helper<LEN>()
+				    (F, std::declval<typename E::array_type const&>())) {
+#pragma HLS INLINE
+			auto p = split<LLEN>(IN);
+			return F(Divconq4Helper<LLEN>()(F, p.first),
+				Divconq4Helper<RLEN>()(F, p.second));
+		}
+	};
+
+	// The base case (LEN = 1) returns the one-element leaf array
+	// unmodified, as in DivconqHelper<1>
+	template <>
+	struct Divconq4Helper<1, false> : public DivconqHelper<1>{
+	};
+
+	// MODULE :
+	//        struct Divconq4
+	// 
+	// DESCRIPTION :
+	//        Wraps the four-way Divide-and-Conquer recursive
+	//        structure provided by Divconq4Helper with the ()
+	//        operator to provide a function-like API.
+	// 
+	// FUNCTIONS :
+	//        auto operator()(FN const& F, std::array<T, LEN>) const
+	//        auto operator()(FN const& F, E const&) const
+	//
+	// NOTES :
+	//        F must accept four arguments (the results of four
+	//        quarters) for each level whose length is a multiple
+	//        of four, and two arguments for every other level. A
+	//        power-of-four-length array has only four-argument
+	//        levels, and for the other powers of two the last
+	//        level (two-element arrays) has two arguments.
+	//
+	//        A four-argument level merges the results of four
+	//        sub-trees at once, so a LEN-element array produces a
+	//        tree of depth log4(LEN) when LEN is a power of four.
+	struct Divconq4{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Provides a function-like interface to the
+		//        recursive structure defined by Divconq4Helper.
+		// 
+        	// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a class-wrapped function. 
+        	// 
+        	//        T : typename (Inferred)
+        	//            Type of the std::array values in the input array.
+        	//
+        	//        LEN : std::size_t (Inferred)
+        	//            Length of the std::array input argument
+        	// 
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to the input array.
+		// 
+		//        IN : std::array<T, LEN> const&
+		//            Input array to apply the four-way
+		//            Divide-and-Conquer pattern to.
+		//
+		// RETURNS : auto
+		//        The return type is determined from the
+		//        return type of the class-wrapped function
+		//        parameter FN.
+		template <class FN, typename T, std::size_t LEN>
+		auto operator()(FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(Divconq4Helper<LEN>()(F, IN)){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return Divconq4Helper<LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(Divconq4Helper<std::tuple_size<typename E::array_type>::value>()
+				    (F, IN)){
+#pragma HLS INLINE
+			return Divconq4Helper<std::tuple_size<typename E::array_type>::value>()
+				(F, IN);
+		}
+	};
+
+	// VARIABLE :
+	//        divconq4 (Instance of Divconq4)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Divconq4 struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//            // Radix-4 decimation-in-time FFT
+	//            out = divconq4(radix4, digitreverse(in));
+	Divconq4 divconq4;
+
+	namespace dyn{
+		// MODULE :
+		//        struct Divconq
+		// 
+		// DESCRIPTION :
+		//        Implements the divconq function on runtime-length
+		//        arrays (see span.hpp) with the same tree as
+		//        hops::divconq: a range is split at the largest
+		//        power of two less than its length, and each leaf
+		//        is a one-element std::array.
+		// 
+		// FUNCTIONS :
+		//        auto operator()(FN const&, CA const&) const
+		//
+		// NOTES :
+		//        F is the same function object that is passed to
+		//        hops::divconq. Its result (a node) may differ from
+		//        its arguments (e.g. argmin_t from two leaves), and
+		//        as in hops::divconq a node may be paired with an
+		//        unmodified leaf, so F is called with (leaf, leaf),
+		//        (node, leaf) and (node, node) arguments. Every
+		//        node must have the same type. Functions whose
+		//        result grows with the length of their arguments
+		//        (e.g. concatenate or a merge) have a
+		//        compile-time length in their type, and cannot be
+		//        applied to runtime-length arrays.
+		//
+		//        The tree is computed recursively, with depth
+		//        clog2(N) and N - 1 applications of F.
+		struct Divconq{
+			// The type of the leaves of an input of type CA
+			template <class CA>
+			using Leaf = std::array<typename std::decay<decltype(std::declval<CA const&>().data()[0])>::type, 1>;
+
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Applies F to the leaves of IN with the
+			//        Divide-and-Conquer tree of hops::divconq
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a class-wrapped function. 
+			// 
+			//        CA : class (Inferred)
+			//            Type of the input: a std::vector,
+			//            std::array or Span
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Instantiation of the class-wrapped
+			//            function to apply to the input array.
+			//
+			//        IN : CA const&
+			//            The input array to apply the
+			//            Divide-and-Conquer function on. IN must
+			//            not be empty, and must hold at least two
+			//            elements when the nodes are not leaves.
+			// 
+			// RETURNS : auto
+			//        The result of the root of the tree, with the
+			//        type of F(leaf, leaf)
+			template <class FN, class CA>
+			auto operator()(FN const& F, CA const& IN) const
+				-> typename std::decay<decltype(F(std::declval<Leaf<CA> >(),
+								  std::declval<Leaf<CA> >()))>::type{
+				typedef typename std::decay<decltype(F(std::declval<Leaf<CA> >(),
+								       std::declval<Leaf<CA> >()))>::type N;
+				assert(IN.size() > 0);
+				return root<N>(F, IN.data(), IN.size(), std::is_same<N, Leaf<CA> >());
+			}
+
+		private:
+			// A one-element range is its own root when the nodes
+			// are leaves
+			template <class N, class FN, typename T>
+			static N root(FN const& F, T const* IN, std::size_t LEN, std::true_type LEAF){
+				if(LEN == 1){
+					N leaf = {{IN[0]}};
+					return leaf;
+				}
+				return node<N>(F, IN, LEN);
+			}
+
+			template <class N, class FN, typename T>
+			static N root(FN const& F, T const* IN, std::size_t LEN, std::false_type LEAF){
+				assert(LEN > 1);
+				return node<N>(F, IN, LEN);
+			}
+
+			// Returns the node of a range of LEN > 1 elements
+			template <class N, class FN, typename T>
+			static N node(FN const& F, T const* IN, std::size_t LEN){
+				std::size_t llen = 1;
+				while(2 * llen < LEN){
+					llen *= 2;
+				}
+				std::array<T, 1> last = {{IN[LEN - 1]}};
+				if(LEN == 2){
+					std::array<T, 1> first = {{IN[0]}};
+					return F(first, last);
+				}
+				if(LEN - llen == 1){
+					return F(node<N>(F, IN, llen), last);
+				}
+				return F(node<N>(F, IN, llen), node<N>(F, IN + llen, LEN - llen));
+			}
+		};
+
+		// VARIABLE :
+		//        divconq (Instance of Divconq)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length Divconq struct
+		//        that provides a function-like API with the
+		//        operator() function.
+		// 
+		// EXAMPLE:
+		//            std::vector<int> a = {1, 2, 3, 4, 5};
+		//            int b = dyn::divconq(intsum, a)[0]; // b = 15
+		Divconq divconq;
+	} // namespace dyn
 } // namespace hops
 #endif // __DIVCONQ_HPP
@@ -0,0 +1,1352 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        exec.hpp
+//
+// DESCRIPTION :
+//        This file implements execution policies. An execution
+//        policy is passed as the first argument of a Higher-Order
+//        Function or array operation, and selects how it is
+//        computed, without changing the kernel source:
+//
+//            hops::map(F, IN)                  // template recursion
+//            hops::map(hops::exec::loop, F, IN) // a loop
+//
+//        unrolled : The template-recursive structure in the hops
+//                   namespace (the same as passing no policy)
+//        loop     : A loop over the array indicies
+//        simd     : SIMD vectors for arithmetic element types
+//                   (see simd.hpp), and otherwise a loop over the
+//                   array indicies, with hints for the host
+//                   compiler's vectorizer
+//        parallel : A loop over the array indicies, divided
+//                   between host threads. divconq runs its top
+//                   levels as tasks on a work-stealing thread
+//                   pool.
+//
+//        Policies are accepted by map, zipWith, zip, unzip,
+//        lreduce, rreduce, treereduce, mapreduce, divconq, and the
+//        reverse, prepend, append, concatenate, tail, rrotate,
+//        lrotate, rshift and lshift array operations. Array
+//        operations move data without computation, and are
+//        implemented the same way by every policy.
+//       
+// NAMESPACES :
+//        hops::exec
+//
+// PUBLIC MODULES :
+//        Unrolled
+//        Loop
+//        Simd
+//        Parallel
+//
+// PRIVATE MODULES :
+//        Policy
+//        Indexed
+//        DivconqLevel
+//        DivconqLevelHelper
+//        TaskGroup
+//        TaskPool
+//        DivconqFork
+//
+// PUBLIC VARIABLES :
+//        unrolled (Instance of Unrolled)
+//        loop (Instance of Loop)
+//        simd (Instance of Simd)
+//        parallel (Instance of Parallel)
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        The loop, simd and parallel policies hold each
+//        intermediate value in a variable of a single type. The
+//        function passed to lreduce, rreduce and treereduce must
+//        therefore return the same type as its accumulator
+//        argument; this is checked with static_assert.
+//        The loop and parallel policies apply the function of
+//        treereduce to the same pairs as the unrolled policy, so
+//        their results are equal even when the function is not
+//        associative (e.g. floating-point addition). The simd
+//        policy reduces the lanes of vectors first, and pairs
+//        elements differently.
+//
+//        The simd and parallel policies target host builds.
+//        During synthesis (when __SYNTHESIS__ is defined) they
+//        are the same as the loop policy.
+//
+//        Inside the hops::exec namespace, loop names the policy
+//        and not the hops::loop namespace.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __EXEC_HPP
+#define __EXEC_HPP
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#ifndef __SYNTHESIS__
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+#include "arrayops.hpp"
+#include "map.hpp"
+#include "zip.hpp"
+#include "reduce.hpp"
+#include "mapreduce.hpp"
+#include "divconq.hpp"
+#include "simd.hpp"
+namespace hops{
+namespace exec{
+	// MODULE :
+	//        struct Policy
+	// 
+	// DESCRIPTION :
+	//        Base of every execution policy. It defines the
+	//        policy_type member type that identifies a policy (see
+	//        IsPolicy in arrayops.hpp) and forwards the array
+	//        operations to their implementations in the hops
+	//        namespace.
+	// 
+	// FUNCTIONS :
+	//        auto reverse(AS const&...) const
+	//        auto prepend(AS const&...) const
+	//        auto append(AS const&...) const
+	//        auto concatenate(AS const&...) const
+	//        auto tail(AS const&...) const
+	//        auto rrotate(AS const&...) const
+	//        auto lrotate(AS const&...) const
+	//        auto rshift(AS const&...) const
+	//        auto lshift(AS const&...) const
+	struct Policy{
+		typedef Policy policy_type;
+
+		template <class... AS>
+		auto reverse(AS const&... ARGS) const
+			-> decltype(hops::reverse(ARGS...)){
+#pragma HLS INLINE
+			return hops::reverse(ARGS...);
+		}
+
+		template <class... AS>
+		auto prepend(AS const&... ARGS) const
+			-> decltype(hops::prepend(ARGS...)){
+#pragma HLS INLINE
+			return hops::prepend(ARGS...);
+		}
+
+		template <class... AS>
+		auto append(AS const&... ARGS) const
+			-> decltype(hops::append(ARGS...)){
+#pragma HLS INLINE
+			return hops::append(ARGS...);
+		}
+
+		template <class... AS>
+		auto concatenate(AS const&... ARGS) const
+			-> decltype(hops::concatenate(ARGS...)){
+#pragma HLS INLINE
+			return hops::concatenate(ARGS...);
+		}
+
+		template <class... AS>
+		auto tail(AS const&... ARGS) const
+			-> decltype(hops::tail(ARGS...)){
+#pragma HLS INLINE
+			return hops::tail(ARGS...);
+		}
+
+		template <class... AS>
+		auto rrotate(AS const&... ARGS) const
+			-> decltype(hops::rrotate(ARGS...)){
+#pragma HLS INLINE
+			return hops::rrotate(ARGS...);
+		}
+
+		template <class... AS>
+		auto lrotate(AS const&... ARGS) const
+			-> decltype(hops::lrotate(ARGS...)){
+#pragma HLS INLINE
+			return hops::lrotate(ARGS...);
+		}
+
+		template <class... AS>
+		auto rshift(AS const&... ARGS) const
+			-> decltype(hops::rshift(ARGS...)){
+#pragma HLS INLINE
+			return hops::rshift(ARGS...);
+		}
+
+		template <class... AS>
+		auto lshift(AS const&... ARGS) const
+			-> decltype(hops::lshift(ARGS...)){
+#pragma HLS INLINE
+			return hops::lshift(ARGS...);
+		}
+	};
+
+	// MODULE :
+	//        struct Unrolled
+	// 
+	// DESCRIPTION :
+	//        Execution policy that forwards every function to the
+	//        template-recursive implementation in the hops
+	//        namespace. The result is the fully unrolled hardware
+	//        structure of the function.
+	// 
+	// FUNCTIONS :
+	//        auto map(AS const&...) const
+	//        auto zipWith(AS const&...) const
+	//        auto zip(AS const&...) const
+	//        auto unzip(AS const&...) const
+	//        auto lreduce(AS const&...) const
+	//        auto rreduce(AS const&...) const
+	//        auto treereduce(AS const&...) const
+	//        auto mapreduce<TOPOLOGY>(AS const&...) const
+	//        auto divconq(AS const&...) const
+	struct Unrolled : public Policy{
+		template <class... AS>
+		auto map(AS const&... ARGS) const
+			-> decltype(hops::map(ARGS...)){
+#pragma HLS INLINE
+			return hops::map(ARGS...);
+		}
+
+		template <class... AS>
+		auto zipWith(AS const&... ARGS) const
+			-> decltype(hops::zipWith(ARGS...)){
+#pragma HLS INLINE
+			return hops::zipWith(ARGS...);
+		}
+
+		template <class... AS>
+		auto zip(AS const&... ARGS) const
+			-> decltype(hops::zip(ARGS...)){
+#pragma HLS INLINE
+			return hops::zip(ARGS...);
+		}
+
+		template <class... AS>
+		auto unzip(AS const&... ARGS) const
+			-> decltype(hops::unzip(ARGS...)){
+#pragma HLS INLINE
+			return hops::unzip(ARGS...);
+		}
+
+		template <class... AS>
+		auto lreduce(AS const&... ARGS) const
+			-> decltype(hops::lreduce(ARGS...)){
+#pragma HLS INLINE
+			return hops::lreduce(ARGS...);
+		}
+
+		template <class... AS>
+		auto rreduce(AS const&... ARGS) const
+			-> decltype(hops::rreduce(ARGS...)){
+#pragma HLS INLINE
+			return hops::rreduce(ARGS...);
+		}
+
+		template <class... AS>
+		auto treereduce(AS const&... ARGS) const
+			-> decltype(hops::treereduce(ARGS...)){
+#pragma HLS INLINE
+			return hops::treereduce(ARGS...);
+		}
+
+		template <class TOPOLOGY, class... AS>
+		auto mapreduce(AS const&... ARGS) const
+			-> decltype(Mapreduce<TOPOLOGY>()(ARGS...)){
+#pragma HLS INLINE
+			return Mapreduce<TOPOLOGY>()(ARGS...);
+		}
+
+		template <class... AS>
+		auto divconq(AS const&... ARGS) const
+			-> decltype(hops::divconq(ARGS...)){
+#pragma HLS INLINE
+			return hops::divconq(ARGS...);
+		}
+	};
+
+	// MODULE :
+	//        struct DivconqLevel
+	// 
+	// DESCRIPTION :
+	//        Computes divconq on a power-of-two number of nodes, one
+	//        level of the tree at a time. Each level applies F to
+	//        every pair of adjacent nodes with the apply function of
+	//        the policy, and the next level is computed on the
+	//        results. The template recursion is over levels, so its
+	//        depth is log2(N).
+	// 
+	// PARAMETERS :
+	//        N : std::size_t
+	//            The number of nodes in the current level
+	//
+	// FUNCTIONS :
+	//        auto operator()(P const&, FN const&,
+	//                        std::array<X, N> const&) const
+	template <std::size_t N>
+	struct DivconqLevel{
+		template <class P, class FN, typename X>
+		auto operator()(P const& POLICY, FN const& F,
+				std::array<X, N> const& NODES) const
+			-> decltype(DivconqLevel<N/2>()(POLICY, F,
+				std::declval<std::array<decltype(F(NODES[0], NODES[0])), N/2> const&>())){
+#pragma HLS INLINE
+			std::array<decltype(F(NODES[0], NODES[0])), N/2> next;
+			POLICY.apply(N/2, [&](std::size_t i){
+					next[i] = F(NODES[2*i], NODES[2*i + 1]);
+				});
+			return DivconqLevel<N/2>()(POLICY, F, next);
+		}
+	};
+
+	template <>
+	struct DivconqLevel<1>{
+		template <class P, class FN, typename X>
+		auto operator()(P const& POLICY, FN const& F,
+				std::array<X, 1> const& NODES) const
+			-> X{
+#pragma HLS INLINE
+			return NODES[0];
+		}
+	};
+
+	// MODULE :
+	//        struct DivconqLevelHelper
+	// 
+	// DESCRIPTION :
+	//        Divides the input array the same way as DivconqHelper
+	//        (see divconq.hpp) until the length is a power of two,
+	//        then computes each power-of-two part with DivconqLevel.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input array
+	//
+	//        POW2 : bool
+	//            True when LEN is a power of two (Inferred)
+	//
+	// FUNCTIONS :
+	//        auto operator()(P const&, FN const&,
+	//                        std::array<T, LEN> const&) const
+	template <std::size_t LEN, bool POW2 = ((LEN & (LEN - 1)) == 0)>
+	struct DivconqLevelHelper{
+		static const std::size_t LLEN = DivconqHelper<LEN>::LLEN;
+		static const std::size_t RLEN = DivconqHelper<LEN>::RLEN;
+
+		template <class P, class FN, typename T>
+		auto operator()(P const& POLICY, FN const& F,
+				std::array<T, LEN> const& IN) const
+			-> decltype(F(DivconqLevelHelper<LLEN>()
+					(POLICY, F, std::array<T, LLEN>()),
+					DivconqLevelHelper<RLEN>()
+					(POLICY, F, std::array<T, RLEN>()))){
+#pragma HLS INLINE
+			auto p = split<LLEN>(IN);
+			return F(DivconqLevelHelper<LLEN>()(POLICY, F, p.first),
+				DivconqLevelHelper<RLEN>()(POLICY, F, p.second));
+		}
+	};
+
+	template <std::size_t LEN>
+	struct DivconqLevelHelper<LEN, true>{
+		template <class P, class FN, typename T>
+		auto operator()(P const& POLICY, FN const& F,
+				std::array<T, LEN> const& IN) const
+			-> decltype(DivconqLevel<LEN>()(POLICY, F,
+				std::declval<std::array<std::array<T, 1>, LEN> const&>())){
+#pragma HLS INLINE
+			std::array<std::array<T, 1>, LEN> leaves;
+			POLICY.apply(LEN, [&](std::size_t i){
+					leaves[i][0] = IN[i];
+				});
+			return DivconqLevel<LEN>()(POLICY, F, leaves);
+		}
+	};
+
+	// MODULE :
+	//        struct Indexed
+	// 
+	// DESCRIPTION :
+	//        Implements the Higher-Order Functions as loops over
+	//        array indicies for the loop, simd and parallel
+	//        policies. Every loop is run by the apply function of
+	//        the derived policy P, which calls a function on each
+	//        index from 0 to N-1. Loops that carry a value from one
+	//        index to the next (lreduce and rreduce) are sequential
+	//        in every policy.
+	// 
+	// PARAMETERS :
+	//        P : class
+	//            The derived policy, which implements
+	//            void apply(std::size_t N, BODY const&) const
+	//
+	// FUNCTIONS :
+	//        auto map(FN const&, std::array<TA, LEN> const&) const
+	//        auto zipWith(FN const&, std::array<TA, LEN> const&,
+	//                     std::array<TS, LEN> const&...) const
+	//        auto zip(std::array<TL, LEN> const&,
+	//                 std::array<TR, LEN> const&) const
+	//        auto zip(std::array<TA, LEN> const&,
+	//                 std::array<TB, LEN> const&,
+	//                 std::array<TC, LEN> const&,
+	//                 std::array<TS, LEN> const&...) const
+	//        auto unzip(std::array<std::pair<TL, TR>, LEN> const&) const
+	//        auto unzip(std::array<std::tuple<TS...>, LEN> const&) const
+	//        auto lreduce(FN const&, TI const&,
+	//                     std::array<TA, LEN> const&) const
+	//        auto rreduce(FN const&, std::array<TA, LEN> const&,
+	//                     TI const&) const
+	//        auto treereduce(FN const&, std::array<TA, LEN> const&) const
+	//        TI mapreduce<TOPOLOGY>(FNM const&, FNR const&, TI const&,
+	//                               std::array<TA, LEN> const&,
+	//                               std::array<TS, LEN> const&...) const
+	//        auto divconq(FN const&, std::array<T, LEN> const&) const
+	template <class P>
+	struct Indexed : public Policy{
+		template <class FN, typename TA, std::size_t LEN>
+		auto map(FN const& F, std::array<TA, LEN> const& IN) const
+			-> std::array<decltype(F(IN[0])), LEN>{
+#pragma HLS INLINE
+			std::array<decltype(F(IN[0])), LEN> res;
+			self().apply(LEN, [&](std::size_t i){
+					res[i] = F(IN[i]);
+				});
+			return res;
+		}
+
+		template <class FN, typename TA, std::size_t LEN, typename... TS>
+		auto zipWith(FN const& F, std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(A[0], IN[0]...)), LEN>{
+#pragma HLS INLINE
+			std::array<decltype(F(A[0], IN[0]...)), LEN> res;
+			self().apply(LEN, [&](std::size_t i){
+					res[i] = F(A[i], IN[i]...);
+				});
+			return res;
+		}
+
+		template <typename TL, typename TR, std::size_t LEN>
+		auto zip(std::array<TL, LEN> const& L,
+			std::array<TR, LEN> const& R) const
+			-> std::array<std::pair<TL, TR>, LEN>{
+#pragma HLS INLINE
+			std::array<std::pair<TL, TR>, LEN> res;
+			self().apply(LEN, [&](std::size_t i){
+					res[i] = std::pair<TL, TR>(L[i], R[i]);
+				});
+			return res;
+		}
+
+		template <typename TA, typename TB, typename TC, std::size_t LEN,
+			  typename... TS>
+		auto zip(std::array<TA, LEN> const& A,
+			std::array<TB, LEN> const& B,
+			std::array<TC, LEN> const& C,
+			std::array<TS, LEN> const&... IN) const
+			-> std::array<std::tuple<TA, TB, TC, TS...>, LEN>{
+#pragma HLS INLINE
+			std::array<std::tuple<TA, TB, TC, TS...>, LEN> res;
+			self().apply(LEN, [&](std::size_t i){
+					res[i] = std::tuple<TA, TB, TC, TS...>(A[i], B[i], C[i], IN[i]...);
+				});
+			return res;
+		}
+
+		template <typename TL, typename TR, std::size_t LEN>
+		auto unzip(std::array<std::pair<TL, TR>, LEN> const& IN) const
+			-> std::pair<std::array<TL, LEN>, std::array<TR, LEN> >{
+#pragma HLS INLINE
+			std::pair<std::array<TL, LEN>, std::array<TR, LEN> > res;
+			self().apply(LEN, [&](std::size_t i){
+					res.first[i] = IN[i].first;
+					res.second[i] = IN[i].second;
+				});
+			return res;
+		}
+
+		template <typename... TS, std::size_t LEN>
+		auto unzip(std::array<std::tuple<TS...>, LEN> const& IN) const
+			-> std::tuple<std::array<TS, LEN>...>{
+#pragma HLS INLINE
+			std::tuple<std::array<TS, LEN>...> res;
+			self().apply(LEN, [&](std::size_t i){
+					assign(res, IN[i], i, make_index_sequence<sizeof...(TS)>());
+				});
+			return res;
+		}
+
+		template <class FN, typename TI, typename TA, std::size_t LEN>
+		auto lreduce(FN const& F, TI const& INIT,
+			std::array<TA, LEN> const& IN) const
+			-> decltype(hops::lreduce(F, INIT, IN)){
+#pragma HLS INLINE
+			typedef decltype(hops::lreduce(F, INIT, IN)) R;
+			auto const& G = ReduceChain<FN, TA, LEN>::step(F);
+			static_assert(LEN == 0 || std::is_same<R,
+				      decltype(G(std::declval<R const&>(), IN[0]))>::value,
+				      "lreduce with a loop policy requires F(R, TA) to return R");
+			R acc = ReduceChain<FN, TA, LEN>::init(INIT);
+			for(std::size_t i = 0; i < LEN; ++i){
+				acc = G(acc, IN[i]);
+			}
+			return acc;
+		}
+
+		template <class FN, typename TA, std::size_t LEN, typename TI>
+		auto rreduce(FN const& F, std::array<TA, LEN> const& IN,
+			TI const& INIT) const
+			-> decltype(hops::rreduce(F, IN, INIT)){
+#pragma HLS INLINE
+			typedef decltype(hops::rreduce(F, IN, INIT)) R;
+			auto const& G = ReduceChain<FN, TA, LEN>::step(F);
+			static_assert(LEN == 0 || std::is_same<R,
+				      decltype(G(IN[0], std::declval<R const&>()))>::value,
+				      "rreduce with a loop policy requires F(TA, R) to return R");
+			R acc = ReduceChain<FN, TA, LEN>::init(INIT);
+			for(std::size_t i = LEN; i > 0; --i){
+				acc = G(IN[i - 1], acc);
+			}
+			return acc;
+		}
+
+		template <class FN, typename TA, std::size_t LEN>
+		auto treereduce(FN const& F, std::array<TA, LEN> const& IN) const
+			-> decltype(hops::treereduce(F, IN)){
+#pragma HLS INLINE
+			typedef decltype(hops::treereduce(F, IN)) R;
+			static_assert(LEN == 1 || std::is_same<R,
+				      decltype(F(std::declval<R const&>(), std::declval<R const&>()))>::value,
+				      "treereduce with a loop policy requires F(R, R) to return R");
+			// hops::treereduce divides a range of L elements
+			// into L/2 and L - L/2. The node reached by the
+			// path of bits p (first bit as the most
+			// significant) at depth d covers
+			// (LEN + reverse(p)) / 2^d elements, so every
+			// node at depth K = floor(log2(LEN)) covers one or two
+			// elements, and the levels above K are a complete
+			// binary tree. Pairing the same elements keeps
+			// the results of unrolled and loop policies equal
+			// when F is not associative.
+			static const std::size_t K = clog2(LEN + 1) - 1;
+			static const std::size_t M = std::size_t(1) << K;
+			std::array<R, M> a, b;
+			std::array<std::size_t, M> start;
+			R* src = a.data();
+			R* dst = b.data();
+			for(std::size_t i = 0, s = 0; i < M; ++i){
+				start[i] = s;
+				s += pairs(i, K, LEN) ? 2 : 1;
+			}
+			self().apply(M, [&](std::size_t i){
+					if(pairs(i, K, LEN)){
+						src[i] = F(IN[start[i]], IN[start[i] + 1]);
+					} else {
+						src[i] = IN[start[i]];
+					}
+				});
+			for(std::size_t n = M; n > 1; n /= 2){
+				self().apply(n / 2, [&](std::size_t i){
+						dst[i] = F(src[2*i], src[2*i + 1]);
+					});
+				std::swap(src, dst);
+			}
+			return src[0];
+		}
+
+		template <class TOPOLOGY, class FNM, class FNR, typename TI,
+			  typename TA, std::size_t LEN, typename... TS>
+		TI mapreduce(FNM const& M, FNR const& R, TI const& INIT,
+			std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS INLINE
+			return fold(std::is_same<TOPOLOGY, Tree>(), M, R, INIT, A, IN...);
+		}
+
+		template <class FN, typename T, std::size_t LEN>
+		auto divconq(FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(hops::divconq(F, IN)){
+#pragma HLS INLINE
+			return DivconqLevelHelper<LEN>()(self(), F, IN);
+		}
+
+	private:
+		P const& self() const{
+#pragma HLS INLINE
+			return static_cast<P const&>(*this);
+		}
+
+		// True when node I at depth K of the tree of
+		// hops::treereduce over LEN elements covers two
+		// elements: LEN + reverse(I) >= 2^(K+1), where reverse
+		// reverses the K bits of I
+		static bool pairs(std::size_t I, std::size_t K, std::size_t LEN){
+#pragma HLS INLINE
+			std::size_t r = 0;
+			for(std::size_t j = 0; j < K; ++j){
+				r = (r << 1) | ((I >> j) & 1);
+			}
+			return LEN + r >= (std::size_t(2) << K);
+		}
+
+		// The Chain topology of mapreduce: a sequential loop
+		template <class FNM, class FNR, typename TI, typename TA,
+			  std::size_t LEN, typename... TS>
+		TI fold(std::false_type TREE, FNM const& M, FNR const& R,
+			TI const& INIT, std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS INLINE
+			TI acc = INIT;
+			for(std::size_t i = 0; i < LEN; ++i){
+				acc = R(acc, M(A[i], IN[i]...));
+			}
+			return acc;
+		}
+
+		// The Tree topology of mapreduce: a map, then a
+		// treereduce
+		template <class FNM, class FNR, typename TI, typename TA,
+			  std::size_t LEN, typename... TS>
+		TI fold(std::true_type TREE, FNM const& M, FNR const& R,
+			TI const& INIT, std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS INLINE
+			static_assert(LEN > 0, "Tree requires at least one lane");
+			return R(INIT, self().treereduce(R, self().zipWith(M, A, IN...)));
+		}
+
+		// Writes element POS of T to index IDX of array POS in
+		// OUT, for every POS
+		template <typename... TS, std::size_t LEN, std::size_t... POS>
+		static void assign(std::tuple<std::array<TS, LEN>...>& OUT,
+				std::tuple<TS...> const& T, std::size_t IDX,
+				index_sequence<POS...> PSEQ){
+#pragma HLS INLINE
+			int unused[] = {0, (std::get<POS>(OUT)[IDX] = std::get<POS>(T), 0)...};
+			(void)unused;
+		}
+	};
+
+	// MODULE :
+	//        struct Loop
+	// 
+	// DESCRIPTION :
+	//        Execution policy that computes every function as a
+	//        loop over the array indicies. In hardware the loops are
+	//        not unrolled, so one copy of the function is shared by
+	//        every index.
+	// 
+	// FUNCTIONS :
+	//        void apply(std::size_t, BODY const&) const
+	struct Loop : public Indexed<Loop>{
+		// FUNCTION :
+		//        apply
+		// 
+		// DESCRIPTION :
+		//        Calls B on each index from 0 to N-1, in order
+		// 
+		// PARAMETERS :
+		//        BODY : class (Inferred)
+		//            Type of a function taking an index
+		//
+		// ARGUMENTS :
+		//        N : std::size_t
+		//            The number of indicies
+		//
+		//        B : BODY const&
+		//            The loop body
+		template <class BODY>
+		void apply(std::size_t N, BODY const& B) const{
+#pragma HLS INLINE
+		apply_loop:
+			for(std::size_t i = 0; i < N; ++i){
+				B(i);
+			}
+		}
+	};
+
+	// MODULE :
+	//        struct Simd
+	// 
+	// DESCRIPTION :
+	//        Execution policy for vectorized host builds. map,
+	//        zipWith, treereduce and mapreduce are computed with
+	//        the SIMD kernels in simd.hpp when the element type and
+	//        function have a SIMD form (see SimdCallable). Other
+	//        loops are marked as free of loop-carried dependencies,
+	//        so the host compiler can vectorize them.
+	// 
+	// FUNCTIONS :
+	//        void apply(std::size_t, BODY const&) const
+	//        auto map(FN const&, std::array<TA, LEN> const&) const
+	//        auto zipWith(FN const&, std::array<TA, LEN> const&,
+	//                     std::array<TS, LEN> const&...) const
+	//        auto treereduce(FN const&, std::array<TA, LEN> const&) const
+	//        TI mapreduce<TOPOLOGY>(FNM const&, FNR const&, TI const&,
+	//                               std::array<TA, LEN> const&,
+	//                               std::array<TS, LEN> const&...) const
+	//
+	// NOTES :
+	//        A vectorized treereduce, or mapreduce with the Tree
+	//        topology, reduces the elements in a different order
+	//        than the unrolled policy, so floating-point results
+	//        can differ in rounding. A mapreduce with the Chain
+	//        topology is only vectorized when the order does not
+	//        change the result (see SimdExact).
+	//
+	//        The SIMD form of std::multiplies<std::complex<float>>
+	//        does not handle infinite and NaN operands the way
+	//        std::complex does.
+	struct Simd : public Indexed<Simd>{
+		// FUNCTION :
+		//        apply
+		// 
+		// DESCRIPTION :
+		//        Calls B on each index from 0 to N-1. Calls on
+		//        different indicies must be independent.
+		// 
+		// PARAMETERS :
+		//        BODY : class (Inferred)
+		//            Type of a function taking an index
+		//
+		// ARGUMENTS :
+		//        N : std::size_t
+		//            The number of indicies
+		//
+		//        B : BODY const&
+		//            The loop body
+		template <class BODY>
+		void apply(std::size_t N, BODY const& B) const{
+#pragma HLS INLINE
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SYNTHESIS__)
+#pragma GCC ivdep
+#endif
+			for(std::size_t i = 0; i < N; ++i){
+				B(i);
+			}
+		}
+
+		template <class FN, typename TA, std::size_t LEN>
+		auto map(FN const& F, std::array<TA, LEN> const& IN) const
+			-> std::array<decltype(F(IN[0])), LEN>{
+#pragma HLS INLINE
+			return map(F, IN, SimdCallable<FN, std::tuple<TA> >());
+		}
+
+		template <class FN, typename TA, std::size_t LEN, typename... TS>
+		auto zipWith(FN const& F, std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(A[0], IN[0]...)), LEN>{
+#pragma HLS INLINE
+			return zipWith(SimdCallable<FN, std::tuple<TA, TS...> >(), F, A, IN...);
+		}
+
+		template <class FN, typename TA, std::size_t LEN>
+		auto treereduce(FN const& F, std::array<TA, LEN> const& IN) const
+			-> decltype(hops::treereduce(F, IN)){
+#pragma HLS INLINE
+			return treereduce(F, IN, std::integral_constant<bool,
+					  SimdCallable<FN, std::tuple<TA, TA> >::value &&
+					  (LEN >= 2 * SimdType<TA>::width)>());
+		}
+
+		template <class TOPOLOGY, class FNM, class FNR, typename TI,
+			  typename TA, std::size_t LEN, typename... TS>
+		TI mapreduce(FNM const& M, FNR const& R, TI const& INIT,
+			std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS INLINE
+			return fused<TOPOLOGY>(std::integral_constant<bool,
+					       SimdCallable<FNM, std::tuple<TA, TS...> >::value &&
+					       SimdCallable<FNR, std::tuple<TA, TA> >::value &&
+					       std::is_same<TI, TA>::value &&
+					       (LEN >= SimdType<TA>::width) &&
+					       (std::is_same<TOPOLOGY, Tree>::value ||
+						SimdExact<FNR, TA>::value)>(),
+					       M, R, INIT, A, IN...);
+		}
+
+	private:
+		template <class FN, typename TA, std::size_t LEN>
+		std::array<TA, LEN> map(FN const& F, std::array<TA, LEN> const& IN,
+					std::true_type VECTOR) const{
+			std::array<TA, LEN> res;
+			SimdHelper<TA>::zipWith(F, LEN, res.data(), IN.data());
+			return res;
+		}
+
+		template <class FN, typename TA, std::size_t LEN>
+		auto map(FN const& F, std::array<TA, LEN> const& IN,
+			 std::false_type VECTOR) const
+			-> std::array<decltype(F(IN[0])), LEN>{
+#pragma HLS INLINE
+			return Indexed<Simd>::map(F, IN);
+		}
+
+		template <class FN, typename TA, std::size_t LEN, typename... TS>
+		std::array<TA, LEN> zipWith(std::true_type VECTOR, FN const& F,
+					    std::array<TA, LEN> const& A,
+					    std::array<TS, LEN> const&... IN) const{
+			std::array<TA, LEN> res;
+			SimdHelper<TA>::zipWith(F, LEN, res.data(), A.data(), IN.data()...);
+			return res;
+		}
+
+		template <class FN, typename TA, std::size_t LEN, typename... TS>
+		auto zipWith(std::false_type VECTOR, FN const& F,
+			     std::array<TA, LEN> const& A,
+			     std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(A[0], IN[0]...)), LEN>{
+#pragma HLS INLINE
+			return Indexed<Simd>::zipWith(F, A, IN...);
+		}
+
+		template <class FN, typename TA, std::size_t LEN>
+		TA treereduce(FN const& F, std::array<TA, LEN> const& IN,
+			      std::true_type VECTOR) const{
+			return SimdHelper<TA>::treereduce(F, LEN, IN.data());
+		}
+
+		template <class FN, typename TA, std::size_t LEN>
+		auto treereduce(FN const& F, std::array<TA, LEN> const& IN,
+				std::false_type VECTOR) const
+			-> decltype(hops::treereduce(F, IN)){
+#pragma HLS INLINE
+			return Indexed<Simd>::treereduce(F, IN);
+		}
+
+		template <class TOPOLOGY, class FNM, class FNR, typename TI,
+			  typename TA, std::size_t LEN, typename... TS>
+		TI fused(std::true_type VECTOR, FNM const& M, FNR const& R,
+			 TI const& INIT, std::array<TA, LEN> const& A,
+			 std::array<TS, LEN> const&... IN) const{
+			return R(INIT, SimdHelper<TA>::mapreduce(M, R, LEN, A.data(), IN.data()...));
+		}
+
+		template <class TOPOLOGY, class FNM, class FNR, typename TI,
+			  typename TA, std::size_t LEN, typename... TS>
+		TI fused(std::false_type VECTOR, FNM const& M, FNR const& R,
+			 TI const& INIT, std::array<TA, LEN> const& A,
+			 std::array<TS, LEN> const&... IN) const{
+#pragma HLS INLINE
+			return Indexed<Simd>::mapreduce<TOPOLOGY>(M, R, INIT, A, IN...);
+		}
+	};
+
+#ifndef __SYNTHESIS__
+	// MODULE :
+	//        struct TaskGroup
+	// 
+	// DESCRIPTION :
+	//        Counts the tasks spawned on a TaskPool that have not
+	//        finished, so that the thread that spawned them can
+	//        wait for them (see TaskPool::wait).
+	struct TaskGroup{
+		std::atomic<std::size_t> pending;
+
+		TaskGroup() : pending(0){
+		}
+	};
+
+	// MODULE :
+	//        struct TaskPool
+	// 
+	// DESCRIPTION :
+	//        A work-stealing thread pool for host builds. Each
+	//        worker thread owns a queue of tasks. A worker pushes
+	//        the tasks it spawns to the back of its own queue and
+	//        takes tasks from the back (newest first); when its
+	//        queue is empty it steals from the front (oldest first)
+	//        of the other queues. Tasks spawned by other threads are
+	//        distributed between the queues. Idle workers sleep
+	//        until a task is pushed.
+	// 
+	// FUNCTIONS :
+	//        TaskPool(std::size_t)
+	//        std::size_t size() const
+	//        void spawn(TaskGroup&, BODY const&)
+	//        void wait(TaskGroup&)
+	//
+	// NOTES :
+	//        A thread that waits for a TaskGroup runs queued tasks
+	//        until the group is finished, so tasks can spawn and
+	//        wait for tasks without deadlock.
+	struct TaskPool{
+		// FUNCTION :
+		//        TaskPool
+		// 
+		// DESCRIPTION :
+		//        Starts WORKERS worker threads
+		// 
+		// ARGUMENTS :
+		//        WORKERS : std::size_t
+		//            The number of worker threads. Must be at
+		//            least 1.
+		explicit TaskPool(std::size_t WORKERS)
+			: queues(WORKERS), queued(0), next(0), stop(false){
+			for(std::size_t i = 0; i < WORKERS; ++i){
+				queues[i].reset(new Queue());
+			}
+			for(std::size_t i = 0; i < WORKERS; ++i){
+				workers.emplace_back([this, i](){
+						work(i);
+					});
+			}
+		}
+
+		~TaskPool(){
+			{
+				std::lock_guard<std::mutex> lock(sleep);
+				stop = true;
+			}
+			wake.notify_all();
+			for(std::thread& t : workers){
+				t.join();
+			}
+		}
+
+		TaskPool(TaskPool const&) = delete;
+		TaskPool& operator=(TaskPool const&) = delete;
+
+		std::size_t size() const{
+			return workers.size();
+		}
+
+		// FUNCTION :
+		//        spawn
+		// 
+		// DESCRIPTION :
+		//        Queues B to run on the pool, as a member of G
+		// 
+		// PARAMETERS :
+		//        BODY : class (Inferred)
+		//            Type of a function taking no arguments
+		//
+		// ARGUMENTS :
+		//        G : TaskGroup&
+		//            The group of the task. G must not be
+		//            destroyed before wait(G) returns.
+		//
+		//        B : BODY const&
+		//            The task
+		template <class BODY>
+		void spawn(TaskGroup& G, BODY const& B){
+			TaskGroup* group = &G;
+			group->pending.fetch_add(1);
+			push(std::function<void()>([group, B](){
+						B();
+						group->pending.fetch_sub(1);
+					}));
+		}
+
+		// FUNCTION :
+		//        wait
+		// 
+		// DESCRIPTION :
+		//        Runs queued tasks until every task in G has
+		//        finished
+		// 
+		// ARGUMENTS :
+		//        G : TaskGroup&
+		//            The group to wait for
+		void wait(TaskGroup& G){
+			while(G.pending.load() != 0){
+				if(!run(current())){
+					std::this_thread::yield();
+				}
+			}
+		}
+
+	private:
+		struct Queue{
+			std::mutex lock;
+			std::deque<std::function<void()> > tasks;
+		};
+
+		// The pool and queue of the calling thread
+		struct Worker{
+			TaskPool const* pool;
+			std::size_t index;
+		};
+
+		std::vector<std::unique_ptr<Queue> > queues;
+		std::vector<std::thread> workers;
+		// The number of tasks in all queues
+		std::atomic<std::size_t> queued;
+		// The queue of the next task spawned by another thread
+		std::atomic<std::size_t> next;
+		std::mutex sleep;
+		std::condition_variable wake;
+		bool stop;
+
+		static Worker& self(){
+			static thread_local Worker worker = {nullptr, 0};
+			return worker;
+		}
+
+		// Returns the queue index of the calling thread, or
+		// size() when it is not a worker of this pool
+		std::size_t current() const{
+			return (self().pool == this) ? self().index : queues.size();
+		}
+
+		void push(std::function<void()>&& TASK){
+			std::size_t i = current();
+			if(i == queues.size()){
+				i = next.fetch_add(1) % queues.size();
+			}
+			{
+				std::lock_guard<std::mutex> lock(queues[i]->lock);
+				queues[i]->tasks.push_back(std::move(TASK));
+			}
+			queued.fetch_add(1);
+			{
+				std::lock_guard<std::mutex> lock(sleep);
+			}
+			wake.notify_one();
+		}
+
+		bool take(Queue& Q, bool BACK, std::function<void()>& TASK){
+			std::lock_guard<std::mutex> lock(Q.lock);
+			if(Q.tasks.empty()){
+				return false;
+			}
+			if(BACK){
+				TASK = std::move(Q.tasks.back());
+				Q.tasks.pop_back();
+			} else {
+				TASK = std::move(Q.tasks.front());
+				Q.tasks.pop_front();
+			}
+			queued.fetch_sub(1);
+			return true;
+		}
+
+		// Runs one task, from queue IDX or stolen from another
+		// queue. Returns false if every queue is empty.
+		bool run(std::size_t IDX){
+			std::function<void()> task;
+			std::size_t n = queues.size();
+			bool found = (IDX < n) && take(*queues[IDX], true, task);
+			for(std::size_t k = 1; !found && k <= n; ++k){
+				std::size_t victim = (IDX + k) % n;
+				found = (victim != IDX) && take(*queues[victim], false, task);
+			}
+			if(found){
+				task();
+			}
+			return found;
+		}
+
+		void work(std::size_t IDX){
+			self().pool = this;
+			self().index = IDX;
+			for(;;){
+				if(run(IDX)){
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(sleep);
+				wake.wait(lock, [this](){
+						return stop || queued.load() != 0;
+					});
+				if(stop){
+					return;
+				}
+			}
+		}
+	};
+
+	// MODULE :
+	//        struct DivconqFork
+	// 
+	// DESCRIPTION :
+	//        Divides the input array the same way as DivconqHelper
+	//        (see divconq.hpp). While LEVELS is nonzero and both
+	//        halves have at least GRAIN elements, the left half is
+	//        spawned as a task on the pool and the right half is
+	//        computed by the calling thread. Below that, divconq is
+	//        computed serially.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input array
+	//
+	// FUNCTIONS :
+	//        auto operator()(TaskPool&, std::size_t, std::size_t,
+	//                        FN const&, std::array<T, LEN> const&) const
+	template <std::size_t LEN>
+	struct DivconqFork{
+		static const std::size_t LLEN = DivconqHelper<LEN>::LLEN;
+		static const std::size_t RLEN = DivconqHelper<LEN>::RLEN;
+
+		template <class FN, typename T>
+		auto operator()(TaskPool& POOL, std::size_t LEVELS, std::size_t GRAIN,
+				FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(hops::divconq(F, IN)){
+			if(LEVELS == 0 || RLEN < GRAIN){
+				return hops::divconq(F, IN);
+			}
+			typedef decltype(hops::divconq(F, std::array<T, LLEN>())) LT;
+			auto p = split<LLEN>(IN);
+			std::unique_ptr<LT> l;
+			TaskGroup group;
+			POOL.spawn(group, [&](){
+					l.reset(new LT(DivconqFork<LLEN>()(POOL, LEVELS - 1, GRAIN, F, p.first)));
+				});
+			auto r = DivconqFork<RLEN>()(POOL, LEVELS - 1, GRAIN, F, p.second);
+			POOL.wait(group);
+			return F(*l, r);
+		}
+	};
+
+	template <>
+	struct DivconqFork<1>{
+		template <class FN, typename T>
+		auto operator()(TaskPool& POOL, std::size_t LEVELS, std::size_t GRAIN,
+				FN const& F, std::array<T, 1> const& IN) const
+			-> std::array<T, 1>{
+			return IN;
+		}
+	};
+#endif
+
+	// MODULE :
+	//        struct Parallel
+	// 
+	// DESCRIPTION :
+	//        Execution policy for multi-threaded host builds. Each
+	//        loop is divided into contiguous ranges of indicies, and
+	//        each range is run as a task on a work-stealing
+	//        TaskPool. divconq forks the top log2(threads) levels of
+	//        its tree onto the same TaskPool, and computes the lower
+	//        levels serially.
+	// 
+	// FUNCTIONS :
+	//        Parallel(std::size_t, std::size_t)
+	//        void apply(std::size_t, BODY const&) const
+	//        auto divconq(FN const&, std::array<T, LEN> const&) const
+	//
+	// NOTES :
+	//        Loops with fewer than 2 * grain indicies run on the
+	//        calling thread, which also runs the first range of
+	//        every loop. Subtrees with fewer than grain leaves are
+	//        not forked.
+	//
+	//        The TaskPool (threads - 1 workers) is started by the
+	//        first call to apply or divconq, and is shared by copies
+	//        of the policy. Reuse one instance to avoid starting
+	//        threads on every call.
+	struct Parallel : public Indexed<Parallel>{
+		// Maximum number of threads (0: one per hardware thread)
+		std::size_t threads;
+		// Minimum number of indicies run by a thread
+		std::size_t grain;
+
+		// FUNCTION :
+		//        Parallel
+		// 
+		// DESCRIPTION :
+		//        Constructs a parallel execution policy
+		// 
+		// ARGUMENTS :
+		//        THREADS : std::size_t
+		//            Maximum number of threads, or 0 for one per
+		//            hardware thread (Default: 0)
+		//
+		//        GRAIN : std::size_t
+		//            Minimum number of indicies run by a thread
+		//            (Default: 4096)
+		Parallel(std::size_t THREADS = 0, std::size_t GRAIN = 4096)
+			: threads(THREADS), grain(GRAIN ? GRAIN : 1)
+#ifndef __SYNTHESIS__
+			, lazy(std::make_shared<LazyPool>())
+#endif
+		{
+		}
+
+		// FUNCTION :
+		//        apply
+		// 
+		// DESCRIPTION :
+		//        Calls B on each index from 0 to N-1. Calls on
+		//        different indicies must be independent.
+		// 
+		// PARAMETERS :
+		//        BODY : class (Inferred)
+		//            Type of a function taking an index
+		//
+		// ARGUMENTS :
+		//        N : std::size_t
+		//            The number of indicies
+		//
+		//        B : BODY const&
+		//            The loop body
+		template <class BODY>
+		void apply(std::size_t N, BODY const& B) const{
+#pragma HLS INLINE
+#ifndef __SYNTHESIS__
+			std::size_t size = threads ? threads : std::thread::hardware_concurrency();
+			std::size_t count = (size > N / grain) ? N / grain : size;
+			if(count > 1){
+				std::size_t step = (N + count - 1) / count;
+				TaskPool& p = pool(size - 1);
+				TaskGroup group;
+				for(std::size_t lo = step; lo < N; lo += step){
+					std::size_t hi = (lo + step < N) ? lo + step : N;
+					p.spawn(group, [&B, lo, hi](){
+							for(std::size_t i = lo; i < hi; ++i){
+								B(i);
+							}
+						});
+				}
+				for(std::size_t i = 0; i < step; ++i){
+					B(i);
+				}
+				p.wait(group);
+				return;
+			}
+#endif
+			for(std::size_t i = 0; i < N; ++i){
+				B(i);
+			}
+		}
+
+#ifndef __SYNTHESIS__
+		// FUNCTION :
+		//        divconq
+		// 
+		// DESCRIPTION :
+		//        Computes hops::divconq(F, IN), with the top
+		//        ceil(log2(threads)) levels of the tree forked onto
+		//        the TaskPool of the policy
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the class-wrapped function
+		//
+		//        T : typename (Inferred)
+		//            Type of the values in the input array
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the input array
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped function.
+		//            Calls on different subtrees must be
+		//            independent.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array
+		// 
+		// RETURNS : decltype(hops::divconq(F, IN))
+		//        The result of hops::divconq(F, IN)
+		template <class FN, typename T, std::size_t LEN>
+		auto divconq(FN const& F, std::array<T, LEN> const& IN) const
+			-> decltype(hops::divconq(F, IN)){
+			std::size_t count = threads ? threads : std::thread::hardware_concurrency();
+			std::size_t levels = 0;
+			while((std::size_t(1) << levels) < count){
+				++levels;
+			}
+			if(levels == 0 || LEN / 2 < grain){
+				return hops::divconq(F, IN);
+			}
+			return DivconqFork<LEN>()(pool(count - 1), levels, grain, F, IN);
+		}
+
+	private:
+		// Holds the TaskPool, which is started on first use
+		struct LazyPool{
+			std::once_flag once;
+			std::unique_ptr<TaskPool> pool;
+		};
+
+		std::shared_ptr<LazyPool> lazy;
+
+		TaskPool& pool(std::size_t WORKERS) const{
+			LazyPool& l = *lazy;
+			std::call_once(l.once, [&l, WORKERS](){
+					l.pool.reset(new TaskPool(WORKERS));
+				});
+			return *l.pool;
+		}
+#endif
+	};
+
+	// VARIABLE :
+	//        unrolled (Instance of Unrolled)
+	//
+	// EXAMPLE :
+	//        b = hops::map(hops::exec::unrolled, F, a); // hops::map(F, a)
+	Unrolled unrolled;
+
+	// VARIABLE :
+	//        loop (Instance of Loop)
+	//
+	// EXAMPLE :
+	//        s = hops::lreduce(hops::exec::loop, std::plus<int>(), 0, a);
+	Loop loop;
+
+	// VARIABLE :
+	//        simd (Instance of Simd)
+	//
+	// EXAMPLE :
+	//        c = hops::zipWith(hops::exec::simd, std::plus<float>(), a, b);
+	Simd simd;
+
+	// VARIABLE :
+	//        parallel (Instance of Parallel), with one thread per
+	//        hardware thread and the default grain
+	//
+	// EXAMPLE :
+	//        b = hops::divconq(hops::exec::parallel, F, a);
+	//        b = hops::divconq(hops::exec::Parallel(4, 64), F, a);
+	Parallel parallel;
+} // namespace exec
+} // namespace hops
+#endif // __EXEC_HPP
@@ -0,0 +1,865 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        fixed.hpp
+//
+// DESCRIPTION :
+//        This file implements bit-accurate arbitrary-width integer
+//        and fixed-point types for host builds, so that kernels
+//        written for ap_int and ap_fixed can be simulated without
+//        vendor headers:
+//
+//            hops::intw<W>       : A W-bit signed integer
+//            hops::uintw<W>      : A W-bit unsigned integer
+//            hops::fixed<W, I>   : A W-bit signed fixed-point number
+//                                  with I integer bits (and W-I
+//                                  fractional bits)
+//            hops::ufixed<W, I>  : The unsigned fixed-point number
+//
+//        Each value is held in the smallest native integer of at
+//        least W bits, and every operation is computed with native
+//        integers, so arrays of these types are as compact as
+//        arrays of native integers and the host compiler can
+//        vectorize loops over them.
+//
+//        fixed and ufixed take a quantization mode and an overflow
+//        mode, as ap_fixed does:
+//
+//            TRN  : Truncate toward minus infinity (default)
+//            RND  : Round to the nearest value, with halves
+//                   rounded toward plus infinity
+//            WRAP : Discard the bits above the most significant bit
+//                   (default)
+//            SAT  : Saturate to the largest or smallest value
+//
+//        When __SYNTHESIS__ is defined (by Vivado HLS), the names
+//        refer to ap_int, ap_uint, ap_fixed and ap_ufixed instead,
+//        so a kernel written with these types synthesizes as one
+//        written with the vendor types.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Integer (intw and uintw)
+//        Fixed (fixed and ufixed)
+//        Quantization
+//        Overflow
+//
+// PRIVATE MODULES :
+//        Word
+//        Operation
+//        IntegerResult
+//        FixedResult
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard, and (for host builds) the __int128 extension of
+//        GCC and Clang for the intermediate results of operations
+//        on values wider than 31 bits.
+//
+//        W may be at most 64.
+//
+//        As with ap_int and ap_fixed, the result of an arithmetic
+//        operator holds every result of its operands: + and - are
+//        one bit wider than the wider operand, and the width of *
+//        is the sum of the widths (see IntegerResult and
+//        FixedResult). The result is quantized and wrapped or
+//        saturated only when it is assigned or converted to a
+//        narrower type, e.g. by the return type of std::plus<T>.
+//        Results wider than 64 bits are reduced to 64 bits (a Fixed
+//        result drops fractional bits first), where ap_int and
+//        ap_fixed would keep growing.
+//
+//        Arithmetic with a native integer converts it to an
+//        Integer as wide as the native type (a Fixed type with no
+//        fractional bits for Fixed arithmetic), as ap_int converts
+//        an int to an ap_int<32>. Arithmetic between a Fixed value
+//        and a floating-point value converts the floating-point
+//        value to the Fixed type, and arithmetic between an Integer
+//        and a floating-point value is floating-point.
+//
+//        Integer converts implicitly to a native integer (e.g. for
+//        switch statements and array indicies). Fixed converts to
+//        native types explicitly, e.g. float(X).
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __FIXED_HPP
+#define __FIXED_HPP
+#ifdef __SYNTHESIS__
+#include "ap_int.h"
+#include "ap_fixed.h"
+namespace hops{
+	enum Quantization{TRN = AP_TRN, RND = AP_RND};
+	enum Overflow{WRAP = AP_WRAP, SAT = AP_SAT};
+
+	template <int W>
+	using intw = ap_int<W>;
+
+	template <int W>
+	using uintw = ap_uint<W>;
+
+	template <int W, int I, Quantization Q = TRN, Overflow O = WRAP>
+	using fixed = ap_fixed<W, I, (ap_q_mode)Q, (ap_o_mode)O>;
+
+	template <int W, int I, Quantization Q = TRN, Overflow O = WRAP>
+	using ufixed = ap_ufixed<W, I, (ap_q_mode)Q, (ap_o_mode)O>;
+}
+#else
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+namespace hops{
+	// MODULE :
+	//        enum Quantization
+	// 
+	// DESCRIPTION :
+	//        How a Fixed value discards fractional bits: TRN
+	//        truncates toward minus infinity, and RND rounds to
+	//        the nearest value (halves toward plus infinity)
+	enum Quantization{TRN, RND};
+
+	// MODULE :
+	//        enum Overflow
+	// 
+	// DESCRIPTION :
+	//        How a Fixed value discards integer bits: WRAP keeps
+	//        the low bits, and SAT saturates to the largest or
+	//        smallest value
+	enum Overflow{WRAP, SAT};
+
+	// MODULE :
+	//        struct Word
+	// 
+	// DESCRIPTION :
+	//        Word<W, S>::type is the smallest native integer with
+	//        at least W bits, signed when S is true
+	template <int W, bool S,
+		  int B = (W <= 8) ? 8 : (W <= 16) ? 16 : (W <= 32) ? 32 : 64>
+	struct Word;
+
+	template <int W> struct Word<W, true, 8>{typedef std::int8_t type;};
+	template <int W> struct Word<W, true, 16>{typedef std::int16_t type;};
+	template <int W> struct Word<W, true, 32>{typedef std::int32_t type;};
+	template <int W> struct Word<W, true, 64>{typedef std::int64_t type;};
+	template <int W> struct Word<W, false, 8>{typedef std::uint8_t type;};
+	template <int W> struct Word<W, false, 16>{typedef std::uint16_t type;};
+	template <int W> struct Word<W, false, 32>{typedef std::uint32_t type;};
+	template <int W> struct Word<W, false, 64>{typedef std::uint64_t type;};
+
+	// MODULE :
+	//        struct Integer
+	// 
+	// DESCRIPTION :
+	//        A W-bit two's complement (S = true) or unsigned (S =
+	//        false) integer. Results wrap to W bits.
+	// 
+	// PARAMETERS :
+	//        W : int
+	//            The number of bits, from 1 to 64
+	//
+	//        S : bool
+	//            Signed when true
+	//
+	// NOTES :
+	//        intw<W> and uintw<W> are the signed and unsigned
+	//        Integers.
+	//
+	//        Binary operators on Integers return an Integer with
+	//        the width of the ap_int result (see IntegerResult).
+	template <int W, bool S>
+	struct Integer{
+		static_assert(W > 0 && W <= 64, "Integer width must be from 1 to 64 bits");
+		typedef typename Word<W, S>::type word_type;
+		static const int width = W;
+		static const bool is_signed = S;
+
+		word_type v;
+
+		Integer() : v(0){
+		}
+
+		template <typename T,
+			  typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+		Integer(T const& V) : v(wrap(static_cast<std::uint64_t>(V))){
+		}
+
+		template <typename T,
+			  typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+		Integer(T const& V) : v(wrap(static_cast<std::uint64_t>(static_cast<std::int64_t>(V)))){
+		}
+
+		template <int WI, bool SI>
+		Integer(Integer<WI, SI> const& V) : v(wrap(static_cast<std::uint64_t>(V.v))){
+		}
+
+		operator word_type() const{
+			return v;
+		}
+
+		// Returns the value of bit IDX
+		bool operator[](int IDX) const{
+			return (static_cast<std::uint64_t>(v) >> IDX) & 1;
+		}
+
+		// Returns bits HI down to LO, as an unsigned value
+		std::uint64_t range(int HI, int LO) const{
+			std::uint64_t u = static_cast<std::uint64_t>(v) >> LO;
+			return (HI - LO >= 63) ? u : u & ((std::uint64_t(1) << (HI - LO + 1)) - 1);
+		}
+
+		template <typename T>
+		Integer& operator+=(T const& R){return *this = *this + R;}
+		template <typename T>
+		Integer& operator-=(T const& R){return *this = *this - R;}
+		template <typename T>
+		Integer& operator*=(T const& R){return *this = *this * R;}
+		template <typename T>
+		Integer& operator/=(T const& R){return *this = *this / R;}
+		template <typename T>
+		Integer& operator%=(T const& R){return *this = *this % R;}
+		template <typename T>
+		Integer& operator&=(T const& R){return *this = *this & R;}
+		template <typename T>
+		Integer& operator|=(T const& R){return *this = *this | R;}
+		template <typename T>
+		Integer& operator^=(T const& R){return *this = *this ^ R;}
+		Integer& operator<<=(int R){return *this = *this << R;}
+		Integer& operator>>=(int R){return *this = *this >> R;}
+
+		Integer& operator++(){return *this += 1;}
+		Integer& operator--(){return *this -= 1;}
+		Integer operator++(int){Integer t = *this; *this += 1; return t;}
+		Integer operator--(int){Integer t = *this; *this -= 1; return t;}
+
+		Integer operator+() const{return *this;}
+		Integer<(W < 64) ? W + 1 : 64, true> operator-() const{
+			return std::uint64_t(0) - static_cast<std::uint64_t>(v);
+		}
+		Integer operator~() const{return Integer(~static_cast<std::uint64_t>(v));}
+
+		friend Integer operator<<(Integer const& L, int R){
+			return Integer(static_cast<std::uint64_t>(L.v) << R);
+		}
+
+		friend Integer operator>>(Integer const& L, int R){
+			return Integer(static_cast<word_type>(L.v >> R));
+		}
+
+		friend std::ostream& operator<<(std::ostream& OS, Integer const& V){
+			return OS << (S ? static_cast<long long>(V.v) : static_cast<unsigned long long>(V.v));
+		}
+
+		// FUNCTION :
+		//        wrap
+		// 
+		// DESCRIPTION :
+		//        Returns the low W bits of U, sign-extended when S
+		//        is true
+		static word_type wrap(std::uint64_t U){
+			if(W == 64){
+				return static_cast<word_type>(U);
+			}
+			std::uint64_t mask = (std::uint64_t(1) << (W % 64)) - 1;
+			std::uint64_t sign = std::uint64_t(1) << ((W - 1) % 64);
+			U &= mask;
+			return S ? static_cast<word_type>(static_cast<std::int64_t>(U ^ sign) -
+							  static_cast<std::int64_t>(sign))
+				: static_cast<word_type>(U);
+		}
+	};
+
+	template <int W>
+	using intw = Integer<W, true>;
+
+	template <int W>
+	using uintw = Integer<W, false>;
+
+	// MODULE :
+	//        enum Operation
+	// 
+	// DESCRIPTION :
+	//        The groups of binary operators that have the same
+	//        result width: OP_ADD (+), OP_SUB (-), OP_MUL (*),
+	//        OP_DIV (/), OP_MOD (%) and OP_LOGIC (&, |, ^)
+	enum Operation{OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MOD, OP_LOGIC};
+
+	// MODULE :
+	//        struct IntegerResult
+	// 
+	// DESCRIPTION :
+	//        IntegerResult<OP, WL, SL, WR, SR>::type is the Integer
+	//        returned by an operator in the group OP on a WL-bit
+	//        and a WR-bit operand. The widths are those of ap_int:
+	//        one bit more than the wider operand for OP_ADD and
+	//        OP_SUB, the sum of the widths for OP_MUL, WL (and one
+	//        more bit for a signed divisor) for OP_DIV, the
+	//        narrower of the dividend and the divisor for OP_MOD
+	//        and the wider operand for OP_LOGIC. An unsigned
+	//        operand counts one more bit when the other is signed,
+	//        except an unsigned dividend of OP_MOD. The result of
+	//        OP_SUB is signed.
+	//
+	// NOTES :
+	//        Widths over 64 bits are capped at 64 (see the
+	//        arithmetic operators below).
+	template <Operation OP, int WL, bool SL, int WR, bool SR>
+	struct IntegerResult{
+		static const int wl = WL + (!SL && SR);
+		static const int wr = WR + (!SR && SL);
+		static const int wmax = (wl > wr) ? wl : wr;
+		static const int w = (OP == OP_ADD || OP == OP_SUB) ? wmax + 1 :
+			(OP == OP_MUL) ? WL + WR :
+			(OP == OP_DIV) ? WL + SR :
+			(OP == OP_MOD) ? ((WL < wr) ? WL : wr) : wmax;
+		static const bool s = (OP == OP_SUB) || ((OP == OP_MOD) ? SL : (SL || SR));
+		typedef Integer<(w > 64) ? 64 : w, s> type;
+	};
+
+	// IntegerOf<T>::type is the Integer that the native integer T
+	// is converted to in arithmetic with an Integer
+	template <typename T>
+	struct IntegerOf{
+		typedef Integer<std::is_same<T, bool>::value ? 1 : 8 * sizeof(T),
+				std::is_signed<T>::value> type;
+	};
+
+	template <int W, bool S>
+	struct IntegerOf<Integer<W, S> >{
+		typedef Integer<W, S> type;
+	};
+
+	// IntegerPromote<OP, TL, TR>::type is the result of an
+	// operator in the group OP on TL and TR, when one is an
+	// Integer
+	template <Operation OP, typename TL, typename TR, typename = void>
+	struct IntegerPromote{
+	};
+
+	template <Operation OP, int WL, bool SL, int WR, bool SR>
+	struct IntegerPromote<OP, Integer<WL, SL>, Integer<WR, SR> >
+		: public IntegerResult<OP, WL, SL, WR, SR>{
+	};
+
+	template <Operation OP, int W, bool S, typename T>
+	struct IntegerPromote<OP, Integer<W, S>, T,
+			      typename std::enable_if<std::is_integral<T>::value>::type>
+		: public IntegerPromote<OP, Integer<W, S>, typename IntegerOf<T>::type>{
+	};
+
+	template <Operation OP, int W, bool S, typename T>
+	struct IntegerPromote<OP, T, Integer<W, S>,
+			      typename std::enable_if<std::is_integral<T>::value>::type>
+		: public IntegerPromote<OP, typename IntegerOf<T>::type, Integer<W, S> >{
+	};
+
+	template <Operation OP, int W, bool S, typename T>
+	struct IntegerPromote<OP, Integer<W, S>, T,
+			      typename std::enable_if<std::is_floating_point<T>::value>::type>{
+		typedef T type;
+	};
+
+	template <Operation OP, int W, bool S, typename T>
+	struct IntegerPromote<OP, T, Integer<W, S>,
+			      typename std::enable_if<std::is_floating_point<T>::value>::type>{
+		typedef T type;
+	};
+
+	// IntegerFits<T>::value is true when every value of T fits in
+	// a std::int64_t
+	template <typename T>
+	struct IntegerFits
+		: public std::integral_constant<bool, std::is_signed<T>::value || (sizeof(T) < 8)>{
+	};
+
+	template <int W, bool S>
+	struct IntegerFits<Integer<W, S> >
+		: public std::integral_constant<bool, S || (W < 64)>{
+	};
+
+	// IntegerCompute<TL, TR>::type is the native type that compares
+	// and divides values of TL and TR exactly: the floating-point
+	// type of one of them, or a signed integer that holds both
+	template <typename TL, typename TR>
+	struct IntegerCompute{
+		typedef typename std::conditional<
+			std::is_floating_point<TL>::value, TL,
+			typename std::conditional<
+				std::is_floating_point<TR>::value, TR,
+				typename std::conditional<
+					IntegerFits<TL>::value && IntegerFits<TR>::value,
+					std::int64_t, __int128>::type>::type>::type type;
+	};
+
+	// Returns V as a value of the native type R
+	template <typename R, int W, bool S>
+	R integer_cast(Integer<W, S> const& V){
+		return static_cast<R>(V.v);
+	}
+
+	template <typename R, typename T>
+	R integer_cast(T const& V){
+		return static_cast<R>(V);
+	}
+
+	// Addition, subtraction, multiplication and the bitwise
+	// operators are computed modulo 2^64, which is exact in the
+	// result width.
+	//
+	// Unlike ap_int, a result is never wider than 64 bits: where
+	// ap_int would return, e.g., an ap_int<65> from the sum of two
+	// 64-bit values, these operators return the low 64 bits. The
+	// two agree once the result is assigned or converted to 64
+	// bits or fewer, as by the return type of std::plus<T>, but a
+	// wider result kept in an auto variable or compared directly
+	// can differ.
+#define HOPS_INTEGER_ARITHMETIC(OP, GROUP)				\
+	template <typename TL, typename TR>				\
+	auto operator OP(TL const& L, TR const& R)			\
+		-> typename IntegerPromote<GROUP, TL, TR>::type{	\
+		typedef typename IntegerPromote<GROUP, TL, TR>::type res_t; \
+		typedef typename std::conditional<std::is_floating_point<res_t>::value, \
+						  res_t, std::uint64_t>::type calc_t; \
+		return res_t(integer_cast<calc_t>(L) OP integer_cast<calc_t>(R)); \
+	}
+
+	HOPS_INTEGER_ARITHMETIC(+, OP_ADD)
+	HOPS_INTEGER_ARITHMETIC(-, OP_SUB)
+	HOPS_INTEGER_ARITHMETIC(*, OP_MUL)
+	HOPS_INTEGER_ARITHMETIC(&, OP_LOGIC)
+	HOPS_INTEGER_ARITHMETIC(|, OP_LOGIC)
+	HOPS_INTEGER_ARITHMETIC(^, OP_LOGIC)
+#undef HOPS_INTEGER_ARITHMETIC
+
+	// Division, remainder and comparisons depend on the signs of
+	// the operands, so they are computed on the values. A quotient
+	// is capped at 64 bits as above.
+#define HOPS_INTEGER_DIVISION(OP, GROUP)					\
+	template <typename TL, typename TR>				\
+	auto operator OP(TL const& L, TR const& R)			\
+		-> typename IntegerPromote<GROUP, TL, TR>::type{	\
+		typedef typename IntegerPromote<GROUP, TL, TR>::type res_t; \
+		typedef typename IntegerCompute<TL, TR>::type calc_t;	\
+		typedef typename std::conditional<std::is_floating_point<res_t>::value, \
+						  res_t, std::int64_t>::type out_t; \
+		return res_t(static_cast<out_t>(integer_cast<calc_t>(L) OP integer_cast<calc_t>(R))); \
+	}
+
+	HOPS_INTEGER_DIVISION(/, OP_DIV)
+	HOPS_INTEGER_DIVISION(%, OP_MOD)
+#undef HOPS_INTEGER_DIVISION
+
+#define HOPS_INTEGER_COMPARISON(OP)					\
+	template <typename TL, typename TR>				\
+	auto operator OP(TL const& L, TR const& R)			\
+		-> decltype(typename IntegerPromote<OP_LOGIC, TL, TR>::type(), bool()){ \
+		typedef typename IntegerCompute<TL, TR>::type calc_t;	\
+		return integer_cast<calc_t>(L) OP integer_cast<calc_t>(R); \
+	}
+
+	HOPS_INTEGER_COMPARISON(==)
+	HOPS_INTEGER_COMPARISON(!=)
+	HOPS_INTEGER_COMPARISON(<)
+	HOPS_INTEGER_COMPARISON(>)
+	HOPS_INTEGER_COMPARISON(<=)
+	HOPS_INTEGER_COMPARISON(>=)
+#undef HOPS_INTEGER_COMPARISON
+
+	// MODULE :
+	//        struct Fixed
+	// 
+	// DESCRIPTION :
+	//        A W-bit fixed-point number with I integer bits and
+	//        W-I fractional bits, held as a W-bit Integer scaled by
+	//        2^(W-I)
+	// 
+	// PARAMETERS :
+	//        W : int
+	//            The number of bits, from 1 to 64
+	//
+	//        I : int
+	//            The number of integer bits (including the sign
+	//            bit), at most W
+	//
+	//        Q : Quantization
+	//            How fractional bits are discarded (TRN or RND)
+	//
+	//        O : Overflow
+	//            How integer bits are discarded (WRAP or SAT)
+	//
+	//        S : bool
+	//            Signed when true
+	//
+	// NOTES :
+	//        fixed<W, I, Q, O> and ufixed<W, I, Q, O> are the
+	//        signed and unsigned Fixed types.
+	//
+	//        Binary arithmetic operators return a Fixed type with
+	//        the width and integer bits of the ap_fixed result, and
+	//        the TRN and WRAP modes (see FixedResult). The modes of
+	//        a type apply when a value is converted to it.
+	template <int W, int I, Quantization Q, Overflow O, bool S>
+	struct Fixed{
+		static_assert(W > 0 && W <= 64, "Fixed width must be from 1 to 64 bits");
+		static_assert(I <= W && W - I < 64, "Fixed must have from 0 to 63 fractional bits");
+		typedef typename Word<W, S>::type word_type;
+		static const int width = W;
+		static const int integer = I;
+		static const int fraction = W - I;
+		static const bool is_signed = S;
+
+		// The value, scaled by 2^fraction
+		word_type v;
+
+		Fixed() : v(0){
+		}
+
+		template <typename T,
+			  typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+		Fixed(T const& V) : v(from_real(V)){
+		}
+
+		template <typename T,
+			  typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+		Fixed(T const& V) : v(make(static_cast<__int128>(V) * (static_cast<__int128>(1) << fraction))){
+		}
+
+		template <int WI, bool SI>
+		Fixed(Integer<WI, SI> const& V) : v(make(static_cast<__int128>(V.v) * (static_cast<__int128>(1) << fraction))){
+		}
+
+		template <int WI, int II, Quantization QI, Overflow OI, bool SI>
+		Fixed(Fixed<WI, II, QI, OI, SI> const& V) : v(align(V.v, fraction - (WI - II))){
+		}
+
+		// Returns the Fixed value with the bits RAW
+		static Fixed bits(word_type RAW){
+			Fixed f;
+			f.v = RAW;
+			return f;
+		}
+
+		// Converts to a floating-point value, or to an integer
+		// (truncating toward zero)
+		template <typename T,
+			  typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+		explicit operator T() const{
+			return std::is_floating_point<T>::value ?
+				static_cast<T>(std::ldexp(static_cast<long double>(v), -fraction)) :
+				static_cast<T>(static_cast<__int128>(v) / (static_cast<__int128>(1) << fraction));
+		}
+
+		template <typename T>
+		Fixed& operator+=(T const& R){return *this = *this + R;}
+		template <typename T>
+		Fixed& operator-=(T const& R){return *this = *this - R;}
+		template <typename T>
+		Fixed& operator*=(T const& R){return *this = *this * R;}
+		template <typename T>
+		Fixed& operator/=(T const& R){return *this = *this / R;}
+		Fixed& operator<<=(int R){return *this = *this << R;}
+		Fixed& operator>>=(int R){return *this = *this >> R;}
+
+		Fixed operator+() const{return *this;}
+
+		friend Fixed operator<<(Fixed const& L, int R){
+			return bits(make(static_cast<__int128>(L.v) * (static_cast<__int128>(1) << R)));
+		}
+
+		friend Fixed operator>>(Fixed const& L, int R){
+			return bits(static_cast<word_type>(L.v >> R));
+		}
+
+		friend bool operator==(Fixed const& L, Fixed const& R){return L.v == R.v;}
+		friend bool operator!=(Fixed const& L, Fixed const& R){return L.v != R.v;}
+		friend bool operator<(Fixed const& L, Fixed const& R){return L.v < R.v;}
+		friend bool operator>(Fixed const& L, Fixed const& R){return L.v > R.v;}
+		friend bool operator<=(Fixed const& L, Fixed const& R){return L.v <= R.v;}
+		friend bool operator>=(Fixed const& L, Fixed const& R){return L.v >= R.v;}
+
+		friend std::ostream& operator<<(std::ostream& OS, Fixed const& V){
+			return OS << static_cast<double>(V);
+		}
+
+		// FUNCTION :
+		//        quantize
+		// 
+		// DESCRIPTION :
+		//        Returns RAW with SHIFT fractional bits discarded,
+		//        following Q
+		template <typename T>
+		static T quantize(T RAW, int SHIFT){
+			if(SHIFT <= 0){
+				return RAW;
+			}
+			return (Q == RND) ? (RAW + (static_cast<T>(1) << (SHIFT - 1))) >> SHIFT : RAW >> SHIFT;
+		}
+
+		// FUNCTION :
+		//        make
+		// 
+		// DESCRIPTION :
+		//        Returns the W-bit value of RAW, following O
+		template <typename T>
+		static word_type make(T RAW){
+			if(O == SAT){
+				__int128 hi = S ? (static_cast<__int128>(1) << (W - 1)) - 1 : (static_cast<__int128>(1) << W) - 1;
+				__int128 lo = S ? -(static_cast<__int128>(1) << (W - 1)) : 0;
+				__int128 r = RAW;
+				return static_cast<word_type>((r > hi) ? hi : (r < lo) ? lo : r);
+			}
+			return Integer<W, S>::wrap(static_cast<std::uint64_t>(RAW));
+		}
+
+		// Returns RAW, with SHIFT more fractional bits (or
+		// -SHIFT fewer)
+		template <typename T>
+		static word_type align(T RAW, int SHIFT){
+			__int128 r = RAW;
+			return make(SHIFT >= 0 ? r * (static_cast<__int128>(1) << SHIFT) : quantize(r, -SHIFT));
+		}
+
+		template <typename T>
+		static word_type from_real(T V){
+			long double r = std::ldexp(static_cast<long double>(V), fraction);
+			r = (Q == RND) ? std::floor(r + 0.5L) : std::floor(r);
+			// Values beyond 64 bits saturate before they wrap
+			r = (r > 9.2e18L) ? 9.2e18L : (r < -9.2e18L) ? -9.2e18L : r;
+			return make(static_cast<__int128>(static_cast<std::int64_t>(r)));
+		}
+	};
+
+	template <int W, int I, Quantization Q = TRN, Overflow O = WRAP>
+	using fixed = Fixed<W, I, Q, O, true>;
+
+	template <int W, int I, Quantization Q = TRN, Overflow O = WRAP>
+	using ufixed = Fixed<W, I, Q, O, false>;
+
+	// MODULE :
+	//        struct FixedCommon
+	// 
+	// DESCRIPTION :
+	//        FixedCommon<TL, TR>::type is the Fixed type that the
+	//        operands of a comparison of Fixed types TL and TR are
+	//        converted to: the most integer bits and the most
+	//        fractional bits of the two (an unsigned operand takes
+	//        one more integer bit when the other is signed), with
+	//        the fractional bits reduced to fit in 64 bits
+	template <typename TL, typename TR>
+	struct FixedCommon;
+
+	template <int WL, int IL, Quantization QL, Overflow OL, bool SL,
+		  int WR, int IR, Quantization QR, Overflow OR, bool SR>
+	struct FixedCommon<Fixed<WL, IL, QL, OL, SL>, Fixed<WR, IR, QR, OR, SR> >{
+		static const int il = IL + (!SL && SR);
+		static const int ir = IR + (!SR && SL);
+		static const int i = (il > ir) ? il : ir;
+		static const int f = ((WL - IL) > (WR - IR)) ? (WL - IL) : (WR - IR);
+		static const int w = (i + f > 64) ? 64 : i + f;
+		typedef Fixed<w, i, QL, OL, SL || SR> type;
+	};
+
+	// MODULE :
+	//        struct FixedResult
+	// 
+	// DESCRIPTION :
+	//        FixedResult<OP, TL, TR>::type is the Fixed type
+	//        returned by an operator in the group OP (OP_ADD,
+	//        OP_SUB, OP_MUL or OP_DIV) on Fixed types TL and TR,
+	//        with the width and integer bits of ap_fixed: one more
+	//        integer bit than the wider operand and the most
+	//        fractional bits for OP_ADD and OP_SUB, the sums of the
+	//        integer and fractional bits for OP_MUL, and the
+	//        fractional bits of TL for OP_DIV. An unsigned operand
+	//        counts one more integer bit when the other is signed.
+	//        The result of OP_SUB is signed.
+	//
+	// FUNCTIONS :
+	//        static type apply(TL const&, TR const&)
+	//
+	// NOTES :
+	//        Results wider than 64 bits drop fractional bits, and
+	//        then integer bits, to fit in 64 bits, where ap_fixed
+	//        would keep growing (see the arithmetic operators).
+	template <Operation OP, typename TL, typename TR>
+	struct FixedResult;
+
+	template <Operation OP, int WL, int IL, Quantization QL, Overflow OL, bool SL,
+		  int WR, int IR, Quantization QR, Overflow OR, bool SR>
+	struct FixedResult<OP, Fixed<WL, IL, QL, OL, SL>, Fixed<WR, IR, QR, OR, SR> >{
+		typedef Fixed<WL, IL, QL, OL, SL> left;
+		typedef Fixed<WR, IR, QR, OR, SR> right;
+		static const int fl = WL - IL;
+		static const int fr = WR - IR;
+		static const int il = IL + (!SL && SR);
+		static const int ir = IR + (!SR && SL);
+		static const int fmax = (fl > fr) ? fl : fr;
+		static const int i = (OP == OP_MUL) ? IL + IR :
+			(OP == OP_DIV) ? IL + fr + SR : ((il > ir) ? il : ir) + 1;
+		static const int f = (OP == OP_MUL) ? fl + fr : (OP == OP_DIV) ? fl : fmax;
+		static const int ic = (i > 64) ? 64 : i;
+		static const int fc = (f > 64 - ic) ? 64 - ic : (f > 63) ? 63 : f;
+		typedef Fixed<ic + fc, ic, TRN, WRAP, (OP == OP_SUB) || SL || SR> type;
+
+		// FUNCTION :
+		//        apply
+		// 
+		// DESCRIPTION :
+		//        Computes L OP R exactly in 128 bits, and returns
+		//        it as a value of type. The quotient of OP_DIV is
+		//        truncated toward zero, as ap_fixed does.
+		static type apply(left const& L, right const& R){
+			__int128 l = L.v, r = R.v;
+			if(OP == OP_MUL){
+				return type::bits(type::align(l * r, type::fraction - fl - fr));
+			}
+			if(OP == OP_DIV){
+				return type::bits(type::align(l * (static_cast<__int128>(1) << fr) / r,
+							      type::fraction - fl));
+			}
+			l *= static_cast<__int128>(1) << (fmax - fl);
+			r *= static_cast<__int128>(1) << (fmax - fr);
+			return type::bits(type::align((OP == OP_ADD) ? l + r : l - r,
+						      type::fraction - fmax));
+		}
+	};
+
+	// FixedOf<T, F>::type is the Fixed type that a native value or
+	// Integer T is converted to in arithmetic with the Fixed type
+	// F: an integer becomes a
+	// Fixed type with no fractional bits (see IntegerOf), and a
+	// floating-point value becomes F
+	template <typename T, typename F, typename = void>
+	struct FixedOf{
+	};
+
+	template <int W, bool S, typename F>
+	struct FixedOf<Integer<W, S>, F>{
+		typedef Fixed<W, W, TRN, WRAP, S> type;
+	};
+
+	template <typename T, typename F>
+	struct FixedOf<T, F, typename std::enable_if<std::is_integral<T>::value>::type>
+		: public FixedOf<typename IntegerOf<T>::type, F>{
+	};
+
+	template <typename T, typename F>
+	struct FixedOf<T, F, typename std::enable_if<std::is_floating_point<T>::value>::type>{
+		typedef F type;
+	};
+
+	// FixedPromote<OP, TL, TR> is the FixedResult of TL and TR,
+	// when both are Fixed types, or when one is a Fixed type and
+	// FixedOf converts the other
+	template <Operation OP, typename TL, typename TR, typename = void>
+	struct FixedPromote{
+	};
+
+	template <Operation OP, int W, int I, Quantization Q, Overflow O, bool S, typename T>
+	struct FixedPromote<OP, Fixed<W, I, Q, O, S>, T,
+			    typename std::conditional<true, void,
+			    typename FixedOf<T, Fixed<W, I, Q, O, S> >::type>::type>
+		: public FixedResult<OP, Fixed<W, I, Q, O, S>,
+				     typename FixedOf<T, Fixed<W, I, Q, O, S> >::type>{
+	};
+
+	template <Operation OP, typename T, int W, int I, Quantization Q, Overflow O, bool S>
+	struct FixedPromote<OP, T, Fixed<W, I, Q, O, S>,
+			    typename std::conditional<true, void,
+			    typename FixedOf<T, Fixed<W, I, Q, O, S> >::type>::type>
+		: public FixedResult<OP, typename FixedOf<T, Fixed<W, I, Q, O, S> >::type,
+				     Fixed<W, I, Q, O, S> >{
+	};
+
+	template <Operation OP, int WL, int IL, Quantization QL, Overflow OL, bool SL,
+		  int WR, int IR, Quantization QR, Overflow OR, bool SR>
+	struct FixedPromote<OP, Fixed<WL, IL, QL, OL, SL>, Fixed<WR, IR, QR, OR, SR> >
+		: public FixedResult<OP, Fixed<WL, IL, QL, OL, SL>, Fixed<WR, IR, QR, OR, SR> >{
+	};
+
+	// Unlike ap_fixed, a result is never wider than 64 bits: a
+	// result that needs more is truncated toward minus infinity to
+	// fewer fractional bits first, and then wrapped to fewer integer
+	// bits (see FixedResult). A product of two 48-bit values, for
+	// example, keeps the 64 most significant bits where ap_fixed
+	// keeps 96, so it can differ from ap_fixed in the low bits, or
+	// when it is converted to a type with more fractional bits or a
+	// rounding mode.
+#define HOPS_FIXED_ARITHMETIC(OP, GROUP)				\
+	template <typename TL, typename TR>				\
+	auto operator OP(TL const& L, TR const& R)			\
+		-> typename FixedPromote<GROUP, TL, TR>::type{		\
+		typedef FixedPromote<GROUP, TL, TR> promote;		\
+		return promote::apply(typename promote::left(L),	\
+				      typename promote::right(R));	\
+	}
+
+	HOPS_FIXED_ARITHMETIC(+, OP_ADD)
+	HOPS_FIXED_ARITHMETIC(-, OP_SUB)
+	HOPS_FIXED_ARITHMETIC(*, OP_MUL)
+	HOPS_FIXED_ARITHMETIC(/, OP_DIV)
+#undef HOPS_FIXED_ARITHMETIC
+
+	// As with ap_fixed, the negation of a value is one bit wider
+	template <int W, int I, Quantization Q, Overflow O, bool S>
+	auto operator-(Fixed<W, I, Q, O, S> const& V)
+		-> decltype(Fixed<W, I, Q, O, S>() - V){
+		return Fixed<W, I, Q, O, S>() - V;
+	}
+
+#define HOPS_FIXED_COMPARISON(OP)					\
+	template <int WL, int IL, Quantization QL, Overflow OL, bool SL, \
+		  int WR, int IR, Quantization QR, Overflow OR, bool SR> \
+	bool operator OP(Fixed<WL, IL, QL, OL, SL> const& L,		\
+			 Fixed<WR, IR, QR, OR, SR> const& R){		\
+		typedef typename FixedCommon<Fixed<WL, IL, QL, OL, SL>,	\
+					     Fixed<WR, IR, QR, OR, SR> >::type res_t; \
+		return res_t(L) OP res_t(R);				\
+	}
+
+	HOPS_FIXED_COMPARISON(==)
+	HOPS_FIXED_COMPARISON(!=)
+	HOPS_FIXED_COMPARISON(<)
+	HOPS_FIXED_COMPARISON(>)
+	HOPS_FIXED_COMPARISON(<=)
+	HOPS_FIXED_COMPARISON(>=)
+#undef HOPS_FIXED_COMPARISON
+} // namespace hops
+#endif // __SYNTHESIS__
+#endif // __FIXED_HPP
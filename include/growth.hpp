@@ -0,0 +1,397 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        growth.hpp
+//
+// DESCRIPTION :
+//        This file implements bit-growth-aware accumulator types.
+//        Summing LEN values of W bits needs W + clog2(LEN) bits,
+//        and a product of a WL-bit and a WR-bit value needs WL + WR
+//        bits. The types here derive the narrowest type that holds
+//        each result from the width of the inputs, so reductions
+//        need no hand-chosen, over-provisioned accumulator:
+//
+//            std::array<hops::intw<8>, 16> x;
+//
+//            // Each level of the tree is one bit wider than the
+//            // level below: intw<9>, intw<10>, intw<11>, intw<12>
+//            auto s = hops::treereduce(hops::grow_plus, x);
+//
+//            // A chain accumulates in one register of
+//            // 8 + clog2(16) bits, intw<12>
+//            auto t = hops::lreduce(hops::grow_plus, 0, x);
+//
+//        The widths apply to the integer and fixed-point types of
+//        fixed.hpp (the integer bits of a fixed type grow), and to
+//        native integers, which grow to Integer types. An Integer
+//        is held in the smallest native integer with enough bits
+//        (e.g. the sum of 16 std::uint8_t values is a uintw<12>,
+//        held in a std::uint16_t), so vectorized reductions use the
+//        narrowest lanes.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Format
+//        Width
+//        Resize
+//        Widen
+//        Common
+//        Growth
+//        Grow
+//        Accumulator
+//
+// PRIVATE MODULES :
+//        IntegerFormat
+//        ApFixedFormat
+//        GrowChain
+//
+// PUBLIC VARIABLES :
+//        grow_plus
+//        grow_multiplies
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        Grow only changes types: the values are the same as those
+//        computed in a type wide enough for every result.
+//
+//        Widths are limited to 64 bits. Growth beyond 64 bits is a
+//        compile-time error.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __GROWTH_HPP
+#define __GROWTH_HPP
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include "arrayops.hpp"
+#include "fixed.hpp"
+namespace hops{
+	// MODULE :
+	//        struct IntegerFormat
+	// 
+	// DESCRIPTION :
+	//        The Format of a W-bit integer type, signed when S is
+	//        true. with<WR, IR, SR>::type is the intw<WR> or
+	//        uintw<WR> with the sign SR.
+	template <int W, bool S>
+	struct IntegerFormat{
+		static const int width = W;
+		static const int integer = W;
+		static const bool is_signed = S;
+		static const bool is_fixed = false;
+
+		template <int WR, int IR, bool SR>
+		struct with{
+			typedef typename std::conditional<SR, intw<WR>, uintw<WR> >::type type;
+		};
+	};
+
+	// MODULE :
+	//        struct Format
+	// 
+	// DESCRIPTION :
+	//        Format<T> describes an integer or fixed-point type T:
+	//        its width (including the sign bit), its integer bits,
+	//        whether it is signed or fixed-point, and
+	//        Format<T>::with<W, I, S>::type, the type of the same
+	//        kind (and, for a fixed-point type, with the same
+	//        quantization and overflow modes) with W bits, I
+	//        integer bits and the sign S.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            A native integer, or a type of fixed.hpp
+	//
+	// NOTES :
+	//        Format is specialized for Integer and Fixed in host
+	//        builds, and for ap_int, ap_uint, ap_fixed and
+	//        ap_ufixed when __SYNTHESIS__ is defined, so the other
+	//        modules of this file apply to the types that the names
+	//        of fixed.hpp refer to in either build.
+	template <typename T>
+	struct Format : public IntegerFormat<std::numeric_limits<T>::digits + std::is_signed<T>::value,
+					     std::is_signed<T>::value>{
+		static_assert(std::is_integral<T>::value, "Format requires an integer or fixed-point type");
+	};
+
+#ifdef __SYNTHESIS__
+	template <int W>
+	struct Format<ap_int<W> > : public IntegerFormat<W, true>{
+	};
+
+	template <int W>
+	struct Format<ap_uint<W> > : public IntegerFormat<W, false>{
+	};
+
+	// The Format of ap_fixed (S = true) and ap_ufixed
+	template <int W, int I, ap_q_mode Q, ap_o_mode O, int N, bool S>
+	struct ApFixedFormat{
+		static const int width = W;
+		static const int integer = I;
+		static const bool is_signed = S;
+		static const bool is_fixed = true;
+
+		template <int WR, int IR, bool SR>
+		struct with{
+			typedef typename std::conditional<SR, ap_fixed<WR, IR, Q, O, N>,
+							  ap_ufixed<WR, IR, Q, O, N> >::type type;
+		};
+	};
+
+	template <int W, int I, ap_q_mode Q, ap_o_mode O, int N>
+	struct Format<ap_fixed<W, I, Q, O, N> > : public ApFixedFormat<W, I, Q, O, N, true>{
+	};
+
+	template <int W, int I, ap_q_mode Q, ap_o_mode O, int N>
+	struct Format<ap_ufixed<W, I, Q, O, N> > : public ApFixedFormat<W, I, Q, O, N, false>{
+	};
+#else
+	template <int W, bool S>
+	struct Format<Integer<W, S> > : public IntegerFormat<W, S>{
+	};
+
+	template <int W, int I, Quantization Q, Overflow O, bool S>
+	struct Format<Fixed<W, I, Q, O, S> >{
+		static const int width = W;
+		static const int integer = I;
+		static const bool is_signed = S;
+		static const bool is_fixed = true;
+
+		template <int WR, int IR, bool SR>
+		struct with{
+			typedef Fixed<WR, IR, Q, O, SR> type;
+		};
+	};
+#endif
+
+	// MODULE :
+	//        struct Width
+	// 
+	// DESCRIPTION :
+	//        Width<T>::value is the number of bits of T (including
+	//        the sign bit), and Width<T>::is_signed is true when T
+	//        is signed
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            A native integer, or a type of fixed.hpp
+	template <typename T>
+	struct Width{
+		static const int value = Format<T>::width;
+		static const bool is_signed = Format<T>::is_signed;
+	};
+
+	// MODULE :
+	//        struct Resize
+	// 
+	// DESCRIPTION :
+	//        Resize<T, W>::type is T with W bits: a fixed-point
+	//        type with the fractional bits of T, or an integer
+	//        type with the sign of T
+	template <typename T, int W>
+	struct Resize{
+		static_assert(W <= 64, "Accumulators are limited to 64 bits");
+		typedef Format<T> format;
+		typedef typename format::template with<W, format::integer + (W - format::width),
+						       format::is_signed>::type type;
+	};
+
+	// MODULE :
+	//        struct Widen
+	// 
+	// DESCRIPTION :
+	//        Widen<T, B>::type is T with B more (integer) bits
+	template <typename T, int B>
+	struct Widen{
+		typedef typename Resize<T, Width<T>::value + B>::type type;
+	};
+
+	// MODULE :
+	//        struct Common
+	// 
+	// DESCRIPTION :
+	//        Common<TL, TR>::type is the narrowest type that holds
+	//        every value of TL and TR: the most integer bits and
+	//        the most fractional bits of the two. It is a
+	//        fixed-point type (with the modes of TL, if TL is one)
+	//        when either type is, and an integer type otherwise.
+	//        An unsigned type takes one more bit when the other is
+	//        signed. Fractional bits are reduced to fit in 64 bits.
+	template <typename TL, typename TR>
+	struct Common{
+		typedef Format<TL> fl;
+		typedef Format<TR> fr;
+		static const bool is_signed = fl::is_signed || fr::is_signed;
+		static const int il = fl::integer + (is_signed && !fl::is_signed);
+		static const int ir = fr::integer + (is_signed && !fr::is_signed);
+		static const int i = (il > ir) ? il : ir;
+		static const int f = ((fl::width - fl::integer) > (fr::width - fr::integer)) ?
+			(fl::width - fl::integer) : (fr::width - fr::integer);
+		static const int w = (i + f > 64 && i < 64) ? 64 : i + f;
+		typedef typename std::conditional<fl::is_fixed || !fr::is_fixed, fl, fr>::type format;
+		typedef typename format::template with<w, i, is_signed>::type type;
+	};
+
+	// MODULE :
+	//        struct Growth
+	// 
+	// DESCRIPTION :
+	//        Growth<OP, TL, TR>::type is the narrowest type that
+	//        holds OP<T>()(L, R) for every L of type TL and R of
+	//        type TR. OP may be std::plus (one bit more than the
+	//        Common type) or std::multiplies (the sums of the
+	//        widths and of the integer bits).
+	template <template <typename> class OP, typename TL, typename TR>
+	struct Growth;
+
+	template <typename TL, typename TR>
+	struct Growth<std::plus, TL, TR>{
+		typedef typename Widen<typename Common<TL, TR>::type, 1>::type type;
+	};
+
+	template <typename TL, typename TR>
+	struct Growth<std::multiplies, TL, TR>{
+		typedef Format<TL> fl;
+		typedef Format<TR> fr;
+		typedef typename std::conditional<fl::is_fixed || !fr::is_fixed, fl, fr>::type format;
+		typedef typename format::template with<fl::width + fr::width, fl::integer + fr::integer,
+						       fl::is_signed || fr::is_signed>::type type;
+	};
+
+	// MODULE :
+	//        struct Accumulator
+	// 
+	// DESCRIPTION :
+	//        Accumulator<T, LEN>::type is the narrowest type that
+	//        holds the sum of LEN values of type T: T with
+	//        clog2(LEN) more bits. It is the type of the
+	//        accumulator of a chain (lreduce or rreduce), where
+	//        every step shares one register.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            The type of the values
+	//
+	//        LEN : std::size_t
+	//            The number of values
+	template <typename T, std::size_t LEN>
+	struct Accumulator{
+		typedef typename Widen<T, (LEN > 1) ? clog2(LEN) : 0>::type type;
+	};
+
+	// GrowChain<OP, TA, LEN>::type is the accumulator of a chain
+	// of Grow<OP> on LEN values of type TA. A chain of products
+	// grows at every step, so only std::plus has one.
+	template <template <typename> class OP, typename TA, std::size_t LEN>
+	struct GrowChain{
+	};
+
+	template <typename TA, std::size_t LEN>
+	struct GrowChain<std::plus, TA, LEN>{
+		typedef typename Accumulator<TA, LEN>::type type;
+	};
+
+	// MODULE :
+	//        struct Grow
+	// 
+	// DESCRIPTION :
+	//        Applies OP in the type given by Growth, so that the
+	//        result never overflows. Passed to treereduce, each
+	//        level of the tree is as wide as its results need.
+	//        Passed to lreduce or rreduce, Grow<std::plus> adds
+	//        into one accumulator of type Accumulator<TA, LEN>.
+	// 
+	// PARAMETERS :
+	//        OP : template <typename> class
+	//            std::plus or std::multiplies
+	// 
+	// FUNCTIONS :
+	//        auto operator()(TL const&, TR const&) const
+	//
+	// NOTES :
+	//        accumulator<TA, LEN>::type is the accumulator type
+	//        that lreduce and rreduce use for a chain of LEN values
+	//        of type TA (see reduce.hpp). The initialization value
+	//        is converted to it, so it must fit (e.g. 0).
+	template <template <typename> class OP>
+	struct Grow{
+		template <typename TA, std::size_t LEN>
+		struct accumulator : public GrowChain<OP, TA, LEN>{
+		};
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Converts L and R to Growth<OP, TL, TR>::type and
+		//        applies OP
+		// 
+		// RETURNS : Growth<OP, TL, TR>::type
+		template <typename TL, typename TR>
+		auto operator()(TL const& L, TR const& R) const
+			-> typename Growth<OP, TL, TR>::type{
+#pragma HLS INLINE
+			typedef typename Growth<OP, TL, TR>::type res_t;
+			return OP<res_t>()(res_t(L), res_t(R));
+		}
+	};
+
+	// VARIABLE :
+	//        grow_plus (instance of Grow<std::plus>)
+	// 
+	// EXAMPLE :
+	//        std::array<hops::uintw<8>, 5> a = {255, 255, 255, 255, 255};
+	//        auto s = hops::treereduce(hops::grow_plus, a);
+	//        // s === 1275, and decltype(s) === hops::uintw<11>
+	//        auto t = hops::lreduce(hops::grow_plus, 0, a);
+	//        // t === 1275, and decltype(t) === hops::uintw<11>
+	Grow<std::plus> grow_plus;
+
+	// VARIABLE :
+	//        grow_multiplies (instance of Grow<std::multiplies>)
+	// 
+	// EXAMPLE :
+	//        auto p = hops::zipWith(hops::grow_multiplies, a, b);
+	//        // intw<8> * intw<8> gives intw<16>
+	Grow<std::multiplies> grow_multiplies;
+} // namespace hops
+#endif // __GROWTH_HPP
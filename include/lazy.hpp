@@ -0,0 +1,539 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        lazy.hpp
+//
+// DESCRIPTION :
+//        This file implements lazy (expression-template) arrays. A
+//        lazy array records the map, zipWith, reverse, rrotate,
+//        lrotate and tail functions applied to it as a tree of
+//        expression nodes instead of producing a new std::array at
+//        every step. The expression is evaluated element-wise, once,
+//        when it is assigned to a std::array or reduced. split
+//        returns a pair of expressions over the two parts of its
+//        input.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        LazyExpr
+//        LazyArray
+//        LazyMap
+//        LazyZipWith
+//        LazyReverse
+//        LazyRrotate
+//        LazyLrotate
+//        LazyTail
+//        LazySlice
+//
+// PRIVATE MODULES :
+//        LazyOf
+//
+// PUBLIC FUNCTIONS :
+//        lazy
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        Lazy mode is opt-in: wrap an array with lazy(a) and pass
+//        the result to map, zipWith, reverse, rrotate, lrotate,
+//        tail, split or head as usual. Those functions recognize a lazy argument by
+//        its member functions, so map.hpp, zip.hpp and arrayops.hpp
+//        do not depend on this file. divconq splits a lazy argument
+//        into expressions, and the other Higher-Order Functions
+//        (lreduce, lscan, butterfly, ...) evaluate a lazy argument
+//        once before using it.
+//
+//        LazyArray holds a reference to its std::array, like
+//        Partial. An expression must not outlive the arrays it was
+//        built from. Functions and child expressions are held by
+//        value.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __LAZY_HPP
+#define __LAZY_HPP
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "arrayops.hpp"
+namespace hops{
+	template <class E, typename T, std::size_t LEN>
+	struct LazyExpr;
+
+	template <typename T, std::size_t LEN>
+	struct LazyArray;
+
+	template <class FN, class E>
+	struct LazyMap;
+
+	template <class FN, class E, class... ES>
+	struct LazyZipWith;
+
+	template <class E>
+	struct LazyReverse;
+
+	template <class E>
+	struct LazyRrotate;
+
+	template <class E>
+	struct LazyLrotate;
+
+	template <class E>
+	struct LazyTail;
+
+	template <class E, std::size_t OFFSET, std::size_t LEN>
+	struct LazySlice;
+
+	// MODULE :
+	//        struct LazyOf
+	// 
+	// DESCRIPTION :
+	//        Maps an argument type to the expression node type that
+	//        stands for it: a std::array becomes a LazyArray, and an
+	//        expression node is left unchanged.
+	// 
+	// PARAMETERS :
+	//        X : class
+	//            A std::array, or an expression node type
+	template <class X>
+	struct LazyOf{
+		typedef X type;
+	};
+
+	template <typename T, std::size_t LEN>
+	struct LazyOf<std::array<T, LEN> >{
+		typedef LazyArray<T, LEN> type;
+	};
+
+	// MODULE :
+	//        struct LazyExpr
+	// 
+	// DESCRIPTION :
+	//        Base class of every expression node. It provides the
+	//        functions that extend an expression (map, zipWith,
+	//        reverse, rrotate, lrotate, tail), and the functions
+	//        that evaluate it (eval, and conversion to std::array).
+	//        The derived node E provides operator[], which computes
+	//        a single element of the expression.
+	// 
+	// PARAMETERS :
+	//        E : class
+	//            The derived expression node type
+	//
+	//        T : typename
+	//            Type of the elements of the expression
+	//
+	//        LEN : std::size_t
+	//            Length of the expression
+	//
+	// FUNCTIONS :
+	//        static constexpr std::size_t size()
+	//        LazyMap<FN, E> map(FN const&) const
+	//        LazyZipWith<FN, E, ...> zipWith(FN const&, ES const&...) const
+	//        LazyReverse<E> reverse() const
+	//        LazyRrotate<E> rrotate() const
+	//        LazyLrotate<E> lrotate() const
+	//        LazyTail<E> tail() const
+	//        std::pair<LazySlice<E, ...>, LazySlice<E, ...> > split() const
+	//        T head() const
+	//        std::array<T, LEN> eval() const
+	//        operator std::array<T, LEN>() const
+	//
+	// NOTES :
+	//        The trailing const declaration on the member
+	//        functions is required by our library, and indicates
+	//        to the compiler that the method modifies no internal
+	//        state
+	template <class E, typename T, std::size_t LEN>
+	struct LazyExpr{
+		typedef T value_type;
+		typedef std::array<T, LEN> array_type;
+
+		static constexpr std::size_t size(){
+			return LEN;
+		}
+
+		template <class FN>
+		LazyMap<FN, E> map(FN const& F) const{
+#pragma HLS INLINE
+			return LazyMap<FN, E>(F, self());
+		}
+
+		// The remaining arguments may be std::arrays, or
+		// expression nodes
+		template <class FN, class... ES>
+		LazyZipWith<FN, E, typename LazyOf<ES>::type...>
+		zipWith(FN const& F, ES const&... IN) const{
+#pragma HLS INLINE
+			return LazyZipWith<FN, E, typename LazyOf<ES>::type...>
+				(F, self(), typename LazyOf<ES>::type(IN)...);
+		}
+
+		LazyReverse<E> reverse() const{
+#pragma HLS INLINE
+			return LazyReverse<E>(self());
+		}
+
+		LazyRrotate<E> rrotate() const{
+#pragma HLS INLINE
+			return LazyRrotate<E>(self());
+		}
+
+		LazyLrotate<E> lrotate() const{
+#pragma HLS INLINE
+			return LazyLrotate<E>(self());
+		}
+
+		LazyTail<E> tail() const{
+#pragma HLS INLINE
+			return LazyTail<E>(self());
+		}
+
+		// As with split on arrays, IDX is clamped to LEN
+		template <std::size_t IDX>
+		std::pair<LazySlice<E, 0, (IDX > LEN)? LEN : IDX>,
+			  LazySlice<E, (IDX > LEN)? LEN : IDX, (IDX > LEN)? 0 : LEN - IDX> >
+		split() const{
+#pragma HLS INLINE
+			return {LazySlice<E, 0, (IDX > LEN)? LEN : IDX>(self()),
+				LazySlice<E, (IDX > LEN)? LEN : IDX, (IDX > LEN)? 0 : LEN - IDX>(self())};
+		}
+
+		T head() const{
+#pragma HLS INLINE
+			return self()[0];
+		}
+
+		// Evaluates every element of the expression exactly once,
+		// in index order
+		array_type eval() const{
+#pragma HLS INLINE
+			return elements(make_index_sequence<LEN>());
+		}
+
+		operator array_type() const{
+#pragma HLS INLINE
+			return eval();
+		}
+
+	private:
+		E const& self() const{
+#pragma HLS INLINE
+			return static_cast<E const&>(*this);
+		}
+
+		template <std::size_t... IDX>
+		array_type elements(index_sequence<IDX...>) const{
+#pragma HLS INLINE
+			return {{self()[IDX]...}};
+		}
+	};
+
+	// MODULE :
+	//        struct LazyArray
+	// 
+	// DESCRIPTION :
+	//        The leaf of every expression: a reference to a
+	//        std::array.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the elements in the std::array
+	//
+	//        LEN : std::size_t
+	//            Length of the std::array
+	template <typename T, std::size_t LEN>
+	struct LazyArray : public LazyExpr<LazyArray<T, LEN>, T, LEN>{
+		std::array<T, LEN> const& IN;
+
+		LazyArray(std::array<T, LEN> const& IN) : IN(IN){
+#pragma HLS INLINE
+		}
+
+		T const& operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return IN[idx];
+		}
+	};
+
+	// MODULE :
+	//        struct LazyMap
+	// 
+	// DESCRIPTION :
+	//        The expression map(F, IN): element idx is F(IN[idx])
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of a class-wrapped function
+	//
+	//        E : class
+	//            The expression node type of the input
+	template <class FN, class E>
+	struct LazyMap : public LazyExpr<LazyMap<FN, E>,
+					 typename std::decay<decltype(std::declval<FN const&>()
+								      (std::declval<E const&>()[0]))>::type,
+					 E::size()>{
+		FN F;
+		E IN;
+
+		LazyMap(FN const& F, E const& IN) : F(F), IN(IN){
+#pragma HLS INLINE
+		}
+
+		typename LazyMap::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return F(IN[idx]);
+		}
+	};
+
+	// MODULE :
+	//        struct LazyZipWith
+	// 
+	// DESCRIPTION :
+	//        The expression zipWith(F, A, B, ...): element idx is
+	//        F(A[idx], B[idx], ...)
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of a class-wrapped function
+	//
+	//        E : class
+	//            The expression node type of the first input
+	//
+	//        ES : class...
+	//            The expression node types of the remaining inputs
+	template <class FN, class E, class... ES>
+	struct LazyZipWith : public LazyExpr<LazyZipWith<FN, E, ES...>,
+					     typename std::decay<decltype(std::declval<FN const&>()
+									  (std::declval<E const&>()[0],
+									   std::declval<ES const&>()[0]...))>::type,
+					     E::size()>{
+		// A sequence is equal to its rotation by one exactly when
+		// all of its values are equal
+		static_assert(std::is_same<index_sequence<E::size(), ES::size()...>,
+			      index_sequence<ES::size()..., E::size()> >::value,
+			      "All inputs to zipWith must have the same length");
+
+		FN F;
+		std::tuple<E, ES...> IN;
+
+		LazyZipWith(FN const& F, E const& A, ES const&... B) : F(F), IN(A, B...){
+#pragma HLS INLINE
+		}
+
+		typename LazyZipWith::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return at(idx, make_index_sequence<1 + sizeof...(ES)>());
+		}
+
+	private:
+		template <std::size_t... ARG>
+		typename LazyZipWith::value_type at(std::size_t idx, index_sequence<ARG...>) const{
+#pragma HLS INLINE
+			return F(std::get<ARG>(IN)[idx]...);
+		}
+	};
+
+	// MODULE :
+	//        struct LazyReverse
+	// 
+	// DESCRIPTION :
+	//        The expression reverse(IN): element idx is
+	//        IN[LEN-1-idx]
+	// 
+	// PARAMETERS :
+	//        E : class
+	//            The expression node type of the input
+	template <class E>
+	struct LazyReverse : public LazyExpr<LazyReverse<E>, typename E::value_type, E::size()>{
+		E IN;
+
+		LazyReverse(E const& IN) : IN(IN){
+#pragma HLS INLINE
+		}
+
+		typename E::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return IN[E::size() - 1 - idx];
+		}
+	};
+
+	// MODULE :
+	//        struct LazyRrotate
+	// 
+	// DESCRIPTION :
+	//        The expression rrotate(IN): element 0 is IN[LEN-1], and
+	//        element idx is IN[idx-1] otherwise
+	// 
+	// PARAMETERS :
+	//        E : class
+	//            The expression node type of the input
+	template <class E>
+	struct LazyRrotate : public LazyExpr<LazyRrotate<E>, typename E::value_type, E::size()>{
+		E IN;
+
+		LazyRrotate(E const& IN) : IN(IN){
+#pragma HLS INLINE
+		}
+
+		typename E::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return IN[(idx + E::size() - 1) % E::size()];
+		}
+	};
+
+	// MODULE :
+	//        struct LazyLrotate
+	// 
+	// DESCRIPTION :
+	//        The expression lrotate(IN): element LEN-1 is IN[0], and
+	//        element idx is IN[idx+1] otherwise
+	// 
+	// PARAMETERS :
+	//        E : class
+	//            The expression node type of the input
+	template <class E>
+	struct LazyLrotate : public LazyExpr<LazyLrotate<E>, typename E::value_type, E::size()>{
+		E IN;
+
+		LazyLrotate(E const& IN) : IN(IN){
+#pragma HLS INLINE
+		}
+
+		typename E::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return IN[(idx + 1) % E::size()];
+		}
+	};
+
+	// MODULE :
+	//        struct LazyTail
+	// 
+	// DESCRIPTION :
+	//        The expression tail(IN): element idx is IN[idx+1], and
+	//        the length is one less than the length of IN
+	// 
+	// PARAMETERS :
+	//        E : class
+	//            The expression node type of the input
+	template <class E>
+	struct LazyTail : public LazyExpr<LazyTail<E>, typename E::value_type, E::size() - 1>{
+		static_assert(E::size() > 0, "Cannot take the tail of an empty array");
+
+		E IN;
+
+		LazyTail(E const& IN) : IN(IN){
+#pragma HLS INLINE
+		}
+
+		typename E::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return IN[idx + 1];
+		}
+	};
+
+	// MODULE :
+	//        struct LazySlice
+	// 
+	// DESCRIPTION :
+	//        The LEN elements of IN starting at OFFSET: element idx
+	//        is IN[OFFSET+idx]. It is returned by split.
+	// 
+	// PARAMETERS :
+	//        E : class
+	//            The expression node type of the input
+	//
+	//        OFFSET : std::size_t
+	//            Index in IN of the first element
+	//
+	//        LEN : std::size_t
+	//            Length of the slice
+	template <class E, std::size_t OFFSET, std::size_t LEN>
+	struct LazySlice : public LazyExpr<LazySlice<E, OFFSET, LEN>, typename E::value_type, LEN>{
+		static_assert(OFFSET + LEN <= E::size(), "Slice exceeds the bounds of its input");
+
+		E IN;
+
+		LazySlice(E const& IN) : IN(IN){
+#pragma HLS INLINE
+		}
+
+		typename E::value_type operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return IN[OFFSET + idx];
+		}
+	};
+
+	// FUNCTION :
+	//        lazy
+	// 
+	// DESCRIPTION :
+	//        Wraps a std::array in a LazyArray, so that the
+	//        functions applied to the result build an expression
+	//        instead of a new std::array
+	//
+	// PARAMETERS :
+	//        T : typename (Inferred)
+	//            Type of the elements in the input std::array
+	//
+	//        LEN : std::size_t (Inferred)
+	//            Length of the std::array input argument
+	//
+	// ARGUMENTS :
+	//        IN : std::array<T, LEN> const&
+	//            The input array
+	// 
+	// RETURNS : LazyArray<T, LEN>
+	//            A leaf expression referring to IN
+	//
+	// EXAMPLE :
+	//
+	//            std::array<int, 4> a = {1, 2, 3, 4}, b;
+	//            b = map(mulby2, reverse(lazy(a))); // b === {8, 6, 4, 2}
+	//        
+	// NOTES :
+	//        IN must outlive the expression
+	template <typename T, std::size_t LEN>
+	LazyArray<T, LEN> lazy(std::array<T, LEN> const& IN){
+#pragma HLS INLINE
+		return LazyArray<T, LEN>(IN);
+	}
+} // namespace hops
+#endif // __LAZY_HPP
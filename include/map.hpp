@@ -42,6 +42,7 @@
 // NAMESPACES :
 //        hops
 //        hops::loop
+//        hops::dyn
 //        
 // PUBLIC MODULES :
 //        Map
@@ -57,7 +58,8 @@
 //        standard.
 //        
 //        All classes and variables are defined in both the hops and
-//        hops::loop namespaces
+//        hops::loop namespaces. The hops::dyn namespace defines map
+//        on runtime-length arrays (see span.hpp).
 //
 // AUTHOR : Dustin Richmond (drichmond)
 //
@@ -65,39 +67,47 @@
 #ifndef __MAP_HPP
 #define __MAP_HPP
 #include <array>
+#include <type_traits>
 #include "arrayops.hpp"
+#include "span.hpp"
 namespace hops{
 	// MODULE :
 	//        struct MapHelper
 	// 
 	// DESCRIPTION :
-	//        Implements the linear, loop-like structure of the
-	//        map function using C++ Template Meta-Programming and
-	//        Partial Template Specialization.
+	//        Implements the map function by expanding the wrapped
+	//        function over an index_sequence of every index in
+	//        the input array. Each output element is computed
+	//        directly from the input array without the recursive
+	//        copies of tail and prepend.
 	// 
 	// PARAMETERS :
 	//        LEN : std::size_t
-	//            The length of the input list, and the iteration
-	//            variable for C++ Template Meta-Programming
+	//            The length of the input list
 	// 
 	// FUNCTIONS :
-	//        auto operator()(FN const&, std::array<TL, LEN> const&,
-	//                        std::array<TR, LEN> const&) const
+	//        auto operator()(FN const&, std::array<TA, LEN> const&) const
+	//        auto operator()(FN const&, std::array<TA, LEN> const&,
+	//                        std::false_type) const
+	//        auto operator()(FN const&, std::array<TA, LEN> const&,
+	//                        std::true_type) const
+	//        auto operator()(FN const&, std::array<TA, LEN> const&,
+	//                        index_sequence<IDX...>) const
 	template <std::size_t LEN>
 	struct MapHelper{
 		// FUNCTION :
-		//        map
+		//        operator()
 		// 
 		// DESCRIPTION :
-		//        Implements the map function using C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by MapHelper
+		//        Implements the map function using a single
+		//        pack expansion of the index_sequence 0, 1,
+		//        ... LEN-1
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
         	//            Typename of a wrapped function. 
 		//
-		//        T : typename (Inferred)
+		//        TA : typename (Inferred)
 		//            Type of the the std::array values in
 		//            input array
 		//
@@ -107,7 +117,7 @@ namespace hops{
 		//            to compute an output value at each array
 		//            location
 		//
-		//        IN : std::array<T, LEN> const&
+		//        IN : std::array<TA, LEN> const&
 		//            Input array whose elements will be
 		//            passed as the first argument to F's
 		//            operator() function
@@ -127,68 +137,78 @@ namespace hops{
 			-> std::array<decltype(F(IN[0])), LEN>{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return prepend(F(IN[0]),
-				MapHelper<LEN-1>()(F, tail(IN)));
+			return (*this)(F, IN, BlockExpandHelper<LEN>());
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Selects the implementation for the array
+		//        length: a braced initializer over every index
+		//        (std::false_type), or BlockExpandHelper for long
+		//        arrays (std::true_type)
+		template<class FN, typename TA>
+		auto operator()(FN const& F, std::array<TA, LEN> const& IN,
+				std::false_type BLOCKED) const
+			-> std::array<decltype(F(IN[0])), LEN>{
+#pragma HLS INLINE
+			return (*this)(F, IN, make_index_sequence<LEN>());
+		}
+
+		template<class FN, typename TA>
+		auto operator()(FN const& F, std::array<TA, LEN> const& IN,
+				std::true_type BLOCKED) const
+			-> std::array<decltype(F(IN[0])), LEN>{
+#pragma HLS INLINE
+			return BlockExpandHelper<LEN>::expand(F, IN);
 		}
-	};
 
-	// MODULE :
-	//        struct MapHelper
-	// 
-	// DESCRIPTION :
-	//        Base-case implementation of MapHelper for a
-	//        loop-like structure using C++ Template
-	//        Meta-Programming and Partial Template
-	//        Specialization on LEN = 0
-	// 
-	// FUNCTIONS :
-	//        auto operator()(FN const& F, std::array<TA, 0> const&) const
-	template <>
-	struct MapHelper<0>{
 		// FUNCTION :
-		//        map
+		//        operator()
 		// 
 		// DESCRIPTION :
-		//        Implements the base map function in the
-		//        linear recursive structure defined by C++
-		//        Template Metaprogramming
+		//        Applies F to the element at every index in
+		//        the index_sequence argument
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
         	//            Typename of a wrapped function. 
 		//
-		//        T : typename (Inferred)
+		//        TA : typename (Inferred)
 		//            Type of the the std::array values in
 		//            input array
 		//
+		//        IDX : std::size_t... (Inferred)
+		//            The indicies of the input array
+		//
 		// ARGUMENTS : 
 		//        F : FN const&
 		//            Instantiation of a wrapped function used
 		//            to compute an output value at each array
 		//            location
 		//
-		//        IN : std::array<T, 0> const&
-		//            Nil input array whose elements will be
+		//        IN : std::array<TA, LEN> const&
+		//            Input array whose elements will be
 		//            passed as the first argument to F's
 		//            operator() function
 		// 
-		// RETURNS : std::array<decltype(F(IN[0])), 0>
-		//        A Nil array where the element type is the
-		//        result of F's operator() function applied
-		//        to a hypothetical value in the array
-		// 
-		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<class FN, typename TA>
-		auto operator()(FN const& F, std::array<TA, 0> const& IN) const
-			-> std::array<decltype(F(IN[0])), 0>{
+		//        SEQ : index_sequence<IDX...>
+		//            Unused, except to deduce IDX
+		//
+		// RETURNS : std::array<decltype(F(IN[0])), LEN>
+		//        An array where the output at each location
+		//        is the result of F's operator() function
+		//        applied each value in the input array.
+		template<class FN, typename TA, std::size_t... IDX>
+		auto operator()(FN const& F, std::array<TA, LEN> const& IN,
+				index_sequence<IDX...> SEQ) const
+			-> std::array<decltype(F(IN[0])), LEN>{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			std::array<decltype(F(IN[0])), 0> nil;
-			return nil;
+			std::array<decltype(F(IN[0])), LEN> res = {{F(IN[IDX])...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=res._M_instance
+			return res;
 		}
 	};
 
@@ -197,16 +217,22 @@ namespace hops{
 	// 
 	// DESCRIPTION :
 	//        Wraps the map function using the operator() function
-	//        to provide a function-like API on top of the linear
-	//        recursive structure the MapHelper with the .
+	//        to provide a function-like API on top of the
+	//        structure defined by MapHelper.
 	// 
 	// FUNCTIONS :
 	//        auto operator()(FN const& F, std::array<TA, LEN> const&) const
+	//        auto operator()(FN const& F, E const&) const
+	//        auto operator()(P const&, AS const&...) const
 	//
 	// NOTES :
 	//        A corresponding loop-based implementation is defined
 	//        in the hops::loop namespace
 	//
+	//        When the input is a lazy expression (see lazy.hpp) the
+	//        result is a lazy expression, evaluated when it is
+	//        assigned to a std::array or reduced.
+	//
 	//        The trailing const declaration on the
 	//        operator() function is required by our
 	//        library, and indicates to the compiler that
@@ -219,6 +245,21 @@ namespace hops{
 #pragma HLS INLINE
 			return MapHelper<LEN>()(F, IN);
 		}
+
+		template<class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(IN.map(F)){
+#pragma HLS INLINE
+			return IN.map(F);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.map(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.map(ARGS...);
+		}
 	};
 
 	// VARIABLE :
@@ -321,5 +362,80 @@ namespace hops{
 		//        in the hops::loop namespace
 		Map map;
 	} // namespace loop
+
+	namespace dyn{
+		// MODULE :
+		//        struct Map
+		// 
+		// DESCRIPTION :
+		//        Implements the map function on runtime-length
+		//        arrays (see span.hpp) using a loop in the
+		//        operator() function to provide a function-like
+		//        API.
+		// 
+		// FUNCTIONS :
+		//        Span<TO> operator()(FN const& F, CO&& OUT, CA const& IN) const
+		//
+		// NOTES :
+		//        F is the same function object that is passed to
+		//        hops::map.
+		struct Map{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Writes F applied to each element of IN to
+			//        the corresponding element of OUT
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a wrapped function. 
+			//
+			//        CO, CA : class (Inferred)
+			//            Types of the output and input: a
+			//            std::vector, std::array or Span
+			//
+			// ARGUMENTS : 
+			//        F : FN const&
+			//            Instantiation of a wrapped function used
+			//            to compute an output value at each array
+			//            location
+			//
+			//        OUT : CO&&
+			//            Output array, with the length of IN. OUT
+			//            may be IN.
+			//
+			//        IN : CA const&
+			//            Input array whose elements will be
+			//            passed as the first argument to F's
+			//            operator() function
+			// 
+			// RETURNS : Span<TO>
+			//        A Span of OUT
+			template <class FN, class CO, class CA>
+			auto operator()(FN const& F, CO&& OUT, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				assert(out.size() == IN.size());
+				for(std::size_t i = 0; i < out.size(); ++i){
+					out[i] = F(IN.data()[i]);
+				}
+				return out;
+			}
+		};
+
+		// VARIABLE :
+		//        map (instance of Map)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length map struct that
+		//        provides a function-like API with the
+		//        operator() function.
+		//
+		// EXAMPLE :
+		//            std::vector<int> a = {1, 2, 3, 4}, b(4);
+		//            dyn::map(mulby2, b, a); // b === {2, 4, 6, 8}
+		Map map;
+	} // namespace dyn
 } // namespace hops
 #endif //__MAP_HPP
@@ -0,0 +1,432 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        mapreduce.hpp
+//
+// DESCRIPTION :
+//        This file implements the mapreduce Higher-Order Function,
+//        which fuses a (multi-array) map with a reduction so that the
+//        intermediate array of mapped values is never materialized.
+//        The shape of the reduction is selected with a policy class:
+//        Chain or Tree.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Chain
+//        Tree
+//        Mapreduce
+// 
+// PRIVATE MODULES :
+//        LaneCount
+//        SameLanes
+//        MapTreeHelper
+//
+// PUBLIC VARIABLES :
+//        mapreduce (an instance of Mapreduce<Chain>)
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        mapreduce(M, R, INIT, A, B) computes the same result as
+//        lreduce(R, INIT, zipWith(M, A, B)) with the Chain policy,
+//        and R(INIT, treereduce(R, zipWith(M, A, B))) with the Tree
+//        policy.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __MAPREDUCE_HPP
+#define __MAPREDUCE_HPP
+#include <array>
+#include <type_traits>
+#include "arrayops.hpp"
+namespace hops{
+	// MODULE :
+	//        struct LaneCount
+	// 
+	// DESCRIPTION :
+	//        LaneCount<A>::value is the length of A, a std::array
+	//        or a lazy expression (see lazy.hpp)
+	template <class A>
+	struct LaneCount : public std::tuple_size<typename std::decay<
+		decltype(evaluate(std::declval<A const&>()))>::type>{
+	};
+
+	// MODULE :
+	//        struct SameLanes
+	// 
+	// DESCRIPTION :
+	//        SameLanes<LEN, AS...>::value is true when every one of
+	//        AS has LEN lanes
+	template <std::size_t LEN, class... AS>
+	struct SameLanes : public std::true_type{
+	};
+
+	template <std::size_t LEN, class A, class... AS>
+	struct SameLanes<LEN, A, AS...>
+		: public std::integral_constant<bool, LaneCount<A>::value == LEN &&
+						SameLanes<LEN, AS...>::value>{
+	};
+
+	// MODULE :
+	//        struct Chain
+	// 
+	// DESCRIPTION :
+	//        Reduction policy implementing a linear chain of
+	//        applications of R, from left to right, starting
+	//        with INIT. 
+	// 
+	// FUNCTIONS :
+	//        TI operator()(FNM const&, FNR const&, TI const&,
+	//                      std::array<TA, LEN> const&,
+	//                      std::array<TS, LEN> const&...) const
+	//        TI operator()(FNM const&, FNR const&, TI const&,
+	//                      EA const&, ES const&...) const
+	//
+	// NOTES :
+	//        The chain has LEN applications of R and a depth of
+	//        LEN. R does not need to be associative.
+	struct Chain{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies M to each lane of the input arrays, and
+		//        accumulates the results with R from left to
+		//        right.
+		// 
+		// PARAMETERS :
+		//        FNM : class (Inferred)
+		//            Typename of the class-wrapped map function
+		// 
+		//        FNR : class (Inferred)
+		//            Typename of the class-wrapped reduce
+		//            function
+		//
+		//        TI : typename (Inferred)
+		//            Type of the initial (and accumulated) value
+		//
+		//        TA, TS : typename (Inferred)
+		//            Types of the values in the input arrays
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the input arrays
+		//
+		// ARGUMENTS :
+		//        M : FNM const&
+		//            Instantiation of the class-wrapped function
+		//            applied to each lane. M takes one argument
+		//            per input array.
+		//
+		//        R : FNR const&
+		//            Instantiation of the class-wrapped function
+		//            R(accumulator, mapped value)
+		//
+		//        INIT : TI const&
+		//            The initial value of the accumulator
+		//
+		//        A, IN : std::array<TA, LEN>, std::array<TS, LEN>...
+		//            One or more input arrays of equal length
+		// 
+		// RETURNS : TI
+		//        The accumulated value
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FNM, class FNR, typename TI, typename TA,
+			  std::size_t LEN, typename... TS>
+		TI operator()(FNM const& M, FNR const& R, TI const& INIT,
+			std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS INLINE
+			TI acc = INIT;
+			for(std::size_t i = 0; i < LEN; ++i){
+#pragma HLS UNROLL
+				acc = R(acc, M(A[i], IN[i]...));
+			}
+			return acc;
+		}
+
+		// As above, when any input is a view or lazy expression
+		// (see view.hpp and lazy.hpp), which is indexed in place
+		template <class FNM, class FNR, typename TI, class EA, class... ES>
+		auto operator()(FNM const& M, FNR const& R, TI const& INIT,
+				EA const& A, ES const&... IN) const
+			-> typename std::enable_if<AnyLazy<EA, ES...>::value, TI>::type{
+#pragma HLS INLINE
+			static_assert(SameLanes<LaneCount<EA>::value, ES...>::value,
+				"inputs must have the same length");
+			TI acc = INIT;
+			for(std::size_t i = 0; i < LaneCount<EA>::value; ++i){
+#pragma HLS UNROLL
+				acc = R(acc, M(A[i], IN[i]...));
+			}
+			return acc;
+		}
+	};
+
+	// MODULE :
+	//        struct MapTreeHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the balanced binary tree of the Tree
+	//        policy using C++ Template Meta-Programming and
+	//        Partial Template Specialization.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The number of lanes in this sub-tree
+	// 
+	// FUNCTIONS :
+	//        auto run(FNM const&, FNR const&, std::size_t,
+	//                 AS const&...)
+	//
+	// NOTES :
+	//        The offset of the sub-tree is a function argument,
+	//        rather than a template parameter, so only O(log(LEN))
+	//        templates are instantiated.
+	template <std::size_t LEN>
+	struct MapTreeHelper{
+		// FUNCTION :
+		//        run
+		// 
+		// DESCRIPTION :
+		//        Reduces lanes LO to LO + LEN - 1 of the mapped
+		//        inputs, which are arrays or lazy expressions.
+		//
+		// RETURNS : auto
+		//        The return type of M
+		template <class FNM, class FNR, class... AS>
+		static auto run(FNM const& M, FNR const& R, std::size_t LO,
+				AS const&... IN)
+			-> decltype(M(IN[0]...)){
+#pragma HLS INLINE
+			return R(MapTreeHelper<LEN / 2>::run(M, R, LO, IN...),
+				MapTreeHelper<LEN - LEN / 2>::run(M, R, LO + LEN / 2, IN...));
+		}
+	};
+
+	// MODULE :
+	//        struct MapTreeHelper
+	// 
+	// DESCRIPTION :
+	//        Implements a leaf (LEN = 1) of the balanced binary
+	//        tree of the Tree policy.
+	// 
+	// FUNCTIONS :
+	//        auto run(FNM const&, FNR const&, std::size_t,
+	//                 AS const&...)
+	template <>
+	struct MapTreeHelper<1>{
+		// FUNCTION :
+		//        run
+		// 
+		// DESCRIPTION :
+		//        Applies M to lane LO of the input arrays
+		//
+		// RETURNS : auto
+		//        The return type of M
+		template <class FNM, class FNR, class... AS>
+		static auto run(FNM const& M, FNR const& R, std::size_t LO,
+				AS const&... IN)
+			-> decltype(M(IN[0]...)){
+#pragma HLS INLINE
+			return M(IN[LO]...);
+		}
+	};
+
+	// MODULE :
+	//        struct Tree
+	// 
+	// DESCRIPTION :
+	//        Reduction policy implementing a balanced binary tree
+	//        of applications of R, whose result is combined with
+	//        INIT.
+	// 
+	// FUNCTIONS :
+	//        TI operator()(FNM const&, FNR const&, TI const&,
+	//                      std::array<TA, LEN> const&,
+	//                      std::array<TS, LEN> const&...) const
+	//        TI operator()(FNM const&, FNR const&, TI const&,
+	//                      EA const&, ES const&...) const
+	//
+	// NOTES :
+	//        The tree has LEN applications of R and a depth of
+	//        clog2(LEN) + 1. R must be associative, and must
+	//        accept and return the type returned by M.
+	struct Tree{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies M to each lane of the input arrays, and
+		//        reduces the results with a balanced tree of R.
+		// 
+		// PARAMETERS :
+		//        See Chain::operator()
+		//
+		// ARGUMENTS :
+		//        See Chain::operator()
+		// 
+		// RETURNS : TI
+		//        R(INIT, the tree reduction of the mapped values)
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FNM, class FNR, typename TI, typename TA,
+			  std::size_t LEN, typename... TS>
+		TI operator()(FNM const& M, FNR const& R, TI const& INIT,
+			std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS INLINE
+			static_assert(LEN > 0, "Tree requires at least one lane");
+			return R(INIT, MapTreeHelper<LEN>::run(M, R, 0, A, IN...));
+		}
+
+		// As above, when any input is a view or lazy expression
+		// (see view.hpp and lazy.hpp), which is indexed in place
+		template <class FNM, class FNR, typename TI, class EA, class... ES>
+		auto operator()(FNM const& M, FNR const& R, TI const& INIT,
+				EA const& A, ES const&... IN) const
+			-> typename std::enable_if<AnyLazy<EA, ES...>::value, TI>::type{
+#pragma HLS INLINE
+			static_assert(SameLanes<LaneCount<EA>::value, ES...>::value,
+				"inputs must have the same length");
+			static_assert(LaneCount<EA>::value > 0, "Tree requires at least one lane");
+			return R(INIT, MapTreeHelper<LaneCount<EA>::value>::run(M, R, 0, A, IN...));
+		}
+	};
+
+	// MODULE :
+	//        struct Mapreduce
+	// 
+	// DESCRIPTION :
+	//        Wraps the reduction selected by TOPOLOGY with the ()
+	//        operator to provide a function-like API.
+	// 
+	// PARAMETERS :
+	//        TOPOLOGY : class
+	//            Reduction policy: Chain (Default) or Tree
+	// 
+	// FUNCTIONS :
+	//        TI operator()(FNM const&, FNR const&, TI const&,
+	//                      std::array<TA, LEN> const&,
+	//                      std::array<TS, LEN> const&...) const
+	//        TI operator()(FNM const&, FNR const&, TI const&,
+	//                      EA const&, ES const&...) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        Inputs that are views or lazy expressions (see
+	//        view.hpp and lazy.hpp) are indexed in place by the
+	//        topology, without intermediate arrays.
+	template <class TOPOLOGY = Chain>
+	struct Mapreduce{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies M to each lane of the input arrays and
+		//        reduces the results with R, without storing the
+		//        mapped values in an intermediate array.
+		// 
+		// PARAMETERS :
+		//        See Chain::operator()
+		//
+		// ARGUMENTS :
+		//        See Chain::operator()
+		// 
+		// RETURNS : TI
+		//        The reduced value
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FNM, class FNR, typename TI, typename TA,
+			  std::size_t LEN, typename... TS>
+		TI operator()(FNM const& M, FNR const& R, TI const& INIT,
+			std::array<TA, LEN> const& A,
+			std::array<TS, LEN> const&... IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS INLINE
+			return TOPOLOGY()(M, R, INIT, A, IN...);
+		}
+
+		template <class FNM, class FNR, typename TI, class EA, class... ES>
+		auto operator()(FNM const& M, FNR const& R, TI const& INIT,
+				EA const& A, ES const&... IN) const
+			-> typename std::enable_if<AnyLazy<EA, ES...>::value, TI>::type{
+#pragma HLS INLINE
+			return TOPOLOGY()(M, R, INIT, A, IN...);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.template mapreduce<TOPOLOGY>(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.template mapreduce<TOPOLOGY>(ARGS...);
+		}
+	};
+
+	// VARIABLE :
+	//        mapreduce (Instance of Mapreduce<Chain>)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Mapreduce struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//        std::array<int, 3> a = {1, 2, 3}, b = {4, 5, 6};
+	//        int dot = mapreduce(std::multiplies<int>(),
+	//                            std::plus<int>(), 0, a, b); // 32
+	//        int sq = Mapreduce<Tree>()(square, std::plus<int>(),
+	//                                   0, a); // 14
+	Mapreduce<> mapreduce;
+} // namespace hops
+#endif // __MAPREDUCE_HPP
@@ -38,33 +38,52 @@
 //
 // DESCRIPTION :
 //        This file implements the left and right reduce functions
-//        lreduce and reduce using C++ Template Metaprogramming.
+//        lreduce and reduce, and the tree reduce function treereduce
+//        using C++ Template Metaprogramming.
 //       
 // NAMESPACES :
 //        hops
+//        hops::dyn
 //
 // PUBLIC MODULES :
 //        Lreduce
 //        Rreduce
+//        Treereduce
 //
 // PRIVATE MODULES :
 //        ReduceHelper
+//        TreereduceHelper
+//        ReduceStep
+//        ReduceChain
 //
 // PUBLIC VARIABLES :
 //        lreduce
 //        rreduce
+//        treereduce
 //
 // NOTES :
 //        This file requires a compiler implementing the C++11
 //        standard.
 //
+//        The hops::dyn namespace defines lreduce, rreduce and
+//        treereduce on runtime-length arrays (see span.hpp).
+//
+//        The wrapped function of treereduce may return a type
+//        other than the type of its arguments, so each level of
+//        the tree can have its own type. growth.hpp uses this to
+//        widen each level by one bit (grow_plus). lreduce and
+//        rreduce instead convert every result of grow_plus to
+//        one accumulator type (see ReduceChain and Accumulator).
+//
 // AUTHOR : Dustin Richmond (drichmond)
 //
 // **********************************************************************
 #ifndef __REDUCE_HPP
 #define __REDUCE_HPP
 #include <array>
+#include <type_traits>
 #include "arrayops.hpp"
+#include "span.hpp"
 namespace hops{
 	// MODULE :
 	//        struct ReduceHelper
@@ -72,16 +91,33 @@ namespace hops{
 	// DESCRIPTION :
 	//        Implements the linear, loop-like recursive structure
 	//        of lreduce and rreduce functions using C++ Template
-	//        Meta-Programming
+	//        Meta-Programming. The LEN elements starting at BASE
+	//        are reduced by reducing the first LEN/2 elements and
+	//        then the remaining LEN - LEN/2 elements, so the
+	//        functions are still applied in order, one after
+	//        another, but the template recursion depth is
+	//        clog2(LEN) instead of LEN.
 	// 
 	// PARAMETERS :
 	//        LEN : std::size_t
-	//            The length of the input list, and the iteration
-	//            variable for C++ Template Meta-Programming
+	//            The number of elements to reduce, and the
+	//            iteration variable for C++ Template
+	//            Meta-Programming
 	// 
 	// FUNCTIONS :
-	//        auto lreduce(FN const&, TI const&, std::array<TA, LEN> const&)
-	//        auto rreduce(FN const&, std::array<TA, LEN> const&, TI const&)
+	//        auto lreduce(FN const&, TI const&,
+	//                     std::array<TA, ALEN> const&, std::size_t) const
+	//        auto rreduce(FN const&, std::array<TA, ALEN> const&,
+	//                     TI const&, std::size_t) const
+	//        auto lreduce(FN const&, TI const&, E const&,
+	//                     std::size_t) const
+	//        auto rreduce(FN const&, E const&, TI const&,
+	//                     std::size_t) const
+	//
+	// NOTES :
+	//        BASE is a function argument rather than a template
+	//        parameter so that each LEN is instantiated once. It is
+	//        a constant after inlining.
 	template <std::size_t LEN>
 	struct ReduceHelper{
 		// FUNCTION :
@@ -90,7 +126,7 @@ namespace hops{
 		// DESCRIPTION :
 		//        Implements the lreduce function with C++
 		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        structure defined by ReduceHelper
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
@@ -103,6 +139,9 @@ namespace hops{
 		//            Type of the the values in the std::array
 		//            argument
 		//
+		//        ALEN : std::size_t (Inferred)
+		//            Length of the std::array argument
+		//
 		// ARGUMENTS :
 		//        F : FN const&
 		//            Wrapped object, unused except in
@@ -112,19 +151,27 @@ namespace hops{
 		//        INIT : TI const&
 		//            Initialization value argument
 		//
-		//        IN : std::array<TA, LEN> const&
-		//            Input array whose elements will be
-		//            reduced
+		//        IN : std::array<TA, ALEN> const&
+		//            Input array whose elements BASE to
+		//            BASE + LEN - 1 will be reduced
 		// 
+		//        BASE : std::size_t
+		//            Index of the first element to reduce
+		//
 		// RETURNS : auto
 		//            The return type is determined by the
 		//            wrapped function FN
-		template<class FN, typename TI, typename TA>
-		auto lreduce(FN const& F, TI const& INIT, std::array<TA, LEN> const& IN) const 
-			-> decltype(ReduceHelper<LEN-1>().lreduce(F, F(INIT, head(IN)), tail(IN))) {
+		template<class FN, typename TI, typename TA, std::size_t ALEN>
+		auto lreduce(FN const& F, TI const& INIT, std::array<TA, ALEN> const& IN,
+			std::size_t BASE) const 
+			-> decltype(ReduceHelper<LEN - LEN/2>().lreduce(F,
+					ReduceHelper<LEN/2>().lreduce(F, INIT, IN, BASE),
+					IN, BASE)) {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return ReduceHelper<LEN-1>().lreduce(F, F(INIT, head(IN)), tail(IN));
+			return ReduceHelper<LEN - LEN/2>().lreduce(F,
+				ReduceHelper<LEN/2>().lreduce(F, INIT, IN, BASE),
+				IN, BASE + LEN/2);
 		}
 
 		// FUNCTION :
@@ -133,7 +180,7 @@ namespace hops{
 		// DESCRIPTION :
 		//        Implements the rreduce function with C++
 		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        structure defined by ReduceHelper
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
@@ -143,6 +190,9 @@ namespace hops{
 		//            Type of the the values in the std::array
 		//            argument
 		//
+		//        ALEN : std::size_t (Inferred)
+		//            Length of the std::array argument
+		//
 		//        TI : typename (Inferred)
 		//            Type of the the initalization value 
 		//
@@ -152,24 +202,55 @@ namespace hops{
 		//            compiler inference to deduce the class
 		//            name for FN
 		// 
-		//        IN : std::array<TA, LEN> const&
-		//            Input array whose elements will be
-		//            reduced
+		//        IN : std::array<TA, ALEN> const&
+		//            Input array whose elements BASE to
+		//            BASE + LEN - 1 will be reduced
 		// 
 		//        INIT : TI const&
 		//            Initialization value argument
 		//
+		//        BASE : std::size_t
+		//            Index of the first element to reduce
+		//
 		// RETURNS : auto
 		//            The return type is determined by the
 		//            wrapped function FN
-		template<class FN, typename TA, typename TI>
-		auto rreduce(FN const& F, std::array<TA, LEN> const& IN, TI const& INIT) const
-			-> decltype(F(head(IN), ReduceHelper<LEN-1>().rreduce(F, tail(IN), INIT))) {
+		template<class FN, typename TA, std::size_t ALEN, typename TI>
+		auto rreduce(FN const& F, std::array<TA, ALEN> const& IN, TI const& INIT,
+			std::size_t BASE) const
+			-> decltype(ReduceHelper<LEN/2>().rreduce(F, IN,
+					ReduceHelper<LEN - LEN/2>().rreduce(F, IN, INIT, BASE),
+					BASE)) {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return F(head(IN), ReduceHelper<LEN-1>().rreduce(F, tail(IN), INIT));
+			return ReduceHelper<LEN/2>().rreduce(F, IN,
+				ReduceHelper<LEN - LEN/2>().rreduce(F, IN, INIT, BASE + LEN/2),
+				BASE);
+		}
+
+		// As above, for a lazy expression IN (see lazy.hpp),
+		// whose elements are computed as they are reduced
+		template<class FN, typename TI, class E>
+		auto lreduce(FN const& F, TI const& INIT, E const& IN, std::size_t BASE) const
+			-> decltype(ReduceHelper<LEN - LEN/2>().lreduce(F,
+					ReduceHelper<LEN/2>().lreduce(F, INIT, IN, BASE),
+					IN, BASE)) {
+#pragma HLS INLINE
+			return ReduceHelper<LEN - LEN/2>().lreduce(F,
+				ReduceHelper<LEN/2>().lreduce(F, INIT, IN, BASE),
+				IN, BASE + LEN/2);
 		}
 
+		template<class FN, class E, typename TI>
+		auto rreduce(FN const& F, E const& IN, TI const& INIT, std::size_t BASE) const
+			-> decltype(ReduceHelper<LEN/2>().rreduce(F, IN,
+					ReduceHelper<LEN - LEN/2>().rreduce(F, IN, INIT, BASE),
+					BASE)) {
+#pragma HLS INLINE
+			return ReduceHelper<LEN/2>().rreduce(F, IN,
+				ReduceHelper<LEN - LEN/2>().rreduce(F, IN, INIT, BASE + LEN/2),
+				BASE);
+		}
 	};
 
 	// MODULE :
@@ -179,21 +260,25 @@ namespace hops{
 	//        Implements the base case of the loop-like recursive
 	//        structure of lreduce and rreduce functions using C++
 	//        Template Meta-Programming and specifically, template
-	//        specialization.
+	//        specialization. One element is reduced.
 	// 
 	// FUNCTIONS :
-	//        auto lreduce(FN, TI const&, std::array<TA, 0> const&)
-	//        auto rreduce(FN, std::array<TA, 0> const&, TI const&)
+	//        auto lreduce(FN const&, TI const&,
+	//                     std::array<TA, ALEN> const&, std::size_t) const
+	//        auto rreduce(FN const&, std::array<TA, ALEN> const&,
+	//                     TI const&, std::size_t) const
+	//        auto lreduce(FN const&, TI const&, E const&,
+	//                     std::size_t) const
+	//        auto rreduce(FN const&, E const&, TI const&,
+	//                     std::size_t) const
 	template <>
-	struct ReduceHelper<0>{
+	struct ReduceHelper<1>{
 		// FUNCTION :
 		//        lreduce
 		// 
 		// DESCRIPTION :
-		//        Implements the base case of the lreduce
-		//        function with C++ Template Metaprogramming
-		//        using the recursive structure defined by
-		//        XipHelper
+		//        Applies F to the initialization value and the
+		//        element at BASE
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
@@ -206,6 +291,9 @@ namespace hops{
 		//            Type of the the values in the std::array
 		//            argument
 		//
+		//        ALEN : std::size_t (Inferred)
+		//            Length of the std::array argument
+		//
 		// ARGUMENTS :
 		//        F : FN const&
 		//            Wrapped object, unused except in
@@ -215,28 +303,30 @@ namespace hops{
 		//        INIT : TI const&
 		//            Initialization value argument
 		//
-		//        IN : std::array<TA, LEN> const&
-		//            Nil input array, ignored in the base
-		//            case
+		//        IN : std::array<TA, ALEN> const&
+		//            Input array
 		// 
+		//        BASE : std::size_t
+		//            Index of the element to reduce
+		//
 		// RETURNS : auto
 		//            The return type is determined by the
 		//            wrapped function FN
-		template<class FN, typename TI, typename TA>
-		auto lreduce(FN const& F, TI const& INIT, std::array<TA, 0> const& IN) const
-			-> TI {
+		template<class FN, typename TI, typename TA, std::size_t ALEN>
+		auto lreduce(FN const& F, TI const& INIT, std::array<TA, ALEN> const& IN,
+			std::size_t BASE) const
+			-> decltype(F(INIT, IN[BASE])) {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return INIT;
+			return F(INIT, IN[BASE]);
 		}
 
 		// FUNCTION :
 		//        rreduce
 		// 
 		// DESCRIPTION :
-		//        Implements the rreduce function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Applies F to the element at BASE and the
+		//        initialization value
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
@@ -246,6 +336,9 @@ namespace hops{
 		//            Type of the the values in the std::array
 		//            argument
 		//
+		//        ALEN : std::size_t (Inferred)
+		//            Length of the std::array argument
+		//
 		//        TI : typename (Inferred)
 		//            Type of the the initalization value 
 		//
@@ -255,23 +348,240 @@ namespace hops{
 		//            compiler inference to deduce the class
 		//            name for FN
 		// 
-		//        IN : std::array<TA, 0> const&
-		//            Nil input array, ignored in the base-case.
+		//        IN : std::array<TA, ALEN> const&
+		//            Input array
 		// 
 		//        INIT : TI const&
 		//            Initialization value argument
 		//
+		//        BASE : std::size_t
+		//            Index of the element to reduce
+		//
+		// RETURNS : auto
+		//            The return type is determined by the
+		//            wrapped function FN
+		template<class FN, typename TA, std::size_t ALEN, typename TI>
+		auto rreduce(FN const& F, std::array<TA, ALEN> const& IN, TI const& INIT,
+			std::size_t BASE) const
+			-> decltype(F(IN[BASE], INIT)) {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return F(IN[BASE], INIT);
+		}
+
+		// As above, for a lazy expression IN
+		template<class FN, typename TI, class E>
+		auto lreduce(FN const& F, TI const& INIT, E const& IN, std::size_t BASE) const
+			-> decltype(F(INIT, IN[BASE])) {
+#pragma HLS INLINE
+			return F(INIT, IN[BASE]);
+		}
+
+		template<class FN, class E, typename TI>
+		auto rreduce(FN const& F, E const& IN, TI const& INIT, std::size_t BASE) const
+			-> decltype(F(IN[BASE], INIT)) {
+#pragma HLS INLINE
+			return F(IN[BASE], INIT);
+		}
+	};
+
+	// MODULE :
+	//        struct ReduceHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the nil case of the lreduce and rreduce
+	//        functions, where no elements are reduced.
+	// 
+	// FUNCTIONS :
+	//        auto lreduce(FN const&, TI const&,
+	//                     std::array<TA, ALEN> const&, std::size_t) const
+	//        auto rreduce(FN const&, std::array<TA, ALEN> const&,
+	//                     TI const&, std::size_t) const
+	//        auto lreduce(FN const&, TI const&, E const&,
+	//                     std::size_t) const
+	//        auto rreduce(FN const&, E const&, TI const&,
+	//                     std::size_t) const
+	template <>
+	struct ReduceHelper<0>{
+		// FUNCTION :
+		//        lreduce
+		// 
+		// DESCRIPTION :
+		//        Returns the initialization value
+		// 
+		// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a wrapped function
+		//
+		//        TI : typename (Inferred)
+		//            Type of the the initalization value 
+		//
+		//        TA : typename (Inferred)
+		//            Type of the the values in the std::array
+		//            argument
+		//
+		//        ALEN : std::size_t (Inferred)
+		//            Length of the std::array argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Wrapped object, unused
+		// 
+		//        INIT : TI const&
+		//            Initialization value argument
+		//
+		//        IN : std::array<TA, ALEN> const&
+		//            Input array, unused
+		// 
+		//        BASE : std::size_t
+		//            Unused
+		//
 		// RETURNS : TI
 		//            Returns the initialization value
-		template<class FN, typename TA, typename TI>
-		auto rreduce(FN const& F, std::array<TA, 0> const& IN, TI const& INIT) const
+		template<class FN, typename TI, typename TA, std::size_t ALEN>
+		auto lreduce(FN const& F, TI const& INIT, std::array<TA, ALEN> const& IN,
+			std::size_t BASE) const
 			-> TI {
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return INIT;
+		}
+
+		// FUNCTION :
+		//        rreduce
+		// 
+		// DESCRIPTION :
+		//        Returns the initialization value
+		// 
+		// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a wrapped function
+		//
+		//        TA : typename (Inferred)
+		//            Type of the the values in the std::array
+		//            argument
+		//
+		//        ALEN : std::size_t (Inferred)
+		//            Length of the std::array argument
+		//
+		//        TI : typename (Inferred)
+		//            Type of the the initalization value 
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Wrapped object, unused
+		// 
+		//        IN : std::array<TA, ALEN> const&
+		//            Input array, unused
+		// 
+		//        INIT : TI const&
+		//            Initialization value argument
+		//
+		//        BASE : std::size_t
+		//            Unused
+		//
+		// RETURNS : TI
+		//            Returns the initialization value
+		template<class FN, typename TA, std::size_t ALEN, typename TI>
+		auto rreduce(FN const& F, std::array<TA, ALEN> const& IN, TI const& INIT,
+			std::size_t BASE) const
+			-> TI {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return INIT;
+		}
+
+		// As above, for a lazy expression IN
+		template<class FN, typename TI, class E>
+		auto lreduce(FN const& F, TI const& INIT, E const& IN, std::size_t BASE) const
+			-> TI {
+#pragma HLS INLINE
+			return INIT;
+		}
+
+		template<class FN, class E, typename TI>
+		auto rreduce(FN const& F, E const& IN, TI const& INIT, std::size_t BASE) const
+			-> TI {
+#pragma HLS INLINE
+			return INIT;
+		}
+	};
+
+	// MODULE :
+	//        struct ReduceStep
+	// 
+	// DESCRIPTION :
+	//        Wraps F so that each result is converted to TR, the
+	//        accumulator type of a chain (see ReduceChain)
+	// 
+	// FUNCTIONS :
+	//        TR operator()(TL const&, TA const&) const
+	template <class FN, typename TR>
+	struct ReduceStep{
+		FN const& F;
+
+		ReduceStep(FN const& F) : F(F){
+#pragma HLS INLINE
+		}
+
+		template <typename TL, typename TA>
+		TR operator()(TL const& L, TA const& R) const{
+#pragma HLS INLINE
+			return TR(F(L, R));
+		}
+	};
+
+	// MODULE :
+	//        struct ReduceChain
+	// 
+	// DESCRIPTION :
+	//        Chooses the function and the initialization value of
+	//        an lreduce or rreduce of LEN elements of type TA. When
+	//        FN defines accumulator<TA, LEN>::type (e.g. grow_plus,
+	//        see growth.hpp), every step returns that type, and
+	//        INIT is converted to it. Otherwise F and INIT are used
+	//        as they are.
+	// 
+	// FUNCTIONS :
+	//        static auto step(FN const&)
+	//        static auto init(TI const&)
+	//
+	// NOTES :
+	//        A chain shares one register, so it is as wide as the
+	//        last result needs (clog2(LEN) bits more than TA for
+	//        grow_plus) rather than growing at every element. INIT
+	//        must fit in the accumulator type.
+	template <class FN, typename TA, std::size_t LEN, typename = void>
+	struct ReduceChain{
+		static FN const& step(FN const& F){
+#pragma HLS INLINE
+			return F;
+		}
+
+		template <typename TI>
+		static TI const& init(TI const& INIT){
 #pragma HLS INLINE
 			return INIT;
 		}
 	};
 
+	template <class FN, typename TA, std::size_t LEN>
+	struct ReduceChain<FN, TA, LEN, typename std::conditional<true, void,
+			typename FN::template accumulator<TA, LEN>::type>::type>{
+		typedef typename FN::template accumulator<TA, LEN>::type type;
+
+		static ReduceStep<FN, type> step(FN const& F){
+#pragma HLS INLINE
+			return ReduceStep<FN, type>(F);
+		}
+
+		template <typename TI>
+		static type init(TI const& INIT){
+#pragma HLS INLINE
+			return type(INIT);
+		}
+	};
+
 	// MODULE :
 	//        struct Lreduce
 	// 
@@ -289,6 +599,16 @@ namespace hops{
 	// FUNCTIONS :
 	//        auto operator()(FN const&, TI const&,
 	//                        std::array<TA, LEN> const&) const
+	//        auto operator()(FN const&, TI const&, E const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        The elements of a lazy expression (see lazy.hpp) are
+	//        computed as they are reduced, without an intermediate
+	//        array.
+	//
+	//        When F defines an accumulator type (see
+	//        ReduceChain), every step returns it.
 	struct Lreduce{
 		// FUNCTION :
 		//        operator()
@@ -336,10 +656,31 @@ namespace hops{
 		//        the method modifies no internal state
 		template <class FN, typename TA, std::size_t LEN, typename TI>
 		auto operator()(FN const& F, TI const& INIT, std::array<TA, LEN> const& IN) const
-			-> decltype(ReduceHelper<LEN>().lreduce(F, INIT, IN)){
+			-> decltype(ReduceHelper<LEN>().lreduce(ReduceChain<FN, TA, LEN>::step(F),
+					ReduceChain<FN, TA, LEN>::init(INIT), IN, 0)){
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return ReduceHelper<LEN>().lreduce(F, INIT, IN);
+			return ReduceHelper<LEN>().lreduce(ReduceChain<FN, TA, LEN>::step(F),
+				ReduceChain<FN, TA, LEN>::init(INIT), IN, 0);
+		}
+
+		template <class FN, class E, typename TI,
+			  typename TA = typename E::array_type::value_type,
+			  std::size_t LEN = std::tuple_size<typename E::array_type>::value>
+		auto operator()(FN const& F, TI const& INIT, E const& IN) const
+			-> decltype(ReduceHelper<LEN>().lreduce(ReduceChain<FN, TA, LEN>::step(F),
+					ReduceChain<FN, TA, LEN>::init(INIT), IN, 0)){
+#pragma HLS INLINE
+			return ReduceHelper<LEN>().lreduce(ReduceChain<FN, TA, LEN>::step(F),
+				ReduceChain<FN, TA, LEN>::init(INIT), IN, 0);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.lreduce(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.lreduce(ARGS...);
 		}
 	};
 	// VARIABLE :
@@ -378,6 +719,16 @@ namespace hops{
 	// 
 	// FUNCTIONS :
 	//        auto operator()(FN const&, std::array<TA, LEN> const&, TI const&)
+	//        auto operator()(FN const&, E const&, TI const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        The elements of a lazy expression (see lazy.hpp) are
+	//        computed as they are reduced, without an intermediate
+	//        array.
+	//
+	//        When F defines an accumulator type (see
+	//        ReduceChain), every step returns it.
 	struct Rreduce{
 		// FUNCTION :
 		//        operator()
@@ -425,10 +776,31 @@ namespace hops{
 		//        the method modifies no internal state
 		template <class FN, typename TA, std::size_t LEN, typename TI>
 		auto operator()(FN const& F, std::array<TA, LEN> const& IN, TI const& INIT) const
-			-> decltype(ReduceHelper<LEN>().rreduce(F, IN, INIT)){
+			-> decltype(ReduceHelper<LEN>().rreduce(ReduceChain<FN, TA, LEN>::step(F), IN,
+					ReduceChain<FN, TA, LEN>::init(INIT), 0)){
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return ReduceHelper<LEN>().rreduce(F, IN, INIT);
+			return ReduceHelper<LEN>().rreduce(ReduceChain<FN, TA, LEN>::step(F), IN,
+				ReduceChain<FN, TA, LEN>::init(INIT), 0);
+		}
+
+		template <class FN, class E, typename TI,
+			  typename TA = typename E::array_type::value_type,
+			  std::size_t LEN = std::tuple_size<typename E::array_type>::value>
+		auto operator()(FN const& F, E const& IN, TI const& INIT) const
+			-> decltype(ReduceHelper<LEN>().rreduce(ReduceChain<FN, TA, LEN>::step(F), IN,
+					ReduceChain<FN, TA, LEN>::init(INIT), 0)){
+#pragma HLS INLINE
+			return ReduceHelper<LEN>().rreduce(ReduceChain<FN, TA, LEN>::step(F), IN,
+				ReduceChain<FN, TA, LEN>::init(INIT), 0);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.rreduce(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.rreduce(ARGS...);
 		}
 	};
 
@@ -451,5 +823,523 @@ namespace hops{
 	//        because providing polymorphism without an allocator
 	//        from a loop is impossible
 	Rreduce rreduce;
+
+	// MODULE :
+	//        struct TreereduceHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the balanced binary-tree recursive
+	//        structure of the treereduce function using C++
+	//        Template Meta-Programming and Partial Template
+	//        Specialization
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input list, and the iteration
+	//            variable for C++ Template Meta-Programming
+	// 
+	// FUNCTIONS :
+	//        auto operator()(FN const&, std::array<TA, LEN> const&) const
+	//        auto run(FN const&, std::size_t,
+	//                 std::array<TA, N> const&)
+	//        auto run(FN const&, std::size_t, E const&)
+	//
+	// NOTES :
+	//        The input array is divided into halves of length
+	//        LEN/2 and LEN - LEN/2, so the depth of the tree is
+	//        clog2(LEN) for any LEN, including non-powers-of-two.
+	//
+	//        Each sub-tree reads its elements from the input
+	//        array at an offset, rather than from a copy of its
+	//        half made by split, so no level of the tree copies
+	//        the input array. This matters when the elements are
+	//        large (e.g. the Lanes of batch.hpp).
+	template <std::size_t LEN>
+	struct TreereduceHelper{
+		// FUNCTION :
+		//        run
+		// 
+		// DESCRIPTION :
+		//        Reduces elements LO to LO + LEN - 1 of IN
+		//
+		// RETURNS : auto
+		//            The return type is determined by the
+		//            wrapped function FN
+		template<class FN, typename TA, std::size_t N>
+		static auto run(FN const& F, std::size_t LO, std::array<TA, N> const& IN)
+			-> decltype(F(TreereduceHelper<LEN/2>::run(F, LO, IN),
+					TreereduceHelper<LEN - LEN/2>::run(F, LO, IN))) {
+#pragma HLS INLINE
+			return F(TreereduceHelper<LEN/2>::run(F, LO, IN),
+				TreereduceHelper<LEN - LEN/2>::run(F, LO + LEN/2, IN));
+		}
+
+		// As above, for a lazy expression IN (see lazy.hpp),
+		// whose elements are computed as they are reduced
+		template<class FN, class E>
+		static auto run(FN const& F, std::size_t LO, E const& IN)
+			-> decltype(F(TreereduceHelper<LEN/2>::run(F, LO, IN),
+					TreereduceHelper<LEN - LEN/2>::run(F, LO, IN))) {
+#pragma HLS INLINE
+			return F(TreereduceHelper<LEN/2>::run(F, LO, IN),
+				TreereduceHelper<LEN - LEN/2>::run(F, LO + LEN/2, IN));
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Implements the treereduce function with C++
+		//        Template Metaprogramming using the recursive
+		//        structure defined by TreereduceHelper
+		// 
+		// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a wrapped function
+		//
+		//        TA : typename (Inferred)
+		//            Type of the the values in the std::array
+		//            argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Wrapped object implementing an
+		//            associative two-input operator()
+		//            function
+		// 
+		//        IN : std::array<TA, LEN> const&
+		//            Input array whose elements will be
+		//            reduced
+		// 
+		// RETURNS : auto
+		//            The return type is determined by the
+		//            wrapped function FN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template<class FN, typename TA>
+		auto operator()(FN const& F, std::array<TA, LEN> const& IN) const
+			-> decltype(run(F, 0, IN)) {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return run(F, 0, IN);
+		}
+	};
+
+	// MODULE :
+	//        struct TreereduceHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the base case (LEN = 1) of the
+	//        balanced binary-tree recursive structure of the
+	//        treereduce function using C++ Template
+	//        Meta-Programming and Partial Template
+	//        Specialization
+	// 
+	// FUNCTIONS :
+	//        auto operator()(FN const&, std::array<TA, 1> const&) const
+	//        TA run(FN const&, std::size_t, std::array<TA, N> const&)
+	//        E::value_type run(FN const&, std::size_t, E const&)
+	template <>
+	struct TreereduceHelper<1>{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Implements the base case of the treereduce
+		//        function, a leaf of the reduction tree
+		// 
+		// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a wrapped function
+		//
+		//        TA : typename (Inferred)
+		//            Type of the the values in the std::array
+		//            argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Wrapped object, unused except in
+		//            compiler inference to deduce the class
+		//            name for FN
+		// 
+		//        IN : std::array<TA, 1> const&
+		//            Single-element input array
+		// 
+		// RETURNS : TA
+		//            Returns the only element of the input
+		//            array
+		template<class FN, typename TA>
+		auto operator()(FN const& F, std::array<TA, 1> const& IN) const
+			-> TA {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return IN[0];
+		}
+
+		// FUNCTION :
+		//        run
+		// 
+		// DESCRIPTION :
+		//        Returns element LO of IN, a leaf of the
+		//        reduction tree
+		template<class FN, typename TA, std::size_t N>
+		static TA run(FN const& F, std::size_t LO, std::array<TA, N> const& IN){
+#pragma HLS INLINE
+			return IN[LO];
+		}
+
+		template<class FN, class E>
+		static typename E::value_type run(FN const& F, std::size_t LO, E const& IN){
+#pragma HLS INLINE
+			return IN[LO];
+		}
+	};
+
+	// MODULE :
+	//        struct Treereduce
+	// 
+	// DESCRIPTION :
+	//        Wraps the treereduce implementation provided by
+	//        TreereduceHelper to provide a function-like API
+	//        using the operator() function.
+	//        
+	//        The treereduce operation takes an associative
+	//        two-input function and a non-empty input array. It
+	//        applies the function to adjacent elements, and then
+	//        to adjacent results, in a balanced binary tree with
+	//        a depth of clog2(LEN) function applications.
+	// 
+	// FUNCTIONS :
+	//        auto operator()(FN const&, std::array<TA, LEN> const&) const
+	//        auto operator()(FN const&, E const&) const
+	//        auto operator()(P const&, AS const&...) const
+	//
+	// NOTES :
+	//        The elements of a lazy expression (see lazy.hpp) are
+	//        computed as they are reduced, without an intermediate
+	//        array.
+	struct Treereduce{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Provides a function-like interface to the
+		//        tree recursive structure defined by
+		//        TreereduceHelper
+		//
+		// PARAMETERS :
+        	//        FN : class (Inferred)
+        	//            Typename of a wrapped function
+		//
+		//        TA : typename (Inferred)
+		//            Type of the the values in the std::array
+		//            argument
+		//
+		//        LEN : std::size_t (Inferred)
+		//            The length of the input list, and the iteration
+		//            variable for C++ Template Meta-Programming
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Wrapped object implementing an
+		//            associative two-input operator()
+		//            function
+		// 
+		//        IN : std::array<TA, LEN> const&
+		//            Input array whose elements will be
+		//            reduced
+		// 
+		// RETURNS : auto
+		//            The return type is determined by the
+		//            wrapped function FN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename TA, std::size_t LEN>
+		auto operator()(FN const& F, std::array<TA, LEN> const& IN) const
+			-> decltype(TreereduceHelper<LEN>()(F, IN)){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return TreereduceHelper<LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> decltype(TreereduceHelper<std::tuple_size<typename E::array_type>::value>
+				    ::run(F, 0, IN)){
+#pragma HLS INLINE
+			return TreereduceHelper<std::tuple_size<typename E::array_type>::value>
+				::run(F, 0, IN);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.treereduce(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.treereduce(ARGS...);
+		}
+	};
+
+	// VARIABLE :
+	//        treereduce (instance of Treereduce)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Treereduce struct that provides a
+	//        function-like API for the treereduce function using
+	//        the operator() function of Treereduce.
+	//
+	// EXAMPLE :
+	//        std::array<float, 5> a = {1.0, 2.0, 3.0, 4.0, 5.0};
+	//        float b;
+	//        b = treereduce(std::plus<float>(), a);
+	//        // b === ((1.0 + 2.0) + (3.0 + (4.0 + 5.0))) === 15.0
+	//        
+	// NOTES :
+	//        The result is only equal to lreduce and rreduce when
+	//        the wrapped function is associative. There is no
+	//        initialization value, so the input array must have
+	//        at least one element.
+	Treereduce treereduce;
+
+	namespace dyn{
+		// MODULE :
+		//        struct Lreduce
+		// 
+		// DESCRIPTION :
+		//        Implements the lreduce function on runtime-length
+		//        arrays (see span.hpp) using a loop in the
+		//        operator() function to provide a function-like
+		//        API.
+		// 
+		// FUNCTIONS :
+		//        auto operator()(FN const&, TI const&, CA const&) const
+		//
+		// NOTES :
+		//        F is the same function object that is passed to
+		//        hops::lreduce, and must return the type of its
+		//        first argument (after the first application), so
+		//        that the result has the same type at every
+		//        length.
+		struct Lreduce{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Computes F(...F(F(INIT, IN[0]), IN[1])...,
+			//        IN[N-1])
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a wrapped function
+			//
+			//        TI : typename (Inferred)
+			//            Type of the the initalization value 
+			//
+			//        CA : class (Inferred)
+			//            Type of the input: a std::vector,
+			//            std::array or Span
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Wrapped object implementing a two-input
+			//            operator() function
+			//
+			//        INIT : TI const&
+			//            Initialization value argument
+			//
+			//        IN : CA const&
+			//            Input array whose elements will be
+			//            reduced
+			// 
+			// RETURNS : auto
+			//            The return type of F. INIT when IN is
+			//            empty.
+			template<class FN, typename TI, class CA>
+			auto operator()(FN const& F, TI const& INIT, CA const& IN) const
+				-> typename std::decay<decltype(F(INIT, IN.data()[0]))>::type{
+				typename std::decay<decltype(F(INIT, IN.data()[0]))>::type acc(INIT);
+				for(std::size_t i = 0; i < IN.size(); ++i){
+					acc = F(acc, IN.data()[i]);
+				}
+				return acc;
+			}
+		};
+
+		// VARIABLE :
+		//        lreduce (instance of Lreduce)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length Lreduce struct
+		//        that provides a function-like API with the
+		//        operator() function.
+		//
+		// EXAMPLE :
+		//        std::vector<float> a = {1.0, 2.0, 3.0, 4.0};
+		//        float b;
+		//        b = dyn::lreduce(std::divides<float>(), 1.0, a);
+		//        // b === ((((1.0/1.0)/2.0)/3.0)/4.0) === .042
+		Lreduce lreduce;
+
+		// MODULE :
+		//        struct Rreduce
+		// 
+		// DESCRIPTION :
+		//        Implements the rreduce function on runtime-length
+		//        arrays (see span.hpp) using a loop in the
+		//        operator() function to provide a function-like
+		//        API.
+		// 
+		// FUNCTIONS :
+		//        auto operator()(FN const&, CA const&, TI const&) const
+		//
+		// NOTES :
+		//        F is the same function object that is passed to
+		//        hops::rreduce, and must return the type of its
+		//        second argument (after the first application).
+		struct Rreduce{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Computes F(IN[0], F(IN[1], ...F(IN[N-1],
+			//        INIT)...))
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a wrapped function
+			//
+			//        CA : class (Inferred)
+			//            Type of the input: a std::vector,
+			//            std::array or Span
+			//
+			//        TI : typename (Inferred)
+			//            Type of the the initalization value 
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Wrapped object implementing a two-input
+			//            operator() function
+			//
+			//        IN : CA const&
+			//            Input array whose elements will be
+			//            reduced
+			// 
+			//        INIT : TI const&
+			//            Initialization value argument
+			//
+			// RETURNS : auto
+			//            The return type of F. INIT when IN is
+			//            empty.
+			template<class FN, class CA, typename TI>
+			auto operator()(FN const& F, CA const& IN, TI const& INIT) const
+				-> typename std::decay<decltype(F(IN.data()[0], INIT))>::type{
+				typename std::decay<decltype(F(IN.data()[0], INIT))>::type acc(INIT);
+				for(std::size_t i = IN.size(); i > 0; --i){
+					acc = F(IN.data()[i - 1], acc);
+				}
+				return acc;
+			}
+		};
+
+		// VARIABLE :
+		//        rreduce (instance of Rreduce)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length Rreduce struct
+		//        that provides a function-like API with the
+		//        operator() function.
+		//
+		// EXAMPLE :
+		//        std::vector<float> a = {1.0, 2.0, 3.0, 4.0};
+		//        float b;
+		//        b = dyn::rreduce(std::divides<float>(), a, 1.0);
+		//        // b === (1.0/(2.0/(3.0/(4.0/1.0)))) === .375
+		Rreduce rreduce;
+
+		// MODULE :
+		//        struct Treereduce
+		// 
+		// DESCRIPTION :
+		//        Implements the treereduce function on
+		//        runtime-length arrays (see span.hpp) with the
+		//        same tree as hops::treereduce: a range of LEN
+		//        elements is divided into halves of length LEN/2
+		//        and LEN - LEN/2.
+		// 
+		// FUNCTIONS :
+		//        auto operator()(FN const&, CA const&) const
+		//
+		// NOTES :
+		//        The tree is computed recursively, with depth
+		//        clog2(N) and N - 1 applications of F. F must
+		//        return the type of the input elements.
+		struct Treereduce{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Reduces the elements of IN with a balanced
+			//        binary tree
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a wrapped function
+			//
+			//        CA : class (Inferred)
+			//            Type of the input: a std::vector,
+			//            std::array or Span
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Wrapped object implementing an
+			//            associative two-input operator()
+			//            function
+			// 
+			//        IN : CA const&
+			//            Input array whose elements will be
+			//            reduced. IN must not be empty.
+			// 
+			// RETURNS : auto
+			//            The type of the elements of IN
+			template<class FN, class CA>
+			auto operator()(FN const& F, CA const& IN) const
+				-> typename std::decay<decltype(IN.data()[0])>::type{
+				assert(IN.size() > 0);
+				return run(F, IN.data(), IN.size());
+			}
+
+		private:
+			template<class FN, typename TA>
+			static TA run(FN const& F, TA const* IN, std::size_t LEN){
+				if(LEN == 1){
+					return IN[0];
+				}
+				return F(run(F, IN, LEN/2), run(F, IN + LEN/2, LEN - LEN/2));
+			}
+		};
+
+		// VARIABLE :
+		//        treereduce (instance of Treereduce)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length Treereduce
+		//        struct that provides a function-like API with the
+		//        operator() function.
+		//
+		// EXAMPLE :
+		//        std::vector<float> a = {1.0, 2.0, 3.0, 4.0, 5.0};
+		//        float b;
+		//        b = dyn::treereduce(std::plus<float>(), a);
+		//        // b === ((1.0 + 2.0) + (3.0 + (4.0 + 5.0))) === 15.0
+		Treereduce treereduce;
+	} // namespace dyn
 } // namespace hops
 #endif // __REDUCE_HPP
@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        rom.hpp
+//
+// DESCRIPTION :
+//        This file implements lookup tables that are built at compile
+//        time. A generator is a function object with a constexpr
+//        operator() that maps an index to a value. Rom<GEN, N> holds
+//        the values of GEN for the indicies 0 ... N-1 in a static
+//        constexpr array, so the table costs no run time on the host
+//        and is synthesized as a ROM by Vivado HLS:
+//
+//            struct Square{
+//                    constexpr int operator()(std::size_t IDX) const{
+//                            return IDX * IDX;
+//                    }
+//            };
+//
+//            int y = hops::rom<Square, 16>(x); // x*x for x < 16
+//
+//        The constexpr functions sine and cosine compute sines and
+//        cosines for generators (std::sin and std::cos are not
+//        constexpr).
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Rom
+//
+// PUBLIC FUNCTIONS :
+//        rom
+//        sine
+//        cosine
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        Rom<GEN, N> calls GEN once per element while compiling. The
+//        elements are expanded from an index_sequence (arrayops.hpp)
+//        with a logarithmic instantiation depth, so tables of
+//        thousands of elements compile in a few seconds.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __ROM_HPP
+#define __ROM_HPP
+#include <array>
+#include <cstddef>
+#include "arrayops.hpp"
+namespace hops{
+	// MODULE :
+	//        struct Rom
+	// 
+	// DESCRIPTION :
+	//        A table of the values of a generator for the indicies 0
+	//        ... N-1, computed at compile time. Rom<GEN, N>::table is
+	//        a static constexpr std::array<value_type, N>
+	// 
+	// PARAMETERS :
+	//        GEN : class
+	//            Typename of a default-constructible function object
+	//            with a constexpr operator()(std::size_t)
+	//
+	//        N : std::size_t
+	//            The number of elements in the table
+	//
+	// EXAMPLE :
+	//        Rom<Square, 16>::table[3] // 9
+	template <class GEN, std::size_t N, class SEQ = make_index_sequence<N> >
+	struct Rom;
+
+	template <class GEN, std::size_t N, std::size_t... IDX>
+	struct Rom<GEN, N, index_sequence<IDX...> >{
+		typedef decltype(GEN()(std::size_t(0))) value_type;
+		static constexpr std::array<value_type, N> table = {{GEN()(IDX)...}};
+	};
+
+	template <class GEN, std::size_t N, std::size_t... IDX>
+	constexpr std::array<typename Rom<GEN, N, index_sequence<IDX...> >::value_type, N>
+	Rom<GEN, N, index_sequence<IDX...> >::table;
+
+	// FUNCTION :
+	//        rom
+	// 
+	// DESCRIPTION :
+	//        Reads element IDX of Rom<GEN, N>::table
+	// 
+	// PARAMETERS :
+	//        GEN : class
+	//            Typename of the generator of the table
+	//
+	//        N : std::size_t
+	//            The number of elements in the table
+	//
+	// ARGUMENTS :
+	//        IDX : std::size_t
+	//            The index of the element (IDX < N)
+	//
+	// RETURNS :
+	//        Rom<GEN, N>::value_type
+	//            The value of GEN for IDX
+	template <class GEN, std::size_t N>
+	typename Rom<GEN, N>::value_type rom(std::size_t IDX){
+#pragma HLS INLINE
+		return Rom<GEN, N>::table[IDX];
+	}
+
+	// Sums the Taylor series that starts with the term T of degree
+	// K, where each term is the previous term times -X2/((K+1)(K+2)).
+	// The smallest terms are added first.
+	constexpr double taylor(double X2, double T, std::size_t K){
+		return K > 32 ? 0 : T + taylor(X2, -T * X2 / ((K + 1) * (K + 2)), K + 2);
+	}
+
+	// Reduces X to [-pi, pi], where the series converge quickly
+	constexpr double wrap_pi(double X){
+		return X > 3.14159265358979323846 ? wrap_pi(X - 2 * 3.14159265358979323846) :
+			X < -3.14159265358979323846 ? wrap_pi(X + 2 * 3.14159265358979323846) : X;
+	}
+
+	// FUNCTION :
+	//        sine
+	// 
+	// DESCRIPTION :
+	//        A constexpr sine, for generators
+	//
+	// ARGUMENTS :
+	//        X : double
+	//            An angle, in radians
+	//
+	// RETURNS :
+	//        double
+	//            sin(X)
+	constexpr double sine(double X){
+		return taylor(wrap_pi(X) * wrap_pi(X), wrap_pi(X), 1);
+	}
+
+	// FUNCTION :
+	//        cosine
+	// 
+	// DESCRIPTION :
+	//        A constexpr cosine, for generators
+	//
+	// ARGUMENTS :
+	//        X : double
+	//            An angle, in radians
+	//
+	// RETURNS :
+	//        double
+	//            cos(X)
+	constexpr double cosine(double X){
+		return taylor(wrap_pi(X) * wrap_pi(X), 1, 0);
+	}
+} // namespace hops
+#endif // __ROM_HPP
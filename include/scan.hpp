@@ -0,0 +1,1053 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        scan.hpp
+//
+// DESCRIPTION :
+//        This file implements the lscan and rscan (parallel prefix)
+//        Higher-Order Functions. The scan topology is selected with
+//        a policy class: Sklansky, KoggeStone, or BrentKung.
+//       
+// NAMESPACES :
+//        hops
+//        hops::dyn
+//
+// PUBLIC MODULES :
+//        Sklansky
+//        KoggeStone
+//        BrentKung
+//        Lscan
+//        Rscan
+//        Scan
+// 
+// PRIVATE MODULES :
+//        SklanskyOp
+//        KoggeStoneHelper
+//        BrentKungHelper
+//
+// PUBLIC VARIABLES :
+//        lscan (an instance of Lscan<Sklansky>)
+//        rscan (an instance of Rscan<Sklansky>)
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        Every topology computes the same inclusive scan for an
+//        associative function F. They differ in the number of
+//        applications of F (area) and the depth of the network
+//        (latency), for N = LEN:
+//
+//        Topology     Depth            Applications of F
+//        Sklansky     clog2(N)         (N/2)clog2(N)
+//        KoggeStone   clog2(N)         N clog2(N) - N + 1
+//        BrentKung    2 clog2(N) - 1   2N - 2 - clog2(N)
+//
+//        (Counts are exact for power-of-two N)
+//
+//        The hops::dyn namespace defines serial lscan and rscan on
+//        runtime-length arrays (see span.hpp).
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __SCAN_HPP
+#define __SCAN_HPP
+#include <array>
+#include "arrayops.hpp"
+#include "divconq.hpp"
+#include "functools.hpp"
+#include "map.hpp"
+#include "span.hpp"
+#include "zip.hpp"
+namespace hops{
+	// MODULE :
+	//        struct SklanskyOp
+	// 
+	// DESCRIPTION :
+	//        Combines two scanned sub-arrays in the Sklansky
+	//        topology: the last element of the left sub-array is
+	//        applied to every element of the right sub-array.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of the associative class-wrapped
+	//            function.
+	// 
+	// FUNCTIONS :
+	//        auto operator()(std::array<T, LL>, std::array<T, LR>) const
+	template <class FN>
+	struct SklanskyOp{
+		FN const& F;
+		SklanskyOp(FN const& F) : F(F) {}
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Combines two scanned sub-arrays into a single
+		//        scanned array.
+		// 
+		// PARAMETERS :
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input arrays.
+		//
+		//        LL : std::size_t (Inferred)
+		//            Length of the left input array
+		//
+		//        LR : std::size_t (Inferred)
+		//            Length of the right input array
+		//
+		// ARGUMENTS :
+		//        L : std::array<T, LL> const&
+		//            The scan of the left sub-array
+		//
+		//        R : std::array<T, LR> const&
+		//            The scan of the right sub-array
+		// 
+		// RETURNS : std::array<T, LL + LR>
+		//        The scan of the concatenated sub-arrays
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <typename T, std::size_t LL, std::size_t LR>
+		std::array<T, LL + LR> operator()(std::array<T, LL> const& L,
+						std::array<T, LR> const& R) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
+#pragma HLS INLINE
+			return concatenate(L, map(partial(F, L[LL - 1]), R));
+		}
+	};
+
+	// MODULE :
+	//        struct Sklansky
+	// 
+	// DESCRIPTION :
+	//        Scan topology policy implementing the Sklansky
+	//        (divide-and-conquer) parallel prefix network using
+	//        divconq. Minimum depth, but the final application of
+	//        F in each sub-tree has a fan-out of half of the
+	//        sub-tree.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	struct Sklansky{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes the inclusive left scan of the input
+		//        array using the Sklansky topology
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array to scan.
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive left scan of IN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return divconq(SklanskyOp<FN>(F), IN);
+		}
+
+		// As above, for a lazy expression IN, which divconq
+		// splits without copies. Each element is computed once,
+		// at a leaf.
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return divconq(SklanskyOp<FN>(F), IN);
+		}
+	};
+
+	// MODULE :
+	//        struct KoggeStoneHelper
+	// 
+	// DESCRIPTION :
+	//        Implements one level of the Kogge-Stone parallel
+	//        prefix network, and recurses on the next level
+	//        using C++ Template Meta-Programming and Partial
+	//        Template Specialization.
+	// 
+	// PARAMETERS :
+	//        STRIDE : std::size_t
+	//            The distance between the two inputs of F at this
+	//            level of the network. Doubles at every level.
+	//
+	//        LEN : std::size_t
+	//            The length of the input list.
+	//
+	//        RECURSE : bool
+	//            True while STRIDE < LEN (Default)
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        At each level, element i >= STRIDE is replaced by
+	//        F(IN[i - STRIDE], IN[i]), which is written as a zipWith
+	//        between the array and itself shifted by STRIDE.
+	template <std::size_t STRIDE, std::size_t LEN, bool RECURSE = (STRIDE < LEN)>
+	struct KoggeStoneHelper{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies the current level of the Kogge-Stone
+		//        network and recurses on the next level
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The partial scan from the previous level
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive left scan of IN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			auto hi = split<STRIDE>(IN);
+			auto lo = split<LEN - STRIDE>(IN);
+			return KoggeStoneHelper<2 * STRIDE, LEN>()
+				(F, concatenate(hi.first,
+						zipWith(F, lo.first, hi.second)));
+		}
+
+		// As above, for a lazy expression IN: the first level
+		// reads its elements in place
+		template <class FN, class E>
+		std::array<typename E::value_type, LEN> operator()(FN const& F,
+								E const& IN) const{
+#pragma HLS INLINE
+			return KoggeStoneHelper<2 * STRIDE, LEN>()
+				(F, level(F, IN, make_index_sequence<LEN>()));
+		}
+
+	private:
+		template <class FN, class E, std::size_t... IDX>
+		static std::array<typename E::value_type, LEN> level(FN const& F,
+								E const& IN,
+								index_sequence<IDX...>){
+#pragma HLS INLINE
+			return {{((IDX < STRIDE) ? IN[IDX] : F(IN[IDX - STRIDE], IN[IDX]))...}};
+		}
+	};
+
+	// MODULE :
+	//        struct KoggeStoneHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the base case (STRIDE >= LEN) of the
+	//        Kogge-Stone parallel prefix network.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	template <std::size_t STRIDE, std::size_t LEN>
+	struct KoggeStoneHelper<STRIDE, LEN, false>{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Returns the completed scan from the last level
+		//        of the network
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function. Unused in the
+		//            base case.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The completed scan
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The input array, unmodified.
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return IN;
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return IN;
+		}
+	};
+
+	// MODULE :
+	//        struct KoggeStone
+	// 
+	// DESCRIPTION :
+	//        Scan topology policy implementing the Kogge-Stone
+	//        parallel prefix network. Minimum depth and a fan-out
+	//        of two, at the cost of the most applications of F.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	struct KoggeStone{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes the inclusive left scan of the input
+		//        array using the Kogge-Stone topology
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array to scan.
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive left scan of IN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return KoggeStoneHelper<1, LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return KoggeStoneHelper<1, E::size()>()(F, IN);
+		}
+	};
+
+	// MODULE :
+	//        struct BrentKungHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the Brent-Kung parallel prefix network
+	//        using C++ Template Meta-Programming and Partial
+	//        Template Specialization.
+	// 
+	// PARAMETERS :
+	//        LEN : std::size_t
+	//            The length of the input list, and the iteration
+	//            variable for C++ Template Meta-Programming.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        Adjacent pairs are combined (up-sweep), the LEN/2
+	//        pair results are scanned recursively, and the
+	//        even-indexed outputs are completed from the
+	//        recursive scan (down-sweep).
+	template <std::size_t LEN>
+	struct BrentKungHelper{
+		// FUNCTION :
+		//        pairs
+		// 
+		// DESCRIPTION :
+		//        The up-sweep: applies F to each adjacent pair of
+		//        elements in the input array.
+		//
+		// RETURNS : std::array<T, LEN/2>
+		//        An array where element i is F(IN[2i], IN[2i+1])
+		template <class FN, class A, std::size_t... IDX>
+		static std::array<typename A::value_type, LEN/2> pairs(FN const& F,
+						A const& IN,
+						index_sequence<IDX...>){
+#pragma HLS INLINE
+			return {{F(IN[2 * IDX], IN[2 * IDX + 1])...}};
+		}
+
+		// FUNCTION :
+		//        at
+		// 
+		// DESCRIPTION :
+		//        The down-sweep for a single output index: odd
+		//        indices are read from the recursive scan S, and
+		//        even indices (except 0) combine the preceding
+		//        element of S with the input.
+		//
+		// RETURNS : T
+		//        Element IDX of the inclusive scan of IN
+		template <class FN, class A, typename T>
+		static T at(FN const& F, A const& IN,
+			std::array<T, LEN/2> const& S, std::size_t IDX){
+#pragma HLS INLINE
+			return (IDX == 0) ? IN[0] :
+				(IDX % 2) ? S[IDX / 2] : F(S[IDX / 2 - 1], IN[IDX]);
+		}
+
+		// FUNCTION :
+		//        expand
+		// 
+		// DESCRIPTION :
+		//        Applies the down-sweep to every output index.
+		//
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive scan of IN
+		template <class FN, class A, typename T, std::size_t... IDX>
+		static std::array<T, LEN> expand(FN const& F,
+						A const& IN,
+						std::array<T, LEN/2> const& S,
+						index_sequence<IDX...>){
+#pragma HLS INLINE
+			return {{at(F, IN, S, IDX)...}};
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes the inclusive left scan of the input
+		//        array using the Brent-Kung topology
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array to scan.
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive left scan of IN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			std::array<T, LEN/2> S = BrentKungHelper<LEN/2>()
+				(F, pairs(F, IN, make_index_sequence<LEN/2>()));
+#pragma HLS ARRAY_PARTITION complete VARIABLE=S._M_instance
+			return expand(F, IN, S, make_index_sequence<LEN>());
+		}
+
+		// As above, for a lazy expression IN, whose elements
+		// are read in place by the up-sweep and the down-sweep
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			std::array<typename E::value_type, LEN/2> S = BrentKungHelper<LEN/2>()
+				(F, pairs(F, IN, make_index_sequence<LEN/2>()));
+#pragma HLS ARRAY_PARTITION complete VARIABLE=S._M_instance
+			return expand(F, IN, S, make_index_sequence<LEN>());
+		}
+	};
+
+	// MODULE :
+	//        struct BrentKungHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the base case (LEN = 1) of the Brent-Kung
+	//        parallel prefix network.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, 1> operator()(FN const&, std::array<T, 1>) const
+	//        std::array<T, 1> operator()(FN const&, E const&) const
+	template <>
+	struct BrentKungHelper<1>{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Returns the one-element input array, which is
+		//        its own scan
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function. Unused in the
+		//            base case.
+		//
+		//        IN : std::array<T, 1> const&
+		//            The one-element input array
+		// 
+		// RETURNS : std::array<T, 1>
+		//        The input array, unmodified.
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T>
+		std::array<T, 1> operator()(FN const& F,
+					std::array<T, 1> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return IN;
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return IN;
+		}
+	};
+
+	// MODULE :
+	//        struct BrentKung
+	// 
+	// DESCRIPTION :
+	//        Scan topology policy implementing the Brent-Kung
+	//        parallel prefix network. Fewest applications of F
+	//        and a fan-out of two, at the cost of nearly twice
+	//        the depth of Sklansky or Kogge-Stone.
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	struct BrentKung{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes the inclusive left scan of the input
+		//        array using the Brent-Kung topology
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array to scan.
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive left scan of IN
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return BrentKungHelper<LEN>()(F, IN);
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return BrentKungHelper<E::size()>()(F, IN);
+		}
+	};
+
+	// MODULE :
+	//        struct Lscan
+	// 
+	// DESCRIPTION :
+	//        Wraps the parallel prefix network selected by
+	//        TOPOLOGY with the () operator to provide a
+	//        function-like API for the inclusive left scan.
+	// 
+	// PARAMETERS :
+	//        TOPOLOGY : class
+	//            Scan topology policy: Sklansky (Default),
+	//            KoggeStone, or BrentKung
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        The operator() function operates on arrays of any
+	//        non-zero length. The elements of a view or lazy
+	//        expression (see view.hpp and lazy.hpp) are read in
+	//        place by the first level of the topology, without an
+	//        intermediate array. Sklansky computes each element
+	//        once; KoggeStone and BrentKung read some elements
+	//        twice, and compute them again when the expression
+	//        is not a view.
+	template <class TOPOLOGY = Sklansky>
+	struct Lscan{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes the inclusive left scan of the input
+		//        array, where element i of the result is
+		//        F(...F(F(IN[0], IN[1]), IN[2])..., IN[i])
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array to scan.
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive left scan of IN
+		//
+		// NOTES :
+		//        F must be associative and must return T. The
+		//        order of arguments to F is preserved, so F
+		//        does not need to be commutative.
+		//
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return TOPOLOGY()(F, IN);
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return TOPOLOGY()(F, IN);
+		}
+	};
+
+	// MODULE :
+	//        struct Rscan
+	// 
+	// DESCRIPTION :
+	//        Wraps the parallel prefix network selected by
+	//        TOPOLOGY with the () operator to provide a
+	//        function-like API for the inclusive right scan.
+	// 
+	// PARAMETERS :
+	//        TOPOLOGY : class
+	//            Scan topology policy: Sklansky (Default),
+	//            KoggeStone, or BrentKung
+	// 
+	// FUNCTIONS :
+	//        std::array<T, LEN> operator()(FN const&, std::array<T, LEN>) const
+	//        std::array<T, LEN> operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        The operator() function operates on arrays of any
+	//        non-zero length. The elements of a view or lazy
+	//        expression (see view.hpp and lazy.hpp) are read in
+	//        place by the first level of the topology, without an
+	//        intermediate array. Sklansky computes each element
+	//        once; KoggeStone and BrentKung read some elements
+	//        twice, and compute them again when the expression
+	//        is not a view.
+	template <class TOPOLOGY = Sklansky>
+	struct Rscan{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Computes the inclusive right scan of the input
+		//        array, where element i of the result is
+		//        F(IN[i], F(IN[i+1], ...F(IN[LEN-2], IN[LEN-1])...))
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the associative class-wrapped
+		//            function.
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array.
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the associative
+		//            class-wrapped function to scan with.
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array to scan.
+		// 
+		// RETURNS : std::array<T, LEN>
+		//        The inclusive right scan of IN
+		//
+		// NOTES :
+		//        Implemented as a left scan of the reversed array
+		//        with the arguments of F flipped. Reversal is
+		//        free in hardware.
+		//
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		std::array<T, LEN> operator()(FN const& F,
+					std::array<T, LEN> const& IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return reverse(TOPOLOGY()(flip(F), reverse(IN)));
+		}
+
+		template <class FN, class E>
+		typename E::array_type operator()(FN const& F, E const& IN) const{
+#pragma HLS INLINE
+			return reverse(TOPOLOGY()(flip(F), IN.reverse()));
+		}
+	};
+
+	// MODULE :
+	//        Scan
+	// 
+	// DESCRIPTION :
+	//        Alias for Lscan, so that a topology can be selected
+	//        as Scan<KoggeStone>, Scan<BrentKung>, etc.
+	template <class TOPOLOGY = Sklansky>
+	using Scan = Lscan<TOPOLOGY>;
+
+	// VARIABLE :
+	//        lscan (Instance of Lscan<Sklansky>)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Lscan struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//        std::array<int, 4> a = {1, 2, 3, 4}, b;
+	//        b = lscan(std::plus<int>(), a); // b = {1, 3, 6, 10}
+	//        b = Lscan<BrentKung>()(std::plus<int>(), a); // Same
+	Lscan<> lscan;
+
+	// VARIABLE :
+	//        rscan (Instance of Rscan<Sklansky>)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Rscan struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//        std::array<int, 4> a = {1, 2, 3, 4}, b;
+	//        b = rscan(std::plus<int>(), a); // b = {10, 9, 7, 4}
+	Rscan<> rscan;
+
+	namespace dyn{
+		// MODULE :
+		//        struct Lscan
+		// 
+		// DESCRIPTION :
+		//        Implements the inclusive left scan on
+		//        runtime-length arrays (see span.hpp) using a
+		//        loop in the operator() function to provide a
+		//        function-like API.
+		// 
+		// FUNCTIONS :
+		//        Span<TO> operator()(FN const&, CO&&, CA const&) const
+		//
+		// NOTES :
+		//        F is the same associative function object that
+		//        is passed to hops::lscan. The scan is computed
+		//        serially, with N - 1 applications of F: on a
+		//        processor, the parallel topologies do more work
+		//        for no reduction in latency.
+		struct Lscan{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Writes the inclusive left scan of IN to OUT,
+			//        where element i of OUT is
+			//        F(...F(F(IN[0], IN[1]), IN[2])..., IN[i])
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of the associative
+			//            class-wrapped function.
+			// 
+			//        CO, CA : class (Inferred)
+			//            Types of the output and input: a
+			//            std::vector, std::array or Span
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Instantiation of the associative
+			//            class-wrapped function to scan with.
+			//
+			//        OUT : CO&&
+			//            Output array, with the length of IN. OUT
+			//            may be IN.
+			//
+			//        IN : CA const&
+			//            The input array to scan.
+			// 
+			// RETURNS : Span<TO>
+			//        A Span of OUT
+			template <class FN, class CO, class CA>
+			auto operator()(FN const& F, CO&& OUT, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				assert(out.size() == IN.size());
+				if(out.size() > 0){
+					out[0] = IN.data()[0];
+				}
+				for(std::size_t i = 1; i < out.size(); ++i){
+					out[i] = F(out[i - 1], IN.data()[i]);
+				}
+				return out;
+			}
+		};
+
+		// MODULE :
+		//        struct Rscan
+		// 
+		// DESCRIPTION :
+		//        Implements the inclusive right scan on
+		//        runtime-length arrays (see span.hpp) using a
+		//        loop in the operator() function to provide a
+		//        function-like API.
+		// 
+		// FUNCTIONS :
+		//        Span<TO> operator()(FN const&, CO&&, CA const&) const
+		//
+		// NOTES :
+		//        F is the same associative function object that
+		//        is passed to hops::rscan. The scan is computed
+		//        serially, with N - 1 applications of F.
+		struct Rscan{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Writes the inclusive right scan of IN to
+			//        OUT, where element i of OUT is
+			//        F(IN[i], F(IN[i+1], ...F(IN[N-2], IN[N-1])...))
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of the associative
+			//            class-wrapped function.
+			// 
+			//        CO, CA : class (Inferred)
+			//            Types of the output and input: a
+			//            std::vector, std::array or Span
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Instantiation of the associative
+			//            class-wrapped function to scan with.
+			//
+			//        OUT : CO&&
+			//            Output array, with the length of IN. OUT
+			//            may be IN.
+			//
+			//        IN : CA const&
+			//            The input array to scan.
+			// 
+			// RETURNS : Span<TO>
+			//        A Span of OUT
+			template <class FN, class CO, class CA>
+			auto operator()(FN const& F, CO&& OUT, CA const& IN) const
+				-> decltype(span(OUT)){
+				auto out = span(OUT);
+				std::size_t const n = out.size();
+				assert(n == IN.size());
+				if(n > 0){
+					out[n - 1] = IN.data()[n - 1];
+				}
+				for(std::size_t i = n; i > 1; --i){
+					out[i - 2] = F(IN.data()[i - 2], out[i - 1]);
+				}
+				return out;
+			}
+		};
+
+		// VARIABLE :
+		//        lscan (Instance of Lscan)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length Lscan struct
+		//        that provides a function-like API with the
+		//        operator() function.
+		// 
+		// EXAMPLE:
+		//        std::vector<int> a = {1, 2, 3, 4}, b(4);
+		//        dyn::lscan(std::plus<int>(), b, a); // b = {1, 3, 6, 10}
+		Lscan lscan;
+
+		// VARIABLE :
+		//        rscan (Instance of Rscan)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length Rscan struct
+		//        that provides a function-like API with the
+		//        operator() function.
+		// 
+		// EXAMPLE:
+		//        std::vector<int> a = {1, 2, 3, 4}, b(4);
+		//        dyn::rscan(std::plus<int>(), b, a); // b = {10, 9, 7, 4}
+		Rscan rscan;
+	} // namespace dyn
+} // namespace hops
+#endif // __SCAN_HPP
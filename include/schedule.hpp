@@ -0,0 +1,512 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        schedule.hpp
+//
+// DESCRIPTION :
+//        This file implements a scheduler for the operator graphs
+//        recorded by trace.hpp. It estimates the latency,
+//        initiation interval and pipeline registers of a kernel at
+//        a target clock period, from a table of the delay and
+//        latency of each operator:
+//
+//            trace::Graph g;
+//            g.output(bitonic_sort(g.input(in, "x")), "y");
+//            trace::Timing t;
+//            t.set("<=", 1.5).set("select", 0.6);
+//            trace::Scheduler s(t, 4.0); // a 4 ns clock (250 MHz)
+//            trace::Schedule asap = s.asap(g);
+//            // asap.latency, asap.ii, asap.registers
+//
+//        Operators with latency 0 are combinational, and are
+//        chained within a clock cycle while their delays fit in
+//        the clock period. Operators with a latency are pipelined:
+//        their first stage must fit in the cycle they start in,
+//        and their result is registered LATENCY cycles later.
+//
+//        asap starts every operator as soon as its arguments are
+//        ready, and alap as late as a latency bound allows. The
+//        difference is the mobility of each operator. list
+//        schedules with a limit on the number of units of each
+//        operator, in the order of the ALAP start times.
+//       
+// NAMESPACES :
+//        hops::trace
+//
+// PUBLIC MODULES :
+//        Delay
+//        Timing
+//        Resources
+//        Schedule
+//        Scheduler
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard. It is intended for host builds, and is not
+//        synthesizable.
+//
+//        The figures are estimates. The scheduler does not model
+//        routing delay, the sharing of units between operators of
+//        different types, or the delay of the multiplexers that
+//        sharing adds.
+//
+//        trace.hpp records the scalar operators of a kernel, so a
+//        complex multiplication is scheduled as four
+//        multiplications and two additions.
+//
+//        Kernels built from the Higher-Order Functions have no
+//        loop-carried dependencies, so the initiation interval is
+//        bounded only by the units available to each operator.
+//
+//        The registers counted are the pipeline registers that
+//        hold values between operators (one per value and cycle
+//        boundary crossed), including the registers at the
+//        outputs. The registers inside pipelined operators are
+//        not counted.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __SCHEDULE_HPP
+#define __SCHEDULE_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+#include "trace.hpp"
+namespace hops{
+namespace trace{
+	// MODULE :
+	//        struct Delay
+	// 
+	// DESCRIPTION :
+	//        The timing of one operator: the combinational delay
+	//        (of the first stage, when pipelined), and the number
+	//        of cycles until the result is registered (0 for a
+	//        combinational operator)
+	struct Delay{
+		double delay;
+		std::size_t latency;
+	};
+
+	// MODULE :
+	//        struct Timing
+	// 
+	// DESCRIPTION :
+	//        A table of the Delay of each operator of a Graph
+	//        ("+", "*", "<", "select", ...). Inputs and constants
+	//        take no time. Operators that are not in the table
+	//        take the fallback Delay.
+	// 
+	// FUNCTIONS :
+	//        Timing& set(std::string const& OP, double DELAY, std::size_t LATENCY)
+	//        Delay operator()(std::string const& OP) const
+	struct Timing{
+		std::map<std::string, Delay> ops;
+		Delay fallback;
+
+		Timing(Delay const& FALLBACK = Delay{1.0, 0}) : fallback(FALLBACK){
+			set("input", 0).set("const", 0);
+		}
+
+		// Sets the Delay of OP, and returns this table
+		Timing& set(std::string const& OP, double DELAY, std::size_t LATENCY = 0){
+			ops[OP] = Delay{DELAY, LATENCY};
+			return *this;
+		}
+
+		Delay operator()(std::string const& OP) const{
+			auto it = ops.find(OP);
+			return (it == ops.end()) ? fallback : it->second;
+		}
+	};
+
+	// MODULE :
+	//        Resources
+	// 
+	// DESCRIPTION :
+	//        The number of units of each operator (at least 1).
+	//        Operators that are not in the map have as many units
+	//        as they need.
+	typedef std::map<std::string, std::size_t> Resources;
+
+	// MODULE :
+	//        struct Schedule
+	// 
+	// DESCRIPTION :
+	//        The result of scheduling a Graph: the start and ready
+	//        time of each node (in the units of the clock period,
+	//        from the start of the first cycle) and the figures of
+	//        the kernel
+	// 
+	// FUNCTIONS :
+	//        std::size_t cycle(std::size_t ID) const
+	struct Schedule{
+		double period;
+		// The time each node starts, and the time its result
+		// is ready
+		std::vector<double> start, ready;
+		// The cycles from the first input to the last
+		// (registered) output
+		std::size_t latency;
+		// The cycles between the starts of consecutive inputs
+		std::size_t ii;
+		// The number of pipeline registers
+		std::size_t registers;
+		// The longest chain of combinational delay in a cycle
+		double delay;
+
+		// Returns the cycle that node ID starts in
+		std::size_t cycle(std::size_t ID) const{
+			return index(start[ID], period);
+		}
+
+		// Returns the cycle that contains time T. A time on a
+		// cycle boundary belongs to the cycle it begins.
+		static std::size_t index(double T, double PERIOD){
+			return static_cast<std::size_t>(std::floor(T / PERIOD + 1e-9));
+		}
+	};
+
+	// MODULE :
+	//        struct Scheduler
+	// 
+	// DESCRIPTION :
+	//        Schedules Graphs with a Timing table at a target clock
+	//        period
+	// 
+	// FUNCTIONS :
+	//        Schedule asap(Graph const&) const
+	//        Schedule alap(Graph const&, std::size_t LATENCY) const
+	//        Schedule alap(Graph const&) const
+	//        Schedule list(Graph const&, Resources const&) const
+	//
+	// NOTES :
+	//        The Timing and the period are in the same unit (e.g.
+	//        nanoseconds).
+	struct Scheduler{
+		Timing timing;
+		double period;
+
+		Scheduler(Timing const& TIMING, double PERIOD)
+			: timing(TIMING), period(PERIOD){
+		}
+
+		// FUNCTION :
+		//        asap
+		// 
+		// DESCRIPTION :
+		//        Starts every operator of G as soon as its
+		//        arguments are ready. The initiation interval is
+		//        1.
+		Schedule asap(Graph const& G) const{
+			Schedule s = empty(G);
+			for(std::size_t i = 0; i < G.nodes.size(); ++i){
+				s.start[i] = earliest(G, s, i, arrival(G, s, i));
+				s.ready[i] = finish(G.nodes[i], s.start[i]);
+			}
+			return summarize(G, s, 1);
+		}
+
+		// FUNCTION :
+		//        alap
+		// 
+		// DESCRIPTION :
+		//        Starts every operator of G as late as it can
+		//        while every output is registered by cycle
+		//        LATENCY (by default, the latency of asap). Inputs
+		//        arrive in the first cycle. The initiation
+		//        interval is 1.
+		//
+		// NOTES :
+		//        LATENCY must not be less than the latency of asap.
+		Schedule alap(Graph const& G, std::size_t LATENCY) const{
+			Schedule s = empty(G);
+			double end = LATENCY * period;
+			std::vector<double> deadline(G.nodes.size(), end);
+			for(std::size_t o = 0; o < G.outputs.size(); ++o){
+				std::size_t id = G.outputs[o].first;
+				deadline[id] = std::min(deadline[id], end);
+			}
+			for(std::size_t n = G.nodes.size(); n > 0; --n){
+				std::size_t i = n - 1;
+				Node const& node = G.nodes[i];
+				if(node.args.empty()){
+					s.start[i] = s.ready[i] = 0;
+				} else {
+					s.start[i] = latest(node, deadline[i]);
+					s.ready[i] = finish(node, s.start[i]);
+				}
+				for(std::size_t a : node.args){
+					deadline[a] = std::min(deadline[a], s.start[i]);
+				}
+			}
+			return summarize(G, s, 1);
+		}
+
+		Schedule alap(Graph const& G) const{
+			return alap(G, asap(G).latency);
+		}
+
+		// FUNCTION :
+		//        list
+		// 
+		// DESCRIPTION :
+		//        Schedules G cycle by cycle with at most UNITS[OP]
+		//        operators OP starting in each cycle (and, for
+		//        combinational operators longer than the period,
+		//        running in each cycle). The operators that can
+		//        start in a cycle are taken in the order of their
+		//        ALAP start times. The initiation interval is the
+		//        most cycles that the operators of one type
+		//        occupy their units.
+		Schedule list(Graph const& G, Resources const& UNITS) const{
+			Schedule late = alap(G);
+			Schedule s = empty(G);
+			std::size_t n = G.nodes.size();
+			std::vector<bool> done(n, false);
+			std::vector<std::size_t> waiting;
+			for(std::size_t i = 0; i < n; ++i){
+				if(G.nodes[i].args.empty()){
+					done[i] = true;
+				} else {
+					waiting.push_back(i);
+				}
+			}
+			std::stable_sort(waiting.begin(), waiting.end(),
+					 [&late](std::size_t l, std::size_t r){
+						 return late.start[l] < late.start[r];
+					 });
+			// busy[OP][c] is the number of units of OP in use
+			// in cycle c
+			std::map<std::string, std::vector<std::size_t> > busy;
+			for(std::size_t c = 0; !waiting.empty(); ++c){
+				// Chaining can make more operators ready in
+				// the same cycle
+				bool progress = true;
+				while(progress){
+					progress = false;
+					for(auto it = waiting.begin(); it != waiting.end();){
+						std::size_t i = *it;
+						Node const& node = G.nodes[i];
+						bool ready = true;
+						for(std::size_t a : node.args){
+							ready = ready && done[a];
+						}
+						double t = ready ? earliest(G, s, i, std::max(arrival(G, s, i), c * period)) : 0;
+						if(!ready || Schedule::index(t, period) != c ||
+						   !reserve(busy, UNITS, node.op, c, occupancy(node), false)){
+							++it;
+							continue;
+						}
+						reserve(busy, UNITS, node.op, c, occupancy(node), true);
+						s.start[i] = t;
+						s.ready[i] = finish(node, t);
+						done[i] = true;
+						it = waiting.erase(it);
+						progress = true;
+					}
+				}
+			}
+			std::size_t ii = 1;
+			for(auto const& u : UNITS){
+				std::size_t cycles = 0;
+				for(Node const& node : G.nodes){
+					cycles += (node.op == u.first) ? occupancy(node) : 0;
+				}
+				std::size_t units = std::max<std::size_t>(u.second, 1);
+				ii = std::max(ii, (cycles + units - 1) / units);
+			}
+			return summarize(G, s, ii);
+		}
+
+	private:
+		Schedule empty(Graph const& G) const{
+			Schedule s;
+			s.period = period;
+			s.start.assign(G.nodes.size(), 0);
+			s.ready.assign(G.nodes.size(), 0);
+			s.latency = s.ii = s.registers = 0;
+			s.delay = 0;
+			return s;
+		}
+
+		// Returns the time that the last argument of node ID is
+		// ready
+		double arrival(Graph const& G, Schedule const& S, std::size_t ID) const{
+			double t = 0;
+			for(std::size_t a : G.nodes[ID].args){
+				t = std::max(t, S.ready[a]);
+			}
+			return t;
+		}
+
+		// Returns the number of cycles a unit of NODE is in use
+		std::size_t occupancy(Node const& NODE) const{
+			Delay d = timing(NODE.op);
+			return (d.latency == 0 && d.delay > period) ? cycles(d.delay) : 1;
+		}
+
+		// Returns the number of cycles that T spans
+		std::size_t cycles(double T) const{
+			return static_cast<std::size_t>(std::ceil(T / period - 1e-9));
+		}
+
+		// Returns the earliest time at or after T that node ID
+		// can start: its first stage must fit in the cycle it
+		// starts in, or (if it is longer than the period) it
+		// must start on a cycle boundary
+		double earliest(Graph const& G, Schedule const& S, std::size_t ID, double T) const{
+			Node const& node = G.nodes[ID];
+			if(node.args.empty()){
+				return 0;
+			}
+			Delay d = timing(node.op);
+			double begin = Schedule::index(T, period) * period;
+			if(d.delay > period){
+				return (T > begin + 1e-9) ? begin + period : begin;
+			}
+			return (T + d.delay > begin + period + 1e-9) ? begin + period : T;
+		}
+
+		// Returns the latest time that NODE can start with its
+		// result ready by time T
+		double latest(Node const& NODE, double T) const{
+			Delay d = timing(NODE.op);
+			double boundary = Schedule::index(T, period) * period;
+			if(d.latency > 0){
+				double c = boundary - d.latency * period;
+				return c + std::max(0.0, period - d.delay);
+			}
+			if(d.delay > period){
+				return boundary - cycles(d.delay) * period;
+			}
+			// The chain must not cross the boundary before T
+			double begin = (T - boundary < 1e-9) ? boundary - period : boundary;
+			return (T - d.delay < begin - 1e-9) ? begin - d.delay : T - d.delay;
+		}
+
+		// Returns the time that the result of NODE, started at
+		// time T, is ready
+		double finish(Node const& NODE, double T) const{
+			Delay d = timing(NODE.op);
+			if(NODE.args.empty()){
+				return T;
+			}
+			if(d.latency > 0){
+				return (Schedule::index(T, period) + d.latency) * period;
+			}
+			if(d.delay > period){
+				return T + cycles(d.delay) * period;
+			}
+			return T + d.delay;
+		}
+
+		// Reserves a unit of OP in CYCLES cycles from cycle C
+		// when TAKE is true, and returns whether one is free
+		static bool reserve(std::map<std::string, std::vector<std::size_t> >& BUSY,
+				Resources const& UNITS, std::string const& OP,
+				std::size_t C, std::size_t CYCLES, bool TAKE){
+			auto limit = UNITS.find(OP);
+			if(limit == UNITS.end()){
+				return true;
+			}
+			std::size_t units = std::max<std::size_t>(limit->second, 1);
+			std::vector<std::size_t>& b = BUSY[OP];
+			if(b.size() < C + CYCLES){
+				b.resize(C + CYCLES, 0);
+			}
+			for(std::size_t c = C; c < C + CYCLES; ++c){
+				if(b[c] >= units){
+					return false;
+				}
+				b[c] += TAKE;
+			}
+			return true;
+		}
+
+		// Computes the latency, registers and combinational
+		// delay of S
+		Schedule summarize(Graph const& G, Schedule& S, std::size_t II) const{
+			S.ii = II;
+			S.latency = 0;
+			for(std::size_t o = 0; o < G.outputs.size(); ++o){
+				S.latency = std::max(S.latency, cycles(S.ready[G.outputs[o].first]));
+			}
+			// The last cycle each value is used in
+			std::vector<std::size_t> last(G.nodes.size(), 0);
+			std::vector<bool> used(G.nodes.size(), false);
+			for(std::size_t i = 0; i < G.nodes.size(); ++i){
+				for(std::size_t a : G.nodes[i].args){
+					last[a] = std::max(last[a], S.cycle(i));
+					used[a] = true;
+				}
+			}
+			for(std::size_t o = 0; o < G.outputs.size(); ++o){
+				last[G.outputs[o].first] = S.latency;
+				used[G.outputs[o].first] = true;
+			}
+			S.registers = 0;
+			S.delay = 0;
+			for(std::size_t i = 0; i < G.nodes.size(); ++i){
+				Node const& node = G.nodes[i];
+				Delay d = timing(node.op);
+				// The cycle the value is computed in. A
+				// combinational result that is ready on a
+				// cycle boundary is still registered at the
+				// end of the cycle it was computed in.
+				std::size_t c = S.cycle(i) + d.latency;
+				if(!node.args.empty() && d.latency == 0 && d.delay > period){
+					c += cycles(d.delay) - 1;
+				}
+				if(used[i] && node.op != "const" && last[i] > c){
+					S.registers += last[i] - c;
+				}
+				if(!node.args.empty() && d.delay <= period){
+					// The chain that ends at node i (or at
+					// its first stage) began at the last
+					// boundary before it starts
+					double begin = Schedule::index(S.start[i], period) * period;
+					S.delay = std::max(S.delay, S.start[i] + d.delay - begin);
+				}
+			}
+			return S;
+		}
+	};
+} // namespace trace
+} // namespace hops
+#endif // __SCHEDULE_HPP
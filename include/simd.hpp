@@ -0,0 +1,564 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        simd.hpp
+//
+// DESCRIPTION :
+//        This file implements the SIMD kernels used by the simd
+//        execution policy (see exec.hpp) on host builds. Arrays of
+//        8, 16 and 32-bit integers, float, double and
+//        std::complex<float> are processed several elements at a
+//        time with the vector extensions of GCC and Clang, and
+//        the remaining elements are processed one at a time.
+//
+//        Only functions with a SIMD form are vectorized. The
+//        std::plus, std::minus, std::multiplies, std::divides and
+//        std::negate function objects have a SIMD form, and
+//        SimdFunction can be specialized to give one to other
+//        function objects.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        SimdFunction
+// 
+// PRIVATE MODULES :
+//        SimdType
+//        SimdAllSame
+//        SimdCallable
+//        SimdExact
+//        SimdHelper
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard. std::experimental::simd requires C++17, so
+//        the GCC and Clang vector extensions are used instead.
+//
+//        On other compilers, and during synthesis (when
+//        __SYNTHESIS__ is defined), no type has a SIMD form and
+//        SimdCallable is always false.
+//
+//        Vectors are 64 bytes wide when the host compiler targets
+//        AVX-512 (F and BW), 32 bytes wide when it targets AVX, and
+//        16 bytes wide otherwise. Use -march=native to select the
+//        widest vectors of the host.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __SIMD_HPP
+#define __SIMD_HPP
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "arrayops.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__SYNTHESIS__)
+#define HOPS_SIMD
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define HOPS_SIMD_BYTES 64
+#elif defined(__AVX__)
+#define HOPS_SIMD_BYTES 32
+#else
+#define HOPS_SIMD_BYTES 16
+#endif
+#endif
+
+namespace hops{
+	// MODULE :
+	//        struct SimdType
+	// 
+	// DESCRIPTION :
+	//        SimdType<T>::value is true when T has a SIMD form.
+	//        Specializations define vector, the vector type that
+	//        holds width elements of type T. std::complex<float> is
+	//        held as interleaved real and imaginary parts in a
+	//        vector of float.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            The element type
+	template <typename T>
+	struct SimdType : public std::false_type{
+		static const std::size_t width = 1;
+	};
+
+#ifdef HOPS_SIMD
+	template <>
+	struct SimdType<std::int8_t> : public std::true_type{
+		typedef std::int8_t vector __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		static const std::size_t width = HOPS_SIMD_BYTES / sizeof(std::int8_t);
+	};
+
+	template <>
+	struct SimdType<std::int16_t> : public std::true_type{
+		typedef std::int16_t vector __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		static const std::size_t width = HOPS_SIMD_BYTES / sizeof(std::int16_t);
+	};
+
+	template <>
+	struct SimdType<std::int32_t> : public std::true_type{
+		typedef std::int32_t vector __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		static const std::size_t width = HOPS_SIMD_BYTES / sizeof(std::int32_t);
+	};
+
+	template <>
+	struct SimdType<float> : public std::true_type{
+		typedef float vector __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		static const std::size_t width = HOPS_SIMD_BYTES / sizeof(float);
+	};
+
+	template <>
+	struct SimdType<double> : public std::true_type{
+		typedef double vector __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		static const std::size_t width = HOPS_SIMD_BYTES / sizeof(double);
+	};
+
+	template <>
+	struct SimdType<std::complex<float> > : public std::true_type{
+		typedef float vector __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		typedef std::int32_t mask __attribute__((vector_size(HOPS_SIMD_BYTES)));
+		static const std::size_t width = HOPS_SIMD_BYTES / sizeof(std::complex<float>);
+	};
+#endif
+
+	// MODULE :
+	//        struct SimdFunction
+	// 
+	// DESCRIPTION :
+	//        The SIMD form of the function object FN. A
+	//        specialization is constructed from an instance of FN,
+	//        and its () operator takes and returns vectors (see
+	//        SimdType) where FN takes and returns elements. The
+	//        unspecialized template has no () operator, so
+	//        functions without a SIMD form are not vectorized.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of the class-wrapped function
+	//
+	// FUNCTIONS :
+	//        SimdFunction(FN const&)
+	//        V operator()(V const&...) const (Specializations)
+	//
+	// EXAMPLE :
+	//        A function object with a SIMD form, that applies the
+	//        same scalar expression to every lane:
+	//
+	//        struct Axpy{
+	//                template <typename T>
+	//                T operator()(T const& X, T const& Y) const{
+	//                        return 3 * X + Y;
+	//                }
+	//        };
+	//
+	//        namespace hops{
+	//        template <>
+	//        struct SimdFunction<Axpy>{
+	//                Axpy f;
+	//                SimdFunction(Axpy const& F) : f(F){}
+	//                template <class V>
+	//                V operator()(V const& X, V const& Y) const{
+	//                        return f(X, Y);
+	//                }
+	//        };
+	//        }
+	template <class FN>
+	struct SimdFunction{
+		SimdFunction(FN const& F){
+		}
+	};
+
+	template <typename T>
+	struct SimdFunction<std::plus<T> >{
+		SimdFunction(std::plus<T> const& F){
+		}
+
+		template <class V>
+		V operator()(V const& A, V const& B) const{
+			return A + B;
+		}
+	};
+
+	template <typename T>
+	struct SimdFunction<std::minus<T> >{
+		SimdFunction(std::minus<T> const& F){
+		}
+
+		template <class V>
+		V operator()(V const& A, V const& B) const{
+			return A - B;
+		}
+	};
+
+	template <typename T>
+	struct SimdFunction<std::multiplies<T> >{
+		SimdFunction(std::multiplies<T> const& F){
+		}
+
+		template <class V>
+		V operator()(V const& A, V const& B) const{
+			return A * B;
+		}
+	};
+
+	template <typename T>
+	struct SimdFunction<std::divides<T> >{
+		SimdFunction(std::divides<T> const& F){
+		}
+
+		template <class V>
+		V operator()(V const& A, V const& B) const{
+			return A / B;
+		}
+	};
+
+	template <typename T>
+	struct SimdFunction<std::negate<T> >{
+		SimdFunction(std::negate<T> const& F){
+		}
+
+		template <class V>
+		V operator()(V const& A) const{
+			return -A;
+		}
+	};
+
+#ifdef HOPS_SIMD
+	// Complex multiplication of interleaved vectors:
+	// (ar + i*ai)(br + i*bi) = (ar*br - ai*bi) + i*(ar*bi + ai*br)
+	template <>
+	struct SimdFunction<std::multiplies<std::complex<float> > >{
+		typedef SimdType<std::complex<float> >::vector vector;
+		typedef SimdType<std::complex<float> >::mask mask;
+		static const std::size_t lanes = 2 * SimdType<std::complex<float> >::width;
+
+		SimdFunction(std::multiplies<std::complex<float> > const& F){
+		}
+
+		vector operator()(vector const& A, vector const& B) const{
+			make_index_sequence<lanes> seq;
+			vector re = shuffle<~std::size_t(1), 0>(A, seq);
+			vector im = shuffle<~std::size_t(1), 1>(A, seq);
+			vector swapped = shuffle<~std::size_t(0), 1>(B, seq);
+			return re * B + im * swapped * sign(seq);
+		}
+
+	private:
+		// Returns the vector whose lane IDX is lane
+		// (IDX & AND) ^ XOR of V
+		template <std::size_t AND, std::size_t XOR, std::size_t... IDX>
+		static vector shuffle(vector const& V, index_sequence<IDX...> SEQ){
+#ifdef __clang__
+			return __builtin_shufflevector(V, V, ((IDX & AND) ^ XOR)...);
+#else
+			return __builtin_shuffle(V, mask{std::int32_t((IDX & AND) ^ XOR)...});
+#endif
+		}
+
+		// Returns -1 in the real lanes and 1 in the imaginary
+		// lanes
+		template <std::size_t... IDX>
+		static vector sign(index_sequence<IDX...> SEQ){
+			return vector{((IDX & 1) ? 1.0f : -1.0f)...};
+		}
+	};
+#endif
+
+	// Lanewise complex division is not complex division
+	template <>
+	struct SimdFunction<std::divides<std::complex<float> > >{
+		SimdFunction(std::divides<std::complex<float> > const& F){
+		}
+	};
+
+	// MODULE :
+	//        struct SimdAllSame
+	// 
+	// DESCRIPTION :
+	//        SimdAllSame<T, TS...>::value is true when every type in
+	//        TS is T
+	template <typename T, typename... TS>
+	struct SimdAllSame : public std::true_type{
+	};
+
+	template <typename T, typename U, typename... TS>
+	struct SimdAllSame<T, U, TS...>
+		: public std::integral_constant<bool, std::is_same<T, U>::value &&
+						SimdAllSame<T, TS...>::value>{
+	};
+
+	// MODULE :
+	//        struct SimdCallable
+	// 
+	// DESCRIPTION :
+	//        SimdCallable<FN, std::tuple<T, TS...>>::value is true
+	//        when F(T, TS...) can be vectorized: every argument type
+	//        is T, T has a SIMD form, F returns T, and the SIMD form
+	//        of F takes and returns vectors of T.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of the class-wrapped function
+	//
+	//        ARGS : class
+	//            A std::tuple of the argument types of FN
+	template <class FN, class ARGS, class = void>
+	struct SimdCallable : public std::false_type{
+	};
+
+	template <class FN, typename T, typename... TS>
+	struct SimdCallable<FN, std::tuple<T, TS...>,
+			    typename std::conditional<true, void,
+			    decltype(std::declval<SimdFunction<FN> const&>()
+				     (std::declval<typename SimdType<T>::vector const&>(),
+				      std::declval<typename SimdType<TS>::vector const&>()...))>::type>
+		: public std::integral_constant<bool, SimdAllSame<T, TS...>::value &&
+			std::is_same<typename std::decay<decltype(std::declval<FN const&>()
+					(std::declval<T const&>(), std::declval<TS const&>()...))>::type, T>::value &&
+			std::is_same<decltype(std::declval<SimdFunction<FN> const&>()
+					      (std::declval<typename SimdType<T>::vector const&>(),
+					       std::declval<typename SimdType<TS>::vector const&>()...)),
+				     typename SimdType<T>::vector>::value>{
+	};
+
+	// MODULE :
+	//        struct SimdExact
+	// 
+	// DESCRIPTION :
+	//        SimdExact<FN, T>::value is true when a reduction with
+	//        FN over elements of type T gives the same result in
+	//        any order, so that a chain of applications of FN can
+	//        be vectorized: integer addition and multiplication.
+	//        Floating-point addition and multiplication are not
+	//        associative.
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            Typename of the class-wrapped function
+	//
+	//        T : typename
+	//            The element type
+	template <class FN, typename T>
+	struct SimdExact
+		: public std::integral_constant<bool, std::is_integral<T>::value &&
+			(std::is_same<FN, std::plus<T> >::value ||
+			 std::is_same<FN, std::multiplies<T> >::value)>{
+	};
+
+	// MODULE :
+	//        struct SimdHelper
+	// 
+	// DESCRIPTION :
+	//        Implements the SIMD kernels for elements of type T.
+	//        Each kernel processes SimdType<T>::width elements at a
+	//        time, and the remaining elements one at a time.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            The element type. SimdType<T>::value must be true.
+	//
+	// FUNCTIONS :
+	//        static void zipWith(FN const&, std::size_t, T*,
+	//                            TS const*...)
+	//        static T mapreduce(FNM const&, FNR const&, std::size_t,
+	//                           TS const*...)
+	//        static T treereduce(FN const&, std::size_t, T const*)
+	template <typename T>
+	struct SimdHelper{
+		typedef typename SimdType<T>::vector vector;
+		static const std::size_t W = SimdType<T>::width;
+
+		// FUNCTION :
+		//        zipWith
+		// 
+		// DESCRIPTION :
+		//        Writes F(IN[i]...) to OUT[i], for i from 0 to
+		//        N-1
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the class-wrapped function
+		//
+		//        TS : typename... (Inferred)
+		//            Types of the input elements (all T)
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped function
+		//
+		//        N : std::size_t
+		//            The number of elements
+		//
+		//        OUT : T*
+		//            The output elements
+		//
+		//        IN : TS const*...
+		//            One or more input elements
+		template <class FN, typename... TS>
+		static void zipWith(FN const& F, std::size_t N, T* OUT, TS const*... IN){
+			SimdFunction<FN> f(F);
+			std::size_t last = N - N % W;
+			for(std::size_t i = 0; i < last; i += W){
+				store(OUT + i, f(load(IN + i)...));
+			}
+			for(std::size_t i = last; i < N; ++i){
+				OUT[i] = F(IN[i]...);
+			}
+		}
+
+		// FUNCTION :
+		//        mapreduce
+		// 
+		// DESCRIPTION :
+		//        Reduces M(IN[i]...), for i from 0 to N-1, with
+		//        R. Each vector lane accumulates every W-th
+		//        element, the lanes are reduced as a tree, and the
+		//        remaining elements are accumulated in order.
+		// 
+		// PARAMETERS :
+		//        FNM : class (Inferred)
+		//            Typename of the class-wrapped map function
+		//
+		//        FNR : class (Inferred)
+		//            Typename of the class-wrapped reduce function
+		//
+		//        TS : typename... (Inferred)
+		//            Types of the input elements (all T)
+		//
+		// ARGUMENTS :
+		//        M : FNM const&
+		//            Instantiation of the class-wrapped map
+		//            function
+		//
+		//        R : FNR const&
+		//            Instantiation of the class-wrapped reduce
+		//            function
+		//
+		//        N : std::size_t
+		//            The number of elements. Must be at least W.
+		//
+		//        IN : TS const*...
+		//            One or more input elements
+		//
+		// RETURNS : T
+		//        The reduced value
+		template <class FNM, class FNR, typename... TS>
+		static T mapreduce(FNM const& M, FNR const& R, std::size_t N,
+				TS const*... IN){
+			SimdFunction<FNM> m(M);
+			SimdFunction<FNR> r(R);
+			std::size_t last = N - N % W;
+			vector acc = m(load(IN)...);
+			for(std::size_t i = W; i < last; i += W){
+				acc = r(acc, m(load(IN + i)...));
+			}
+			T res = horizontal(R, acc);
+			for(std::size_t i = last; i < N; ++i){
+				res = R(res, M(IN[i]...));
+			}
+			return res;
+		}
+
+		// FUNCTION :
+		//        treereduce
+		// 
+		// DESCRIPTION :
+		//        Reduces IN[i], for i from 0 to N-1, with F, in the
+		//        same order as mapreduce
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the class-wrapped function
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped function
+		//
+		//        N : std::size_t
+		//            The number of elements. Must be at least W.
+		//
+		//        IN : T const*
+		//            The input elements
+		//
+		// RETURNS : T
+		//        The reduced value
+		template <class FN>
+		static T treereduce(FN const& F, std::size_t N, T const* IN){
+			SimdFunction<FN> f(F);
+			std::size_t last = N - N % W;
+			vector acc = load(IN);
+			for(std::size_t i = W; i < last; i += W){
+				acc = f(acc, load(IN + i));
+			}
+			T res = horizontal(F, acc);
+			for(std::size_t i = last; i < N; ++i){
+				res = F(res, IN[i]);
+			}
+			return res;
+		}
+
+	private:
+		static vector load(T const* P){
+			vector v;
+			std::memcpy(&v, P, sizeof(v));
+			return v;
+		}
+
+		static void store(T* P, vector const& V){
+			std::memcpy(P, &V, sizeof(V));
+		}
+
+		// Reduces the lanes of V with F as a tree
+		template <class FN>
+		static T horizontal(FN const& F, vector const& V){
+			T lanes[W];
+			store(lanes, V);
+			for(std::size_t n = W; n > 1; n /= 2){
+				for(std::size_t k = 0; k < n / 2; ++k){
+					lanes[k] = F(lanes[2*k], lanes[2*k + 1]);
+				}
+			}
+			return lanes[0];
+		}
+	};
+} // namespace hops
+#endif // __SIMD_HPP
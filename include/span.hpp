@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        span.hpp
+//
+// DESCRIPTION :
+//        This file implements Span, a runtime-length window onto
+//        contiguous memory, and Arena, which divides a
+//        caller-provided buffer into Spans. They are used by the
+//        runtime-length Higher-Order Functions in the hops::dyn
+//        namespace.
+//
+// NAMESPACES :
+//        hops::dyn
+//
+// PUBLIC MODULES :
+//        Span
+//        Arena
+//
+// PUBLIC FUNCTIONS :
+//        span
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        A Span or Arena does not own its memory, and must not
+//        outlive it.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __SPAN_HPP
+#define __SPAN_HPP
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+namespace hops{
+namespace dyn{
+	// MODULE :
+	//        struct Span
+	// 
+	// DESCRIPTION :
+	//        A pointer and a length: the runtime-length counterpart
+	//        of std::array in the hops::dyn namespace. A Span
+	//        converts to a Span of const elements.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the elements, const for a read-only Span
+	// 
+	// FUNCTIONS :
+	//        Span()
+	//        Span(T*, std::size_t)
+	//        T* data() const
+	//        std::size_t size() const
+	//        T& operator[](std::size_t) const
+	//        T* begin() const
+	//        T* end() const
+	//        Span subspan(std::size_t, std::size_t) const
+	template <typename T>
+	struct Span{
+		typedef typename std::remove_cv<T>::type value_type;
+
+		Span() : ptr(nullptr), len(0){
+		}
+
+		Span(T* PTR, std::size_t LEN) : ptr(PTR), len(LEN){
+		}
+
+		template <typename U, class = typename std::enable_if<
+				  std::is_convertible<U*, T*>::value>::type>
+		Span(Span<U> const& S) : ptr(S.data()), len(S.size()){
+		}
+
+		T* data() const{
+			return ptr;
+		}
+
+		std::size_t size() const{
+			return len;
+		}
+
+		T& operator[](std::size_t IDX) const{
+			return ptr[IDX];
+		}
+
+		T* begin() const{
+			return ptr;
+		}
+
+		T* end() const{
+			return ptr + len;
+		}
+
+		// Returns the LEN elements starting at element OFF
+		Span subspan(std::size_t OFF, std::size_t LEN) const{
+			assert(OFF + LEN <= len);
+			return Span(ptr + OFF, LEN);
+		}
+
+	private:
+		T* ptr;
+		std::size_t len;
+	};
+
+	// FUNCTION :
+	//        span
+	// 
+	// DESCRIPTION :
+	//        Returns a Span of the elements of a contiguous
+	//        container: a std::vector, std::array or Span. The
+	//        elements are const when the container is const.
+	//
+	// EXAMPLE :
+	//        std::vector<int> v(10);
+	//        Span<int> s = span(v); // s.size() === 10
+	template <class C>
+	auto span(C&& IN)
+		-> Span<typename std::remove_pointer<decltype(IN.data())>::type>{
+		return Span<typename std::remove_pointer<decltype(IN.data())>::type>
+			(IN.data(), IN.size());
+	}
+
+	// MODULE :
+	//        struct Arena
+	// 
+	// DESCRIPTION :
+	//        Divides a caller-provided buffer into Spans, so that
+	//        a pipeline of hops::dyn functions can hold its
+	//        temporaries without allocating. take returns the next
+	//        Span of the buffer, and reset returns the whole buffer
+	//        to the Arena.
+	// 
+	// FUNCTIONS :
+	//        Arena(void*, std::size_t)
+	//        Span<T> take<T>(std::size_t)
+	//        void reset()
+	//        std::size_t used() const
+	//
+	// NOTES :
+	//        The elements of a Span are value-initialized by take
+	//        and never destroyed, so T must be trivially
+	//        destructible. Spans taken before a call to reset must
+	//        not be used after it.
+	struct Arena{
+		Arena(void* BUF, std::size_t BYTES)
+			: buf(static_cast<unsigned char*>(BUF)), cap(BYTES), top(0){
+		}
+
+		// Returns a Span of LEN value-initialized elements, or an
+		// empty Span when the buffer has too little space left
+		template <typename T>
+		Span<T> take(std::size_t LEN){
+			static_assert(std::is_trivially_destructible<T>::value,
+				"Arena elements are never destroyed");
+			std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(buf + top);
+			std::size_t pad = (alignof(T) - addr % alignof(T)) % alignof(T);
+			if(pad + LEN * sizeof(T) > cap - top){
+				assert(!"Arena buffer is too small");
+				return Span<T>();
+			}
+			T* res = reinterpret_cast<T*>(buf + top + pad);
+			for(std::size_t i = 0; i < LEN; ++i){
+				new (res + i) T();
+			}
+			top += pad + LEN * sizeof(T);
+			return Span<T>(res, LEN);
+		}
+
+		void reset(){
+			top = 0;
+		}
+
+		// Returns the number of bytes taken since the last reset
+		std::size_t used() const{
+			return top;
+		}
+
+	private:
+		unsigned char* buf;
+		std::size_t cap;
+		std::size_t top;
+	};
+} // namespace dyn
+} // namespace hops
+#endif // __SPAN_HPP
@@ -0,0 +1,384 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        systolic.hpp
+//
+// DESCRIPTION :
+//        This file implements the systolic Higher-Order Function,
+//        which advances a 1-D systolic array of processing
+//        elements (PEs) by one clock cycle.
+//       
+// NAMESPACES :
+//        hops
+//        hops::loop
+//
+// PUBLIC MODULES :
+//        Systolic
+//        loop::Systolic
+// 
+// PRIVATE MODULES :
+//        SystolicHelper
+//
+// PUBLIC VARIABLES :
+//        systolic (an instance of Systolic)
+//        loop::systolic (an instance of loop::Systolic)
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        The systolic array is a chain of H PEs. Each PE holds its
+//        own state (of type TS), and on every cycle reads its own
+//        state, the state of the PE before it in the chain, and
+//        one element from each input array. All PEs update
+//        simultaneously from the states of the previous cycle. The
+//        first PE reads a BOUNDARY state in place of a
+//        predecessor.
+//
+//        A PE that needs more than one cycle of history (e.g. the
+//        diagonal dependency in Smith-Waterman) stores it in its
+//        state, e.g. TS = std::array<score, 2>.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __SYSTOLIC_HPP
+#define __SYSTOLIC_HPP
+#include <array>
+#include <type_traits>
+#include "arrayops.hpp"
+namespace hops{
+	// MODULE :
+	//        struct SystolicHelper
+	// 
+	// DESCRIPTION :
+	//        Computes the next state of every PE in a systolic
+	//        array of length H using a parameter pack expansion
+	//        over the PE indices.
+	// 
+	// PARAMETERS :
+	//        H : std::size_t
+	//            The number of PEs in the systolic array
+	// 
+	// FUNCTIONS :
+	//        std::array<TS, H> operator()(FN const&, TS const&,
+	//                                     std::array<TS, H> const&,
+	//                                     std::array<TI, H> const&...) const
+	template <std::size_t H>
+	struct SystolicHelper{
+		// FUNCTION :
+		//        at
+		// 
+		// DESCRIPTION :
+		//        Computes the next state of PE IDX
+		//
+		// RETURNS : TS
+		//        The result of F applied to PE IDX's index,
+		//        predecessor state, own state, and inputs
+		template <class FN, typename TS, typename... TI>
+		static TS at(FN const& F, std::size_t IDX, TS const& BOUNDARY,
+			std::array<TS, H> const& STATE,
+			std::array<TI, H> const&... IN){
+#pragma HLS INLINE
+			return F(IDX, IDX ? STATE[IDX - 1] : BOUNDARY,
+				STATE[IDX], IN[IDX]...);
+		}
+
+		// FUNCTION :
+		//        expand
+		// 
+		// DESCRIPTION :
+		//        Computes the next state of every PE
+		//
+		// RETURNS : std::array<TS, H>
+		//        The next state of the systolic array
+		template <class FN, typename TS, std::size_t... IDX, typename... TI>
+		static std::array<TS, H> expand(FN const& F, TS const& BOUNDARY,
+						std::array<TS, H> const& STATE,
+						index_sequence<IDX...>,
+						std::array<TI, H> const&... IN){
+#pragma HLS INLINE
+			return {{at(F, IDX, BOUNDARY, STATE, IN...)...}};
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Advances the systolic array by one cycle
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        TS : typename (Inferred)
+		//            Type of the state held by each PE
+		//
+		//        TI : Variadic typename(s) (Inferred)
+		//            Types of the values in the input arrays
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function computing the next state of a PE
+		//
+		//        BOUNDARY : TS const&
+		//            The predecessor state read by PE 0
+		//
+		//        STATE : std::array<TS, H> const&
+		//            The current state of every PE
+		//
+		//        IN : std::array<TI, H> const&...
+		//            The inputs to each PE on this cycle
+		// 
+		// RETURNS : std::array<TS, H>
+		//        The next state of every PE
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename TS, typename... TI>
+		std::array<TS, H> operator()(FN const& F, TS const& BOUNDARY,
+					std::array<TS, H> const& STATE,
+					std::array<TI, H> const&... IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+#pragma HLS INLINE
+			return expand(F, BOUNDARY, STATE, make_index_sequence<H>(), IN...);
+		}
+	};
+
+	// MODULE :
+	//        struct Systolic
+	// 
+	// DESCRIPTION :
+	//        Wraps the systolic array step provided by
+	//        SystolicHelper with the () operator to provide a
+	//        function-like API.
+	// 
+	// FUNCTIONS :
+	//        std::array<TS, H> operator()(FN const&, TS const&,
+	//                                     std::array<TS, H> const&,
+	//                                     std::array<TI, H> const&...) const
+	//        std::array<TS, H> operator()(FN const&, TS const&,
+	//                                     std::array<TS, H> const&,
+	//                                     ES const&...) const
+	//
+	// NOTES :
+	//        A corresponding loop-based implementation is defined
+	//        in the hops::loop namespace
+	//
+	//        Inputs that are views or lazy expressions (see
+	//        view.hpp and lazy.hpp) are evaluated once per step.
+	struct Systolic{
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Advances a systolic array by one cycle. PE i
+		//        computes its next state as
+		//
+		//            F(i, UP, STATE[i], IN[i]...)
+		//
+		//        where UP is STATE[i - 1], or BOUNDARY for i = 0.
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        TS : typename (Inferred)
+		//            Type of the state held by each PE
+		//
+		//        H : std::size_t (Inferred)
+		//            The number of PEs in the systolic array
+		//
+		//        TI : Variadic typename(s) (Inferred)
+		//            Types of the values in the input arrays
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function computing the next state of a
+		//            PE. F is passed the PE index (std::size_t),
+		//            the predecessor state, the PE's own state,
+		//            and one element of each input array.
+		//
+		//        BOUNDARY : TS const&
+		//            The predecessor state read by PE 0
+		//
+		//        STATE : std::array<TS, H> const&
+		//            The current state of every PE
+		//
+		//        IN : std::array<TI, H> const&...
+		//            Zero or more arrays of inputs, one
+		//            element per PE
+		// 
+		// RETURNS : std::array<TS, H>
+		//        The next state of every PE
+		//
+		// NOTES :
+		//        Only the H states (and not a history of the
+		//        whole array) are copied on each cycle.
+		//
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename TS, std::size_t H, typename... TI>
+		std::array<TS, H> operator()(FN const& F, TS const& BOUNDARY,
+					std::array<TS, H> const& STATE,
+					std::array<TI, H> const&... IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+#pragma HLS INLINE
+			return SystolicHelper<H>()(F, BOUNDARY, STATE, IN...);
+		}
+
+		template <class FN, typename TS, std::size_t H, class... ES>
+		auto operator()(FN const& F, TS const& BOUNDARY,
+				std::array<TS, H> const& STATE,
+				ES const&... IN) const
+			-> typename std::enable_if<AnyLazy<ES...>::value, std::array<TS, H> >::type{
+#pragma HLS INLINE
+			return (*this)(F, BOUNDARY, STATE, evaluate(IN)...);
+		}
+	};
+
+	// VARIABLE :
+	//        systolic (Instance of Systolic)
+	// 
+	// DESCRIPTION :
+	//        Instantion of the Systolic struct that provides a
+	//        function-like API with the operator() function.
+	// 
+	// EXAMPLE:
+	//        // A shift register: every PE takes its predecessor's
+	//        // state, and PE 0 takes the boundary value
+	//        auto shift = [](std::size_t i, int up, int own){return up;};
+	//        std::array<int, 4> s = {1, 2, 3, 4};
+	//        s = systolic(shift, 0, s); // s = {0, 1, 2, 3}
+	//
+	//        // Cycle-stepping: advance the array once per input
+	//        for(std::size_t t = 0; t < T; ++t){
+	//            s = systolic(F, boundary[t], s, in[t]);
+	//        }
+	Systolic systolic;
+
+	namespace loop{
+		// MODULE :
+		//        struct Systolic
+		// 
+		// DESCRIPTION :
+		//        Implements the systolic array step using a loop
+		//        in the operator() function to provide a
+		//        function-like API.
+		// 
+		// FUNCTIONS :
+		//        std::array<TS, H> operator()(FN const&, TS const&,
+		//                                     std::array<TS, H> const&,
+		//                                     std::array<TI, H> const&...) const
+		struct Systolic{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Advances a systolic array by one cycle
+			//        using an unrolled for-loop over the PEs
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a class-wrapped function. 
+			// 
+			//        TS : typename (Inferred)
+			//            Type of the state held by each PE
+			//
+			//        H : std::size_t (Inferred)
+			//            The number of PEs in the systolic array
+			//
+			//        TI : Variadic typename(s) (Inferred)
+			//            Types of the values in the input arrays
+			//
+			// ARGUMENTS :
+			//        F : FN const&
+			//            Instantiation of the class-wrapped
+			//            function computing the next state of a
+			//            PE.
+			//
+			//        BOUNDARY : TS const&
+			//            The predecessor state read by PE 0
+			//
+			//        STATE : std::array<TS, H> const&
+			//            The current state of every PE
+			//
+			//        IN : std::array<TI, H> const&...
+			//            Zero or more arrays of inputs, one
+			//            element per PE
+			// 
+			// RETURNS : std::array<TS, H>
+			//        The next state of every PE
+			//
+			// NOTES :
+			//        The trailing const declaration on the
+			//        operator() function is required by our
+			//        library, and indicates to the compiler that
+			//        the method modifies no internal state
+			template <class FN, typename TS, std::size_t H, typename... TI>
+			std::array<TS, H> operator()(FN const& F, TS const& BOUNDARY,
+						std::array<TS, H> const& STATE,
+						std::array<TI, H> const&... IN) const{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=STATE._M_instance
+#pragma HLS INLINE
+				std::array<TS, H> next;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=next._M_instance
+				for(std::size_t i = 0; i < H; ++i){
+#pragma HLS UNROLL
+					next[i] = F(i, i ? STATE[i - 1] : BOUNDARY,
+						STATE[i], IN[i]...);
+				}
+				return next;
+			}
+		};
+
+		// VARIABLE :
+		//        systolic (Instance of loop::Systolic)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the loop::Systolic struct that
+		//        provides a function-like API with the operator()
+		//        function.
+		Systolic systolic;
+	} // namespace loop
+} // namespace hops
+#endif // __SYSTOLIC_HPP
@@ -0,0 +1,394 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        tile.hpp
+//
+// DESCRIPTION :
+//        This file implements the tile function, which runs a
+//        kernel on a compile-time length array over a
+//        runtime-length array (see span.hpp). The input is divided
+//        into tiles of N elements, each tile is copied into a
+//        std::array<T, N>, and the kernel is called on it. The
+//        per-tile results are written to an output array, or
+//        combined into one result with a second function:
+//
+//            tile<16>(argmin, OUT, IN)    // OUT[t] = argmin(tile t)
+//            tile<16>(argmin, least, IN)  // least(...least(r0, r1)...)
+//
+//        The kernel is the same function object (or synthesized
+//        function) that is used on one std::array<T, N>, so a
+//        capture of any length can be processed with the logic
+//        that is synthesized for a fixed length.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        Tile
+// 
+// PRIVATE MODULES :
+//        IsArrayLike
+//        TileOffset
+//
+// PUBLIC FUNCTIONS :
+//        tile
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard.
+//
+//        When the length of the input is not a multiple of N, the
+//        last tile is padded with copies of the last element.
+//        This does not change the result of min, max, argmin or
+//        argmax kernels. Other kernels are passed a padding value
+//        as the last argument (e.g. 0 for a sum).
+//
+//        Tiles are independent, so the per-tile results can be
+//        computed with an execution policy (see exec.hpp) that
+//        implements apply: exec::loop, exec::simd or
+//        exec::parallel. Results are combined in order, from the
+//        first tile to the last.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __TILE_HPP
+#define __TILE_HPP
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+#include "arrayops.hpp"
+#include "span.hpp"
+namespace hops{
+	// MODULE :
+	//        struct IsArrayLike
+	// 
+	// DESCRIPTION :
+	//        IsArrayLike<X>::value is true when X is an array with
+	//        data() and size() member functions (a std::vector,
+	//        std::array or dyn::Span). tile uses it to tell an
+	//        output array from a combining function.
+	// 
+	// PARAMETERS :
+	//        X : class
+	//            The type to test
+	template <class X, class ARRAY = void>
+	struct IsArrayLike : public std::false_type{
+	};
+
+	template <class X>
+	struct IsArrayLike<X, typename std::conditional<true, void,
+				   decltype(std::declval<X&>().data()[std::declval<X&>().size()])>::type>
+		: public std::true_type{
+	};
+
+	// MODULE :
+	//        struct TileOffset
+	// 
+	// DESCRIPTION :
+	//        TileOffset<FN, R>::value is true when FN can be called
+	//        as F(R, R, std::size_t). A combining function with
+	//        this signature is passed the index of the first
+	//        element of the tile that produced its second argument
+	//        (e.g. to turn the index of a per-tile argmin into an
+	//        index of the input).
+	// 
+	// PARAMETERS :
+	//        FN : class
+	//            The combining function
+	//
+	//        R : typename
+	//            The result type of the kernel
+	template <class FN, typename R, class OFFSET = void>
+	struct TileOffset : public std::false_type{
+	};
+
+	template <class FN, typename R>
+	struct TileOffset<FN, R, typename std::conditional<true, void,
+				  decltype(std::declval<FN const&>()(std::declval<R const&>(),
+								     std::declval<R const&>(),
+								     std::size_t()))>::type>
+		: public std::true_type{
+	};
+
+	// MODULE :
+	//        struct Tile
+	// 
+	// DESCRIPTION :
+	//        Wraps the tile function with the () operator to
+	//        provide a function-like API.
+	// 
+	// PARAMETERS :
+	//        N : std::size_t
+	//            The number of elements in a tile
+	// 
+	// FUNCTIONS :
+	//        Span<R> operator()(FN const&, CO&&, CA const&) const
+	//        Span<R> operator()(FN const&, CO&&, CA const&,
+	//                           T const&) const
+	//        Span<R> operator()(P const&, FN const&, CO&&,
+	//                           CA const&) const
+	//        Span<R> operator()(P const&, FN const&, CO&&,
+	//                           CA const&, T const&) const
+	//        R operator()(FN const&, FG const&, CA const&) const
+	//        R operator()(FN const&, FG const&, CA const&,
+	//                     T const&) const
+	template <std::size_t N>
+	struct Tile{
+		static_assert(N > 0, "tile requires at least one element per tile");
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Writes K(tile t) to OUT[t], for each of the
+		//        ceil(IN.size()/N) tiles t of IN
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the kernel
+		//
+		//        CO, CA : class (Inferred)
+		//            Types of the output and input: a
+		//            std::vector, std::array or dyn::Span
+		//
+		// ARGUMENTS :
+		//        K : FN const&
+		//            The kernel, called with a
+		//            std::array<T, N> const&
+		//
+		//        OUT : CO&&
+		//            Output array, with one element per tile
+		//
+		//        IN : CA const&
+		//            The input array
+		// 
+		//        PAD : T const& (Optional)
+		//            The value of the elements after the end of
+		//            IN in the last tile (Default: the last
+		//            element of IN)
+		// 
+		// RETURNS : Span<R>
+		//        A Span of OUT
+		template <class FN, class CO, class CA>
+		auto operator()(FN const& K, CO&& OUT, CA const& IN) const
+			-> typename std::enable_if<IsArrayLike<typename std::remove_reference<CO>::type>::value,
+						   decltype(dyn::span(OUT))>::type{
+#pragma HLS INLINE
+			return (*this)(Serial(), K, OUT, IN, pad(IN));
+		}
+
+		template <class FN, class CO, class CA, typename T>
+		auto operator()(FN const& K, CO&& OUT, CA const& IN, T const& PAD) const
+			-> typename std::enable_if<!IsPolicy<FN>::value &&
+						   IsArrayLike<typename std::remove_reference<CO>::type>::value,
+						   decltype(dyn::span(OUT))>::type{
+#pragma HLS INLINE
+			return (*this)(Serial(), K, OUT, IN, PAD);
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Writes K(tile t) to OUT[t] for each tile t of IN,
+		//        with the tiles divided between the iterations of
+		//        POLICY.apply
+		// 
+		// PARAMETERS :
+		//        P : class (Inferred)
+		//            An execution policy that implements apply
+		//            (exec::loop, exec::simd or exec::parallel)
+		template <class P, class FN, class CO, class CA>
+		auto operator()(P const& POLICY, FN const& K, CO&& OUT, CA const& IN) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+						   decltype(dyn::span(OUT))>::type{
+#pragma HLS INLINE
+			return (*this)(POLICY, K, OUT, IN, pad(IN));
+		}
+
+		template <class P, class FN, class CO, class CA, typename T>
+		auto operator()(P const& POLICY, FN const& K, CO&& OUT, CA const& IN,
+				T const& PAD) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+						   decltype(dyn::span(OUT))>::type{
+#pragma HLS INLINE
+			auto out = dyn::span(OUT);
+			std::size_t const len = IN.size();
+			assert(out.size() == (len + N - 1) / N);
+			auto const* in = IN.data();
+			POLICY.apply(out.size(), [&](std::size_t t){
+					out[t] = K(load(in, len, t * N, PAD));
+				});
+			return out;
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Combines the results of K on each tile of IN with
+		//        G, from the first tile to the last
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of the kernel
+		//
+		//        FG : class (Inferred)
+		//            Typename of the combining function
+		//
+		//        CA : class (Inferred)
+		//            Type of the input: a std::vector,
+		//            std::array or dyn::Span
+		//
+		// ARGUMENTS :
+		//        K : FN const&
+		//            The kernel, called with a
+		//            std::array<T, N> const&
+		//
+		//        G : FG const&
+		//            The combining function, called as G(R, R)
+		//            or, when TileOffset is true, as G(R, R,
+		//            std::size_t)
+		//
+		//        IN : CA const&
+		//            The input array, which must not be empty
+		// 
+		//        PAD : T const& (Optional)
+		//            The value of the elements after the end of
+		//            IN in the last tile (Default: the last
+		//            element of IN)
+		// 
+		// RETURNS : R
+		//        G(...G(G(K(tile 0), K(tile 1)), K(tile 2))...)
+		template <class FN, class FG, class CA>
+		auto operator()(FN const& K, FG const& G, CA const& IN) const
+			-> typename std::enable_if<!IsArrayLike<FG>::value,
+						   decltype(K(std::declval<std::array<
+							      typename std::decay<decltype(IN.data()[0])>::type, N> const&>()))>::type{
+#pragma HLS INLINE
+			return (*this)(K, G, IN, pad(IN));
+		}
+
+		template <class FN, class FG, class CA, typename T>
+		auto operator()(FN const& K, FG const& G, CA const& IN, T const& PAD) const
+			-> typename std::enable_if<!IsPolicy<FN>::value && !IsArrayLike<FG>::value,
+						   decltype(K(std::declval<std::array<
+							      typename std::decay<decltype(IN.data()[0])>::type, N> const&>()))>::type{
+#pragma HLS INLINE
+			typedef typename std::decay<decltype(K(load(IN.data(), 0, 0, PAD)))>::type R;
+			std::size_t const len = IN.size();
+			assert(len > 0);
+			auto const* in = IN.data();
+			R acc = K(load(in, len, 0, PAD));
+			for(std::size_t off = N; off < len; off += N){
+				acc = combine(G, acc, K(load(in, len, off, PAD)), off,
+					      TileOffset<FG, R>());
+			}
+			return acc;
+		}
+
+	private:
+		// The policy used when no policy is passed: a loop over
+		// the tiles
+		struct Serial{
+			typedef Serial policy_type;
+
+			template <class BODY>
+			void apply(std::size_t N_, BODY const& B) const{
+#pragma HLS INLINE
+				for(std::size_t i = 0; i < N_; ++i){
+					B(i);
+				}
+			}
+		};
+
+		// The default padding value: the last element of IN
+		template <class CA>
+		static auto pad(CA const& IN)
+			-> typename std::decay<decltype(IN.data()[0])>::type{
+#pragma HLS INLINE
+			typedef typename std::decay<decltype(IN.data()[0])>::type T;
+			return IN.size() ? IN.data()[IN.size() - 1] : T();
+		}
+
+		// Copies the tile of IN starting at OFF, padded with PAD
+		template <typename TA, typename T>
+		static std::array<typename std::remove_const<TA>::type, N>
+		load(TA* IN, std::size_t LEN, std::size_t OFF, T const& PAD){
+#pragma HLS INLINE
+			std::array<typename std::remove_const<TA>::type, N> res;
+			for(std::size_t i = 0; i < N; ++i){
+				res[i] = (OFF + i < LEN) ? IN[OFF + i] : PAD;
+			}
+			return res;
+		}
+
+		template <class FG, typename R>
+		static R combine(FG const& G, R const& ACC, R const& RES, std::size_t OFF,
+				 std::true_type OFFSET){
+#pragma HLS INLINE
+			return G(ACC, RES, OFF);
+		}
+
+		template <class FG, typename R>
+		static R combine(FG const& G, R const& ACC, R const& RES, std::size_t OFF,
+				 std::false_type OFFSET){
+#pragma HLS INLINE
+			return G(ACC, RES);
+		}
+	};
+
+	// FUNCTION :
+	//        tile
+	// 
+	// DESCRIPTION :
+	//        Runs K on each N-element tile of a runtime-length
+	//        array, using the Tile struct
+	// 
+	// EXAMPLE :
+	//        std::vector<int> capture(1 << 30);
+	//        std::vector<std::pair<int, std::size_t>> mins((capture.size() + 15) / 16);
+	//        tile<16>(argmin, mins, capture);
+	//        auto least = tile<16>(argmin, global_argmin, capture);
+	template <std::size_t N, class... AS>
+	auto tile(AS&&... ARGS)
+		-> decltype(Tile<N>()(std::forward<AS>(ARGS)...)){
+#pragma HLS INLINE
+		return Tile<N>()(std::forward<AS>(ARGS)...);
+	}
+} // namespace hops
+#endif // __TILE_HPP
@@ -0,0 +1,596 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// FILENAME :
+//        trace.hpp
+//
+// DESCRIPTION :
+//        This file implements symbolic tracing. A sym<T> is a value
+//        of type T that also refers to a node of a Graph: every
+//        arithmetic, bitwise and comparison operator applied to a
+//        sym records a node whose arguments are the nodes of its
+//        operands. A kernel that is templated on its element type
+//        (like the Higher-Order Functions in this library) can be
+//        run on arrays of sym, and the Graph then holds the
+//        operator DAG that the unrolled templates build:
+//
+//            trace::Graph g;
+//            auto in = g.input(std::array<int, 16>(), "x");
+//            g.output(treereduce(std::plus<trace::sym<int> >(), in), "sum");
+//            g.dot(std::cout); // 15 "+" nodes on 4 levels
+//
+//        Each node has a level: inputs and constants are on level
+//        0, and every other node is one level above the deepest of
+//        its arguments. The Graph reports the depth, the number of
+//        nodes on each level (parallelism), the fan-out of each
+//        node and a critical path, and can be exported as DOT
+//        (Graphviz) or JSON.
+//       
+// NAMESPACES :
+//        hops::trace
+//
+// PUBLIC MODULES :
+//        Node
+//        Graph
+//        sym
+//
+// PUBLIC FUNCTIONS :
+//        select
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11
+//        standard. It is intended for host builds, and is not
+//        synthesizable.
+//
+//        A sym also holds the value of T that the operators compute,
+//        so a traced kernel returns the same values as an untraced
+//        one. A sym<bool> converts to bool, so kernels that branch
+//        on a comparison (if, ?:, std::max) still run, but only the
+//        branch taken for the traced inputs is recorded. Kernels
+//        that call select in place of ?: (see batch.hpp) record a
+//        "select" node, and their graph does not depend on the
+//        inputs.
+//
+//        A sym that is constructed from a T (e.g. a literal or a
+//        twiddle factor) is a constant. Operators on constants
+//        are computed without recording a node; a constant operand
+//        of a traced operator is recorded as a "const" node.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __TRACE_HPP
+#define __TRACE_HPP
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+namespace hops{
+namespace trace{
+	template <typename T>
+	struct sym;
+
+	// MODULE :
+	//        struct Node
+	// 
+	// DESCRIPTION :
+	//        One node of a Graph: an input, a constant, or an
+	//        operator applied to the nodes in args.
+	struct Node{
+		// The operator ("+", "<", "select", ...), "input" or
+		// "const"
+		std::string op;
+		// The name of an input, or the value of a constant
+		std::string label;
+		// The arguments of an operator, in order
+		std::vector<std::size_t> args;
+		// 0 for inputs and constants, and one more than the
+		// largest level of the arguments otherwise
+		std::size_t level;
+		// The number of nodes (and outputs) that use this node
+		std::size_t fanout;
+	};
+
+	// MODULE :
+	//        struct Graph
+	// 
+	// DESCRIPTION :
+	//        Records the nodes created by operators on sym values,
+	//        and the outputs marked by output.
+	// 
+	// FUNCTIONS :
+	//        auto input(T const&, std::string const&)
+	//        void output(X const&, std::string const&)
+	//        std::size_t size() const
+	//        std::size_t count(std::string const&) const
+	//        std::size_t depth() const
+	//        std::vector<std::size_t> widths() const
+	//        std::vector<std::size_t> critical_path() const
+	//        void dot(std::ostream&) const
+	//        void json(std::ostream&) const
+	//
+	// NOTES :
+	//        A Graph must outlive the sym values that refer to it.
+	struct Graph{
+		std::vector<Node> nodes;
+		std::vector<std::pair<std::size_t, std::string> > outputs;
+
+		// FUNCTION :
+		//        input
+		// 
+		// DESCRIPTION :
+		//        Returns V as a traced input named NAME. The
+		//        elements of std::array and the real and imaginary
+		//        parts of std::complex are separate inputs, named
+		//        NAME[i], NAME.re and NAME.im.
+		template <typename T>
+		auto input(T const& V, std::string const& NAME)
+			-> typename std::enable_if<std::is_arithmetic<T>::value, sym<T> >::type{
+			return sym<T>(this, add("input", NAME, std::vector<std::size_t>()), V);
+		}
+
+		template <typename T>
+		std::complex<sym<T> > input(std::complex<T> const& V, std::string const& NAME){
+			return std::complex<sym<T> >(input(V.real(), NAME + ".re"),
+						     input(V.imag(), NAME + ".im"));
+		}
+
+		template <typename T, std::size_t LEN>
+		auto input(std::array<T, LEN> const& V, std::string const& NAME)
+			-> std::array<decltype(input(V[0], NAME)), LEN>{
+			std::array<decltype(input(V[0], NAME)), LEN> res;
+			for(std::size_t i = 0; i < LEN; ++i){
+				res[i] = input(V[i], NAME + "[" + std::to_string(i) + "]");
+			}
+			return res;
+		}
+
+		// FUNCTION :
+		//        output
+		// 
+		// DESCRIPTION :
+		//        Marks V (a sym, or a std::array, std::pair or
+		//        std::complex of sym) as an output named NAME
+		template <typename T>
+		void output(sym<T> const& V, std::string const& NAME){
+			std::size_t id = use(V);
+			++nodes[id].fanout;
+			outputs.push_back(std::make_pair(id, NAME));
+		}
+
+		template <typename T>
+		void output(std::complex<sym<T> > const& V, std::string const& NAME){
+			output(V.real(), NAME + ".re");
+			output(V.imag(), NAME + ".im");
+		}
+
+		template <typename TL, typename TR>
+		void output(std::pair<TL, TR> const& V, std::string const& NAME){
+			output(V.first, NAME + ".first");
+			output(V.second, NAME + ".second");
+		}
+
+		template <typename T, std::size_t LEN>
+		void output(std::array<T, LEN> const& V, std::string const& NAME){
+			for(std::size_t i = 0; i < LEN; ++i){
+				output(V[i], NAME + "[" + std::to_string(i) + "]");
+			}
+		}
+
+		// Returns the number of nodes
+		std::size_t size() const{
+			return nodes.size();
+		}
+
+		// Returns the number of nodes with operator OP
+		std::size_t count(std::string const& OP) const{
+			std::size_t n = 0;
+			for(Node const& node : nodes){
+				n += (node.op == OP);
+			}
+			return n;
+		}
+
+		// Returns the largest level of any node
+		std::size_t depth() const{
+			std::size_t d = 0;
+			for(Node const& node : nodes){
+				d = (d < node.level) ? node.level : d;
+			}
+			return d;
+		}
+
+		// Returns the number of operators on each level, from 1
+		// to depth() (element 0 counts the inputs and constants)
+		std::vector<std::size_t> widths() const{
+			std::vector<std::size_t> w(depth() + 1, 0);
+			for(Node const& node : nodes){
+				++w[node.level];
+			}
+			return w;
+		}
+
+		// Returns the nodes of a longest path, from an input or
+		// constant to a node on the deepest level
+		std::vector<std::size_t> critical_path() const{
+			std::vector<std::size_t> path;
+			if(nodes.empty()){
+				return path;
+			}
+			std::size_t id = 0;
+			for(std::size_t i = 0; i < nodes.size(); ++i){
+				id = (nodes[id].level < nodes[i].level) ? i : id;
+			}
+			path.push_back(id);
+			while(nodes[id].level > 0){
+				for(std::size_t arg : nodes[id].args){
+					if(nodes[arg].level + 1 == nodes[id].level){
+						id = arg;
+						break;
+					}
+				}
+				path.push_back(id);
+			}
+			return std::vector<std::size_t>(path.rbegin(), path.rend());
+		}
+
+		// FUNCTION :
+		//        dot
+		// 
+		// DESCRIPTION :
+		//        Writes the graph to OS in the DOT language, with
+		//        one rank per level
+		void dot(std::ostream& OS) const{
+			OS << "digraph hops {\n";
+			OS << "\trankdir=TB;\n";
+			for(std::size_t i = 0; i < nodes.size(); ++i){
+				Node const& n = nodes[i];
+				OS << "\tn" << i << " [label=\"" << escape(n.label.empty() ? n.op : n.label)
+				   << "\\nL" << n.level << "\"";
+				if(n.op == "input"){
+					OS << ", shape=box";
+				} else if(n.op == "const"){
+					OS << ", shape=plaintext";
+				}
+				OS << "];\n";
+			}
+			for(std::size_t i = 0; i < nodes.size(); ++i){
+				for(std::size_t a = 0; a < nodes[i].args.size(); ++a){
+					OS << "\tn" << nodes[i].args[a] << " -> n" << i
+					   << " [label=\"" << a << "\"];\n";
+				}
+			}
+			for(std::size_t o = 0; o < outputs.size(); ++o){
+				OS << "\to" << o << " [label=\"" << escape(outputs[o].second)
+				   << "\", shape=box];\n";
+				OS << "\tn" << outputs[o].first << " -> o" << o << ";\n";
+			}
+			std::vector<std::size_t> w = widths();
+			for(std::size_t l = 0; l < w.size(); ++l){
+				OS << "\t{rank=same;";
+				for(std::size_t i = 0; i < nodes.size(); ++i){
+					if(nodes[i].level == l){
+						OS << " n" << i << ";";
+					}
+				}
+				OS << "}\n";
+			}
+			OS << "}\n";
+		}
+
+		// FUNCTION :
+		//        json
+		// 
+		// DESCRIPTION :
+		//        Writes the graph to OS as a JSON object with the
+		//        members depth, widths, nodes (id, op, label,
+		//        args, level and fanout) and outputs (node and
+		//        name)
+		void json(std::ostream& OS) const{
+			std::vector<std::size_t> w = widths();
+			OS << "{\"depth\": " << depth() << ", \"widths\": [";
+			for(std::size_t l = 0; l < w.size(); ++l){
+				OS << (l ? ", " : "") << w[l];
+			}
+			OS << "],\n \"nodes\": [";
+			for(std::size_t i = 0; i < nodes.size(); ++i){
+				Node const& n = nodes[i];
+				OS << (i ? ",\n  " : "\n  ") << "{\"id\": " << i
+				   << ", \"op\": \"" << escape(n.op)
+				   << "\", \"label\": \"" << escape(n.label) << "\", \"args\": [";
+				for(std::size_t a = 0; a < n.args.size(); ++a){
+					OS << (a ? ", " : "") << n.args[a];
+				}
+				OS << "], \"level\": " << n.level << ", \"fanout\": " << n.fanout << "}";
+			}
+			OS << "],\n \"outputs\": [";
+			for(std::size_t o = 0; o < outputs.size(); ++o){
+				OS << (o ? ",\n  " : "\n  ") << "{\"node\": " << outputs[o].first
+				   << ", \"name\": \"" << escape(outputs[o].second) << "\"}";
+			}
+			OS << "]}\n";
+		}
+
+		// FUNCTION :
+		//        add
+		// 
+		// DESCRIPTION :
+		//        Records a node with operator OP, label LABEL and
+		//        arguments ARGS, and returns its index
+		std::size_t add(std::string const& OP, std::string const& LABEL,
+				std::vector<std::size_t> const& ARGS){
+			Node n = {OP, LABEL, ARGS, 0, 0};
+			for(std::size_t a : ARGS){
+				++nodes[a].fanout;
+				n.level = (n.level < nodes[a].level + 1) ? nodes[a].level + 1 : n.level;
+			}
+			nodes.push_back(n);
+			return nodes.size() - 1;
+		}
+
+		// FUNCTION :
+		//        use
+		// 
+		// DESCRIPTION :
+		//        Returns the index of the node of V, and records a
+		//        constant node when V is a constant
+		template <typename T>
+		std::size_t use(sym<T> const& V){
+			if(V.graph == this){
+				return V.id;
+			}
+			std::ostringstream s;
+			s << V.value;
+			return add("const", s.str(), std::vector<std::size_t>());
+		}
+
+	private:
+		static std::string escape(std::string const& S){
+			std::string res;
+			for(char c : S){
+				if(c == '"' || c == '\\'){
+					res += '\\';
+				}
+				res += c;
+			}
+			return res;
+		}
+	};
+
+	// FUNCTION :
+	//        record
+	// 
+	// DESCRIPTION :
+	//        Returns V as a sym<TR>, recording a node with
+	//        operator OP and the nodes of ARGS as arguments
+	//        when any of ARGS is traced
+	template <typename TR, typename... TS>
+	sym<TR> record(const char* OP, TR const& V, sym<TS> const&... ARGS);
+
+	// sym<bool> is the result of a comparison. It converts to bool
+	// so that kernels can branch on it.
+	template <>
+	struct sym<bool>{
+		typedef bool value_type;
+
+		Graph* graph;
+		std::size_t id;
+		bool value;
+
+		sym() : graph(nullptr), id(0), value(){
+		}
+
+		sym(bool V) : graph(nullptr), id(0), value(V){
+		}
+
+		sym(Graph* G, std::size_t ID, bool V) : graph(G), id(ID), value(V){
+		}
+
+		explicit operator bool() const{
+			return value;
+		}
+
+		friend sym operator&&(sym const& L, sym const& R){
+			return record<bool>("&&", L.value && R.value, L, R);
+		}
+
+		friend sym operator||(sym const& L, sym const& R){
+			return record<bool>("||", L.value || R.value, L, R);
+		}
+
+		friend sym operator!(sym const& IN){
+			return record<bool>("!", !IN.value, IN);
+		}
+	};
+
+	// MODULE :
+	//        struct sym
+	// 
+	// DESCRIPTION :
+	//        A value of type T, and the node of a Graph that
+	//        computes it (or no node, for a constant). Operators
+	//        on sym compute the value of T and record a node.
+	//        Comparisons return a sym<bool>.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            The type of the traced value
+	template <typename T>
+	struct sym{
+		typedef T value_type;
+
+		// The Graph of the node, or nullptr for a constant
+		Graph* graph;
+		std::size_t id;
+		T value;
+
+		sym() : graph(nullptr), id(0), value(){
+		}
+
+		sym(T const& V) : graph(nullptr), id(0), value(V){
+		}
+
+		sym(Graph* G, std::size_t ID, T const& V) : graph(G), id(ID), value(V){
+		}
+
+		explicit operator T() const{
+			return value;
+		}
+
+		sym& operator+=(sym const& R){
+			return *this = *this + R;
+		}
+
+		sym& operator-=(sym const& R){
+			return *this = *this - R;
+		}
+
+		sym& operator*=(sym const& R){
+			return *this = *this * R;
+		}
+
+		sym& operator/=(sym const& R){
+			return *this = *this / R;
+		}
+
+		friend sym operator+(sym const& L, sym const& R){
+			return record<T>("+", L.value + R.value, L, R);
+		}
+
+		friend sym operator-(sym const& L, sym const& R){
+			return record<T>("-", L.value - R.value, L, R);
+		}
+
+		friend sym operator*(sym const& L, sym const& R){
+			return record<T>("*", L.value * R.value, L, R);
+		}
+
+		friend sym operator/(sym const& L, sym const& R){
+			return record<T>("/", L.value / R.value, L, R);
+		}
+
+		friend sym operator%(sym const& L, sym const& R){
+			return record<T>("%", L.value % R.value, L, R);
+		}
+
+		friend sym operator&(sym const& L, sym const& R){
+			return record<T>("&", L.value & R.value, L, R);
+		}
+
+		friend sym operator|(sym const& L, sym const& R){
+			return record<T>("|", L.value | R.value, L, R);
+		}
+
+		friend sym operator^(sym const& L, sym const& R){
+			return record<T>("^", L.value ^ R.value, L, R);
+		}
+
+		friend sym operator<<(sym const& L, sym const& R){
+			return record<T>("<<", L.value << R.value, L, R);
+		}
+
+		friend sym operator>>(sym const& L, sym const& R){
+			return record<T>(">>", L.value >> R.value, L, R);
+		}
+
+		friend sym<bool> operator<(sym const& L, sym const& R){
+			return record<bool>("<", L.value < R.value, L, R);
+		}
+
+		friend sym<bool> operator>(sym const& L, sym const& R){
+			return record<bool>(">", L.value > R.value, L, R);
+		}
+
+		friend sym<bool> operator<=(sym const& L, sym const& R){
+			return record<bool>("<=", L.value <= R.value, L, R);
+		}
+
+		friend sym<bool> operator>=(sym const& L, sym const& R){
+			return record<bool>(">=", L.value >= R.value, L, R);
+		}
+
+		friend sym<bool> operator==(sym const& L, sym const& R){
+			return record<bool>("==", L.value == R.value, L, R);
+		}
+
+		friend sym<bool> operator!=(sym const& L, sym const& R){
+			return record<bool>("!=", L.value != R.value, L, R);
+		}
+
+		friend sym operator-(sym const& IN){
+			return record<T>("neg", -IN.value, IN);
+		}
+
+		friend sym operator~(sym const& IN){
+			return record<T>("~", ~IN.value, IN);
+		}
+	};
+
+	template <typename TR, typename... TS>
+	sym<TR> record(const char* OP, TR const& V, sym<TS> const&... ARGS){
+		Graph* g = nullptr;
+		Graph* gs[] = {ARGS.graph...};
+		for(Graph* a : gs){
+			g = a ? a : g;
+		}
+		if(!g){
+			return sym<TR>(V);
+		}
+		return sym<TR>(g, g->add(OP, "", std::vector<std::size_t>{g->use(ARGS)...}), V);
+	}
+
+	// FUNCTION :
+	//        select
+	// 
+	// DESCRIPTION :
+	//        Returns A if M is true and B otherwise, recording a
+	//        "select" node (a multiplexer) with the arguments M, A
+	//        and B. Kernels that call select in place of ?: (see
+	//        batch.hpp) record the same graph for every input.
+	//
+	// EXAMPLE :
+	//        using hops::select;
+	//        T lo = select(R < L, R, L); // T = trace::sym<int>
+	template <typename T>
+	sym<T> select(sym<bool> const& M, sym<T> const& A, sym<T> const& B){
+		return record<T>("select", M.value ? A.value : B.value, M, A, B);
+	}
+} // namespace trace
+} // namespace hops
+#endif // __TRACE_HPP
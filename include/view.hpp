@@ -0,0 +1,230 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        view.hpp
+//
+// DESCRIPTION :
+//        This file implements views: read-only windows onto a
+//        std::array with a compile-time offset, stride and
+//        direction. split, tail, reverse and head on a view return
+//        views (or an element) onto the same array, so recursive
+//        decompositions such as divconq copy nothing until a leaf
+//        reads an element.
+//       
+// NAMESPACES :
+//        hops
+//
+// PUBLIC MODULES :
+//        view
+//
+// PUBLIC FUNCTIONS :
+//        make_view
+//
+// PRIVATE FUNCTIONS :
+//        view_index
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        A view is a lazy expression (see lazy.hpp), so map,
+//        zipWith, rrotate and lrotate on a view build lazy
+//        expressions, and every Higher-Order Function in this
+//        library accepts a view in place of a std::array.
+//
+//        A view holds a pointer to the data of its std::array. It
+//        must not outlive the array.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __VIEW_HPP
+#define __VIEW_HPP
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "arrayops.hpp"
+#include "lazy.hpp"
+namespace hops{
+	// FUNCTION :
+	//        view_index
+	// 
+	// DESCRIPTION :
+	//        Returns the index in an array of element IDX of a
+	//        view with the given offset and stride
+	//
+	// NOTES :
+	//        The result for an empty view (IDX = -1) is never read
+	constexpr std::size_t view_index(std::size_t OFFSET, std::ptrdiff_t STRIDE,
+					 std::size_t IDX){
+		return static_cast<std::size_t>(static_cast<std::ptrdiff_t>(OFFSET) +
+						STRIDE * static_cast<std::ptrdiff_t>(IDX));
+	}
+
+	// MODULE :
+	//        struct view
+	// 
+	// DESCRIPTION :
+	//        A read-only view of LEN elements of an array, where
+	//        element idx of the view is element OFFSET + STRIDE *
+	//        idx of the array.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the elements in the array
+	//
+	//        OFFSET : std::size_t
+	//            Index in the array of the first element of the view
+	//
+	//        STRIDE : std::ptrdiff_t
+	//            Distance in the array between adjacent elements of
+	//            the view. A negative stride is a reversed view.
+	//
+	//        LEN : std::size_t
+	//            Length of the view
+	//
+	// FUNCTIONS :
+	//        T const& operator[](std::size_t) const
+	//        std::pair<view<T, ...>, view<T, ...> > split() const
+	//        view<T, OFFSET + STRIDE, STRIDE, LEN - 1> tail() const
+	//        view<T, OFFSET + STRIDE * (LEN - 1), -STRIDE, LEN> reverse() const
+	//        T const& head() const
+	//
+	// NOTES :
+	//        The trailing const declaration on the member
+	//        functions is required by our library, and indicates
+	//        to the compiler that the method modifies no internal
+	//        state
+	template <typename T, std::size_t OFFSET, std::ptrdiff_t STRIDE, std::size_t LEN>
+	struct view : public LazyExpr<view<T, OFFSET, STRIDE, LEN>, T, LEN>{
+		T const* DATA;
+
+		explicit view(T const* DATA) : DATA(DATA){
+#pragma HLS INLINE
+		}
+
+		T const& operator[](std::size_t idx) const{
+#pragma HLS INLINE
+			return DATA[view_index(OFFSET, STRIDE, idx)];
+		}
+
+		// As with split on arrays, IDX is clamped to LEN
+		template <std::size_t IDX>
+		std::pair<view<T, OFFSET, STRIDE, (IDX > LEN)? LEN : IDX>,
+			  view<T, view_index(OFFSET, STRIDE, (IDX > LEN)? LEN : IDX),
+			       STRIDE, (IDX > LEN)? 0 : LEN - IDX> >
+		split() const{
+#pragma HLS INLINE
+			static const std::size_t llen = (IDX > LEN)? LEN : IDX;
+			static const std::size_t rlen = (IDX > LEN)? 0 : LEN - IDX;
+			return {view<T, OFFSET, STRIDE, llen>(DATA),
+				view<T, view_index(OFFSET, STRIDE, llen), STRIDE, rlen>(DATA)};
+		}
+
+		view<T, view_index(OFFSET, STRIDE, 1), STRIDE, LEN - 1> tail() const{
+#pragma HLS INLINE
+			static_assert(LEN > 0, "Cannot take the tail of an empty view");
+			return view<T, view_index(OFFSET, STRIDE, 1), STRIDE, LEN - 1>(DATA);
+		}
+
+		view<T, view_index(OFFSET, STRIDE, LEN - 1), -STRIDE, LEN> reverse() const{
+#pragma HLS INLINE
+			return view<T, view_index(OFFSET, STRIDE, LEN - 1), -STRIDE, LEN>(DATA);
+		}
+
+		T const& head() const{
+#pragma HLS INLINE
+			return (*this)[0];
+		}
+	};
+
+	// FUNCTION :
+	//        make_view
+	// 
+	// DESCRIPTION :
+	//        Returns a view of an array. With no template arguments
+	//        the view covers the whole array in order. Otherwise
+	//        the view has LEN elements, starting at index OFFSET and
+	//        spaced by STRIDE.
+	//
+	// PARAMETERS :
+	//        OFFSET : std::size_t
+	//            Index in IN of the first element of the view
+	//
+	//        STRIDE : std::ptrdiff_t
+	//            Distance in IN between adjacent elements of the
+	//            view
+	//
+	//        LEN : std::size_t
+	//            Length of the view
+	//
+	//        T : typename (Inferred)
+	//            Type of the elements in the input std::array
+	//
+	//        N : std::size_t (Inferred)
+	//            Length of the std::array input argument
+	//
+	// ARGUMENTS :
+	//        IN : std::array<T, N> const&
+	//            The input array
+	// 
+	// RETURNS : view<T, OFFSET, STRIDE, LEN>
+	//            A view of IN
+	//
+	// EXAMPLE :
+	//
+	//            std::array<int, 6> a = {0, 1, 2, 3, 4, 5};
+	//            auto v = make_view(a);
+	//            auto odd = make_view<1, 2, 3>(a); // odd === {1, 3, 5}
+	//            int b = head(reverse(tail(v))); // b === 5
+	//        
+	// NOTES :
+	//        IN must outlive the view
+	template <typename T, std::size_t N>
+	view<T, 0, 1, N> make_view(std::array<T, N> const& IN){
+#pragma HLS INLINE
+		return view<T, 0, 1, N>(IN.data());
+	}
+
+	template <std::size_t OFFSET, std::ptrdiff_t STRIDE, std::size_t LEN,
+		  typename T, std::size_t N>
+	view<T, OFFSET, STRIDE, LEN> make_view(std::array<T, N> const& IN){
+#pragma HLS INLINE
+		static_assert(LEN == 0 || (OFFSET < N && view_index(OFFSET, STRIDE, LEN - 1) < N),
+			      "View exceeds the bounds of its array");
+		return view<T, OFFSET, STRIDE, LEN>(IN.data());
+	}
+} // namespace hops
+#endif // __VIEW_HPP
@@ -0,0 +1,585 @@
+// ----------------------------------------------------------------------
+// Copyright (c) 2018, The Regents of the University of California All
+// rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of The Regents of the University of California
+//       nor the names of its contributors may be used to endorse or
+//       promote products derived from this software without specific
+//       prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL REGENTS OF THE
+// UNIVERSITY OF CALIFORNIA BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+// OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+// ----------------------------------------------------------------------
+// **********************************************************************
+// FILENAME :
+//        window.hpp
+//
+// DESCRIPTION :
+//        This file implements the window (sliding-window stencil)
+//        Higher-Order Function, and the DelayLine state type that
+//        holds the window when processing a stream one sample at a
+//        time.
+//       
+// NAMESPACES :
+//        hops
+//        hops::loop
+//
+// PUBLIC MODULES :
+//        DelayLine
+//        DelayLineView
+//        Window
+//        loop::Window
+// 
+// PRIVATE MODULES :
+//        None
+//
+// PRIVATE FUNCTIONS :
+//        window_count
+//
+// PUBLIC FUNCTIONS :
+//        window
+//        loop::window
+//
+// NOTES :
+//        This file requires a compiler implementing the C++11 standard.
+//
+//        A window of K samples is passed to F ordered from the
+//        newest sample (index 0) to the oldest (index K - 1), so a
+//        1-D convolution with coefficients C is
+//        zipWith(multiplies, C, window), reduced.
+//
+//        The array form passes each window to F as a
+//        std::array<T, K>. The stream form passes a DelayLineView,
+//        a lazy expression (see lazy.hpp) that reads the delay line
+//        in place, so a push does not copy the window. F may index
+//        the view, or pass it to any Higher-Order Function; a
+//        function that takes a std::array<T, K> converts the view,
+//        and copies the window.
+//
+// AUTHOR : Dustin Richmond (drichmond)
+//
+// **********************************************************************
+#ifndef __WINDOW_HPP
+#define __WINDOW_HPP
+#include <array>
+#include <utility>
+#include "arrayops.hpp"
+#include "lazy.hpp"
+namespace hops{
+	// MODULE :
+	//        struct DelayLine
+	// 
+	// DESCRIPTION :
+	//        Holds the K most recent samples of a stream. 
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the samples in the stream
+	//
+	//        K : std::size_t
+	//            Number of samples held by the delay line
+	// 
+	// FUNCTIONS :
+	//        void push(T const&)
+	//        T const& operator[](std::size_t) const
+	//        std::array<T, K> array() const
+	//
+	// NOTES :
+	//        During synthesis (when __SYNTHESIS__ is defined) the
+	//        delay line is a shift register: a fully partitioned
+	//        array that is shifted on every push. In software it is
+	//        a circular buffer, so that a push costs O(1) instead of
+	//        O(K) copies.
+	template <typename T, std::size_t K>
+	struct DelayLine{
+		static_assert(K > 0, "DelayLine requires at least one sample");
+		std::array<T, K> line;
+#ifndef __SYNTHESIS__
+		// Location of the newest sample in line
+		std::size_t head;
+#endif
+
+		// FUNCTION :
+		//        DelayLine
+		// 
+		// DESCRIPTION :
+		//        Constructs a delay line with every sample set
+		//        to T()
+		DelayLine(){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=line._M_instance
+			line.fill(T());
+#ifndef __SYNTHESIS__
+			head = 0;
+#endif
+		}
+
+		// FUNCTION :
+		//        DelayLine
+		// 
+		// DESCRIPTION :
+		//        Constructs a delay line with every sample set
+		//        to V
+		// 
+		// ARGUMENTS :
+		//        V : T const&
+		//            Initial value of every sample
+		//
+		// NOTES :
+		//        The constructor is explicit, so that a sample is
+		//        not silently converted to a delay line
+		explicit DelayLine(T const& V){
+#pragma HLS ARRAY_PARTITION complete VARIABLE=line._M_instance
+			line.fill(V);
+#ifndef __SYNTHESIS__
+			head = 0;
+#endif
+		}
+
+		// FUNCTION :
+		//        push
+		// 
+		// DESCRIPTION :
+		//        Adds a new sample to the delay line, and
+		//        discards the oldest sample.
+		// 
+		// ARGUMENTS :
+		//        IN : T const&
+		//            The new sample
+		void push(T const& IN){
+#pragma HLS INLINE
+#ifdef __SYNTHESIS__
+			line = rshift(IN, line);
+#else
+			head = head ? head - 1 : K - 1;
+			line[head] = IN;
+#endif
+		}
+
+		// FUNCTION :
+		//        operator[]
+		// 
+		// DESCRIPTION :
+		//        Returns the I-th newest sample (0 is the newest)
+		// 
+		// ARGUMENTS :
+		//        I : std::size_t
+		//            Age of the sample, less than K
+		//
+		// RETURNS : T const&
+		//        The I-th newest sample
+		T const& operator[](std::size_t I) const{
+#pragma HLS INLINE
+#ifdef __SYNTHESIS__
+			return line[I];
+#else
+			return line[(head + I < K) ? head + I : head + I - K];
+#endif
+		}
+
+		// FUNCTION :
+		//        array
+		// 
+		// DESCRIPTION :
+		//        Returns the samples in the delay line, from
+		//        newest to oldest
+		//
+		// RETURNS : std::array<T, K>
+		//        The samples in the delay line
+		std::array<T, K> array() const{
+#pragma HLS INLINE
+#ifdef __SYNTHESIS__
+			return line;
+#else
+			std::array<T, K> out;
+			for(std::size_t i = 0; i < K - head; ++i){
+				out[i] = line[head + i];
+			}
+			for(std::size_t i = K - head; i < K; ++i){
+				out[i] = line[i + head - K];
+			}
+			return out;
+#endif
+		}
+
+		// FUNCTION :
+		//        size
+		//
+		// RETURNS : std::size_t
+		//        The number of samples in the delay line (K)
+		static constexpr std::size_t size(){
+			return K;
+		}
+	};
+
+	// MODULE :
+	//        struct DelayLineView
+	// 
+	// DESCRIPTION :
+	//        A lazy expression (see lazy.hpp) over the samples of
+	//        a DelayLine, from newest to oldest. Element I is read
+	//        from the delay line when it is used.
+	// 
+	// PARAMETERS :
+	//        T : typename
+	//            Type of the samples in the delay line
+	//
+	//        K : std::size_t
+	//            Number of samples held by the delay line
+	//
+	// NOTES :
+	//        A DelayLineView holds a reference to its DelayLine.
+	//        It must not outlive the delay line, and it reflects
+	//        later pushes.
+	template <typename T, std::size_t K>
+	struct DelayLineView : public LazyExpr<DelayLineView<T, K>, T, K>{
+		DelayLine<T, K> const& D;
+
+		DelayLineView(DelayLine<T, K> const& D) : D(D){
+#pragma HLS INLINE
+		}
+
+		T const& operator[](std::size_t I) const{
+#pragma HLS INLINE
+			return D[I];
+		}
+	};
+
+	// FUNCTION :
+	//        window_count
+	// 
+	// DESCRIPTION :
+	//        Returns the number of complete K-element windows of
+	//        a LEN-element array, or 0 when K > LEN so that the
+	//        static_assert in Window reports the error instead of
+	//        an array size that underflowed.
+	constexpr std::size_t window_count(std::size_t LEN, std::size_t K){
+		return (K <= LEN) ? LEN - K + 1 : 0;
+	}
+
+	// MODULE :
+	//        struct Window
+	// 
+	// DESCRIPTION :
+	//        Applies a function to every K-sample window of a
+	//        stream or an array.
+	// 
+	// PARAMETERS :
+	//        K : std::size_t
+	//            The number of samples in each window
+	// 
+	// FUNCTIONS :
+	//        auto operator()(FN const&, DelayLine<T, K>&, TI const&) const
+	//        auto operator()(FN const&, std::array<T, LEN> const&) const
+	//        auto operator()(FN const&, E const&) const
+	//
+	// NOTES :
+	//        A corresponding loop-based implementation is defined
+	//        in the hops::loop namespace
+	//
+	//        The windows of a view or lazy expression (see view.hpp
+	//        and lazy.hpp) are gathered from it in place, without an
+	//        intermediate array. Windows overlap, so an element of
+	//        a lazy expression is computed once per window that
+	//        holds it.
+	template <std::size_t K>
+	struct Window{
+		// FUNCTION :
+		//        gather
+		// 
+		// DESCRIPTION :
+		//        Returns the window of IN whose newest sample is
+		//        IN[J + K - 1]. IN is an array or an expression.
+		template <class A, std::size_t... IDX>
+		static std::array<typename A::value_type, K> gather(A const& IN,
+					std::size_t J, index_sequence<IDX...>){
+#pragma HLS INLINE
+			return {{IN[J + K - 1 - IDX]...}};
+		}
+
+		// FUNCTION :
+		//        expand
+		// 
+		// DESCRIPTION :
+		//        Applies F to every window of IN
+		template <class FN, class A, std::size_t... J>
+		static auto expand(FN const& F, A const& IN,
+				index_sequence<J...>)
+			-> std::array<decltype(F(std::array<typename A::value_type, K>())),
+				sizeof...(J)>{
+#pragma HLS INLINE
+			return {{F(gather(IN, J, make_index_sequence<K>()))...}};
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Pushes one sample into a delay line and applies
+		//        F to the resulting window. 
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the samples in the delay line
+		//
+		//        TI : typename (Inferred)
+		//            Type of the new sample, convertible to T
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to the window
+		//
+		//        D : DelayLine<T, K>&
+		//            The delay line holding the state of the
+		//            stream. D is modified.
+		//
+		//        IN : TI const&
+		//            The new sample
+		// 
+		// RETURNS : auto
+		//        The result of F applied to a DelayLineView of D
+		//        after IN is pushed
+		//
+		// NOTES :
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, typename TI>
+		auto operator()(FN const& F, DelayLine<T, K>& D, TI const& IN) const
+			-> decltype(F(std::declval<DelayLineView<T, K> const&>())){
+#pragma HLS INLINE
+			D.push(IN);
+			return F(DelayLineView<T, K>(D));
+		}
+
+		// FUNCTION :
+		//        operator()
+		// 
+		// DESCRIPTION :
+		//        Applies F to every K-element window of an array
+		// 
+		// PARAMETERS :
+		//        FN : class (Inferred)
+		//            Typename of a class-wrapped function. 
+		// 
+		//        T : typename (Inferred)
+		//            Type of the std::array values in the
+		//            input array
+		//
+		//        LEN : std::size_t (Inferred)
+		//            Length of the std::array input argument
+		//
+		// ARGUMENTS :
+		//        F : FN const&
+		//            Instantiation of the class-wrapped
+		//            function to apply to each window
+		//
+		//        IN : std::array<T, LEN> const&
+		//            The input array
+		// 
+		// RETURNS : std::array<decltype(F(std::array<T, K>())), LEN - K + 1>
+		//        Element J is the result of F applied to the
+		//        window {IN[J + K - 1], ..., IN[J]}, i.e. the
+		//        output of the stream form after IN[J + K - 1]
+		//        is pushed.
+		//
+		// NOTES :
+		//        Only complete windows are computed, so the
+		//        output has LEN - K + 1 elements.
+		//
+		//        The trailing const declaration on the
+		//        operator() function is required by our
+		//        library, and indicates to the compiler that
+		//        the method modifies no internal state
+		template <class FN, typename T, std::size_t LEN>
+		auto operator()(FN const& F, std::array<T, LEN> const& IN) const
+			-> std::array<decltype(F(std::array<T, K>())), window_count(LEN, K)>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			static_assert(K > 0 && K <= LEN,
+				"window length must be between 1 and LEN");
+			return expand(F, IN, make_index_sequence<window_count(LEN, K)>());
+		}
+
+		template <class FN, class E>
+		auto operator()(FN const& F, E const& IN) const
+			-> std::array<decltype(F(std::array<typename E::value_type, K>())),
+				window_count(E::size(), K)>{
+#pragma HLS INLINE
+			static_assert(K > 0 && K <= E::size(),
+				"window length must be between 1 and LEN");
+			return expand(F, IN, make_index_sequence<window_count(E::size(), K)>());
+		}
+	};
+
+	// FUNCTION :
+	//        window
+	// 
+	// DESCRIPTION :
+	//        Pushes one sample into a delay line and applies F to
+	//        the resulting K-sample window, using the Window
+	//        struct.
+	// 
+	// EXAMPLE :
+	//        static DelayLine<int, 3> d;
+	//        int avg = window<3>(average, d, sample);
+	template <std::size_t K, class FN, typename T, typename TI>
+	auto window(FN const& F, DelayLine<T, K>& D, TI const& IN)
+		-> decltype(Window<K>()(F, D, IN)){
+#pragma HLS INLINE
+		return Window<K>()(F, D, IN);
+	}
+
+	// FUNCTION :
+	//        window
+	// 
+	// DESCRIPTION :
+	//        Applies F to every K-element window of an array,
+	//        using the Window struct.
+	// 
+	// EXAMPLE :
+	//        std::array<int, 4> a = {1, 2, 3, 4};
+	//        std::array<int, 3> b = window<2>(sum, a); // {3, 5, 7}
+	template <std::size_t K, class FN, typename T, std::size_t LEN>
+	auto window(FN const& F, std::array<T, LEN> const& IN)
+		-> decltype(Window<K>()(F, IN)){
+#pragma HLS INLINE
+		return Window<K>()(F, IN);
+	}
+
+	template <std::size_t K, class FN, class E>
+	auto window(FN const& F, E const& IN)
+		-> decltype(Window<K>()(F, IN)){
+#pragma HLS INLINE
+		return Window<K>()(F, IN);
+	}
+
+	namespace loop{
+		// MODULE :
+		//        struct Window
+		// 
+		// DESCRIPTION :
+		//        Applies a function to every K-sample window of a
+		//        stream or an array, using loops.
+		// 
+		// PARAMETERS :
+		//        K : std::size_t
+		//            The number of samples in each window
+		// 
+		// FUNCTIONS :
+		//        auto operator()(FN const&, DelayLine<T, K>&, TI const&) const
+		//        auto operator()(FN const&, std::array<T, LEN> const&) const
+		template <std::size_t K>
+		struct Window{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Pushes one sample into a delay line and
+			//        applies F to the resulting window. See
+			//        hops::Window.
+			//
+			// NOTES :
+			//        The trailing const declaration on the
+			//        operator() function is required by our
+			//        library, and indicates to the compiler that
+			//        the method modifies no internal state
+			template <class FN, typename T, typename TI>
+			auto operator()(FN const& F, DelayLine<T, K>& D, TI const& IN) const
+				-> decltype(F(std::declval<DelayLineView<T, K> const&>())){
+#pragma HLS INLINE
+				D.push(IN);
+				return F(DelayLineView<T, K>(D));
+			}
+
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Applies F to every K-element window of an
+			//        array using unrolled for-loops. See
+			//        hops::Window.
+			//
+			// NOTES :
+			//        The trailing const declaration on the
+			//        operator() function is required by our
+			//        library, and indicates to the compiler that
+			//        the method modifies no internal state
+			template <class FN, typename T, std::size_t LEN>
+			auto operator()(FN const& F, std::array<T, LEN> const& IN) const
+				-> std::array<decltype(F(std::array<T, K>())), window_count(LEN, K)>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+				static_assert(K > 0 && K <= LEN,
+					"window length must be between 1 and LEN");
+				std::array<decltype(F(std::array<T, K>())), window_count(LEN, K)> out;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=out._M_instance
+				for(std::size_t j = 0; j < window_count(LEN, K); ++j){
+#pragma HLS UNROLL
+					std::array<T, K> w;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=w._M_instance
+					for(std::size_t i = 0; i < K; ++i){
+#pragma HLS UNROLL
+						w[i] = IN[j + K - 1 - i];
+					}
+					out[j] = F(w);
+				}
+				return out;
+			}
+		};
+
+		// FUNCTION :
+		//        window
+		// 
+		// DESCRIPTION :
+		//        Pushes one sample into a delay line and applies
+		//        F to the resulting K-sample window, using the
+		//        loop::Window struct.
+		template <std::size_t K, class FN, typename T, typename TI>
+		auto window(FN const& F, DelayLine<T, K>& D, TI const& IN)
+			-> decltype(Window<K>()(F, D, IN)){
+#pragma HLS INLINE
+			return Window<K>()(F, D, IN);
+		}
+
+		// FUNCTION :
+		//        window
+		// 
+		// DESCRIPTION :
+		//        Applies F to every K-element window of an array,
+		//        using the loop::Window struct.
+		template <std::size_t K, class FN, typename T, std::size_t LEN>
+		auto window(FN const& F, std::array<T, LEN> const& IN)
+			-> decltype(Window<K>()(F, IN)){
+#pragma HLS INLINE
+			return Window<K>()(F, IN);
+		}
+	} // namespace loop
+} // namespace hops
+#endif // __WINDOW_HPP
@@ -39,10 +39,14 @@
 // DESCRIPTION :
 //        This file implements the zip and unzip array manipulation
 //        functions, as well as the zipWith Higher-Order Function.
+//        zipWith takes any number of input arrays. zip and unzip
+//        convert between two arrays and an array of std::pair, or
+//        between three or more arrays and an array of std::tuple.
 //
 // NAMESPACES :
 //        hops
 //        hops::loop
+//        hops::dyn
 //        
 // PUBLIC MODULES :
 //        Zip
@@ -51,6 +55,7 @@
 // 
 // PRIVATE MODULES :
 //        XipHelper
+//        MakeTuple
 //
 // PUBLIC VARIABLES :
 //        zip (an instance of Zip)
@@ -62,7 +67,8 @@
 //        standard.
 //        
 //        All classes and variables are defined in both the hops and
-//        hops::loop namespaces
+//        hops::loop namespaces. The hops::dyn namespace defines
+//        zipWith on runtime-length arrays (see span.hpp).
 //
 // AUTHOR : Dustin Richmond (drichmond)
 //
@@ -70,49 +76,79 @@
 #ifndef __ZIP_HPP
 #define __ZIP_HPP
 #include <array>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include "arrayops.hpp"
+#include "span.hpp"
 namespace hops{
+	// MODULE :
+	//        struct MakeTuple
+	// 
+	// DESCRIPTION :
+	//        Class-wrapped function that returns its arguments as
+	//        a std::tuple. It is the function applied by zip when
+	//        there are three or more input arrays.
+	// 
+	// FUNCTIONS :
+	//        std::tuple<TS...> operator()(TS const&...) const
+	struct MakeTuple{
+		template<typename... TS>
+		std::tuple<TS...> operator()(TS const&... IN) const{
+#pragma HLS INLINE
+			return std::tuple<TS...>(IN...);
+		}
+	};
+
 	// MODULE :
 	//        struct XipHelper
 	// 
 	// DESCRIPTION :
-	//        Implements the linear, loop-like structure using C++
-	//        Template Meta-Programming and Partial Template
-	//        Specialization.
+	//        Implements the zip, unzip, and zipWith functions by
+	//        expanding over an index_sequence of every index in
+	//        the input arrays. Each output element is computed
+	//        directly from the input arrays without the recursive
+	//        copies of tail and prepend.
 	// 
 	// PARAMETERS :
 	//        LEN : std::size_t
-	//            The length of the input list, and the iteration
-	//            variable for C++ Template Meta-Programming
+	//            The length of the input lists
 	// 
 	// FUNCTIONS :
 	//        auto zip(std::array<TL, LEN> const&,
 	//                 std::array<TR, LEN> const&) const
 	//        auto unzip(std::array<pair<TL, TR>, LEN> const&) const
-	//        auto zipWith(std::array<TA, LEN> const&,
-	//                     std::array<TB, LEN> const&) const
-	//        auto zipWith(std::array<TA, LEN> const&,
-	//                     std::array<TB, LEN> const&,
-	//                     std::array<TC, LEN> const&) const
-	//        auto zipWith(std::array<TA, LEN> const&,
-	//                     std::array<TB, LEN> const&,
-	//                     std::array<TC, LEN> const&,
-	//                     std::array<TD, LEN> const&) const
-	//        auto zipWith(std::array<TA, LEN> const&,
-	//                     std::array<TB, LEN> const&,
-	//                     std::array<TC, LEN> const&,
-	//                     std::array<TD, LEN> const&,
-	//                     std::array<TE, LEN> const&) const
+	//        auto zip(std::array<TS, LEN> const&...) const
+	//        auto unzip(std::array<std::tuple<TS...>, LEN> const&) const
+	//        auto zipWith(FN const&, std::array<TS, LEN> const&...) const
+	//        auto zip(std::array<TL, LEN> const&,
+	//                 std::array<TR, LEN> const&,
+	//                 index_sequence<IDX...>) const
+	//        auto unzip(std::array<pair<TL, TR>, LEN> const&,
+	//                   index_sequence<IDX...>) const
+	//        auto unzip(std::array<std::tuple<TS...>, LEN> const&,
+	//                   index_sequence<POS...>,
+	//                   index_sequence<IDX...>) const
+	//        auto expand(FN const&, std::array<TS, LEN> const&...) const
+	//        auto expand(FN const&, std::false_type,
+	//                    std::array<TS, LEN> const&...) const
+	//        auto expand(FN const&, std::true_type,
+	//                    std::array<TS, LEN> const&...) const
+	//        auto column(std::array<std::tuple<TS...>, LEN> const&,
+	//                    index_sequence<IDX...>)
+	//        auto at(FN const&, std::size_t,
+	//                std::array<TS, LEN> const&...)
+	//        auto expand(FN const&, index_sequence<IDX...>,
+	//                    std::array<TS, LEN> const&...) const
 	template <std::size_t LEN>
 	struct XipHelper{
 		// FUNCTION :
 		//        zip
 		// 
 		// DESCRIPTION :
-		//        Implements the zip function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Implements the zip function using a single
+		//        pack expansion of the index_sequence 0, 1,
+		//        ... LEN-1
 		// 
 		// PARAMETERS :
 		//        TL : typename (Inferred)
@@ -151,16 +187,16 @@ namespace hops{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
 #pragma HLS INLINE
-			return prepend({L[0], R[0]}, XipHelper<LEN-1>().zip(tail(L), tail(R)));
+			return zip(L, R, make_index_sequence<LEN>());
 		}
 
 		// FUNCTION :
 		//        unzip
 		// 
 		// DESCRIPTION :
-		//        Implements the unzip function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Implements the unzip function using a single
+		//        pack expansion of the index_sequence 0, 1,
+		//        ... LEN-1
 		// 
 		// PARAMETERS :
 		//        TL : typename (Inferred)
@@ -194,254 +230,100 @@ namespace hops{
 			-> std::pair<std::array<TL, LEN>, std::array<TR, LEN> >{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			std::pair<std::array<TL, LEN - 1>, std::array<TR, LEN - 1> > t =
-				XipHelper<LEN - 1>().unzip(tail(IN));
-#pragma HLS ARRAY_PARTITION complete VARIABLE=t.first._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=t.second._M_instance
-			return {prepend(IN[0].first, t.first), prepend(IN[0].second, t.second)};
+			return unzip(IN, make_index_sequence<LEN>());
 		}
 
 		// FUNCTION :
-		//        zipWith
+		//        zip
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Implements the zip function on three or more
+		//        input arrays using a single pack expansion of
+		//        the index_sequence 0, 1, ... LEN-1
 		// 
 		// PARAMETERS :
-        	//        FN : class (Inferred)
-        	//            Typename of a class-wrapped function. 
-		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
-		//
-		// ARGUMENTS : 
-		//        F : FN const&
-		//            Instantiation of the class-wrapped
-		//            function used to compute an output value
-		//            at each array index
+		//        TS : typename... (Inferred)
+		//            Types of the the std::array values in
+		//            each input array
 		//
-		//        A : std::array<TA, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
+		// ARGUMENTS :
+		//        IN : std::array<TS, LEN> const&...
+		//            Input arrays whose elements will be at the
+		//            corresponding positions in the returned
+		//            array of tuples.
 		// 
-		//        B : std::array<TB, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
+		// RETURNS : std::array<std::tuple<TS...>, LEN>
+		//        An array of tuples, where element K of each
+		//        tuple is the element at that location in
+		//        input array K
 		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0])), LEN>
-		//        An array where the output at each location
-		//        is the result of F's operator() function applied to
-		//        values at corresponding locations in the
-		//        input arrays
-		//
 		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB>
-		auto zipWith(FN const& F, std::array<TA, LEN> const& A,
-			std::array<TB, LEN> const& B) const
-			-> std::array<decltype(F(A[0], B[0])), LEN> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS INLINE
-			return prepend(F(A[0], B[0]),
-				XipHelper<LEN-1>().zipWith(F, tail(A), tail(B)));
-		}
-
-		// FUNCTION :
-		//        zipWith
-		// 
-		// DESCRIPTION :
-		//        Implements the zipWith function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
-		// 
-		// PARAMETERS :
-        	//        FN : class (Inferred)
-        	//            Typename of a class-wrapped function. 
+		//        Zipping two arrays selects the zip function
+		//        above, which returns an array of std::pair
 		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
-		//
-		//        TC : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            third argument
-		//
-		// ARGUMENTS : 
-		//        F : FN const&
-		//            Instantiation of the class-wrapped
-		//            function used to compute an output value
-		//            at each array index
-		//
-		//        A : std::array<TA, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<TB, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
-		// 
-		//        C : std::array<TC, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the third argument to F's 
-		//            operator() function
-		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0], C[0])), LEN>
-		//        An array where the output at each location
-		//        is the result of F's operator() function applied to
-		//        values at corresponding locations in the
-		//        input arrays
-		//
-		// NOTES :
 		//        The trailing const declaration on the
 		//        operator() function is required by our
 		//        library, and indicates to the compiler that
 		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, typename TC>
-		auto zipWith(FN const& F, std::array<TA, LEN> const& A,
-			std::array<TB, LEN> const& B,
-			std::array<TC, LEN> const& C) const
-			-> std::array<decltype(F(A[0], B[0], C[0])), LEN> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+		template<typename... TS>
+		auto zip(std::array<TS, LEN> const&... IN) const
+			-> std::array<std::tuple<TS...>, LEN>{
 #pragma HLS INLINE
-			return prepend(F(A[0], B[0], C[0]),
-				XipHelper<LEN-1>().zipWith(F, tail(A), tail(B),
-							tail(C)));
+			return expand(MakeTuple(), IN...);
 		}
 
 		// FUNCTION :
-		//        zipWith
+		//        unzip
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Implements the unzip function on an array of
+		//        tuples using one pack expansion over the
+		//        positions in the tuple, and one over the
+		//        index_sequence 0, 1, ... LEN-1
 		// 
 		// PARAMETERS :
-        	//        FN : class (Inferred)
-        	//            Typename of a class-wrapped function. 
-		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
+		//        TS : typename... (Inferred)
+		//            Types of the elements of each tuple
 		//
-		//        TC : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            third argument
-		//
-		//        TD : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            fourth argument
-		//
-		// ARGUMENTS : 
-		//        F : FN const&
-		//            Instantiation of the class-wrapped
-		//            function used to compute an output value
-		//            at each array index
-		//
-		//        A : std::array<TA, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<TB, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
-		// 
-		//        C : std::array<TC, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the third argument to F's 
-		//            operator() function
-		// 
-		//        D : std::array<TD, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the fourth argument to F's 
-		//            operator() function
+		// ARGUMENTS :
+		//        IN : std::array<std::tuple<TS...>, LEN> const&
+		//            Input array of tuples whose elements will
+		//            be split and returned at corresponding
+		//            positions in the output arrays
 		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0])), LEN>
-		//        An array where the output at each location
-		//        is the result of F's operator() function applied to
-		//        values at corresponding locations in the
-		//        input arrays
+		// RETURNS : std::tuple<std::array<TS, LEN>...>
+		//        A tuple of arrays, where array K holds
+		//        element K of every tuple in the input array
 		//
 		// NOTES :
 		//        The trailing const declaration on the
 		//        operator() function is required by our
 		//        library, and indicates to the compiler that
 		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, typename TC,
-			 typename TD>
-		auto zipWith(FN const& F, std::array<TA, LEN> const& A,
-			std::array<TB, LEN> const& B,
-			std::array<TC, LEN> const& C,
-			std::array<TD, LEN> const& D) const
-			-> std::array<decltype(F(A[0], B[0], C[0], D[0])), LEN> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
+		template<typename... TS>
+		auto unzip(std::array<std::tuple<TS...>, LEN> const& IN) const
+			-> std::tuple<std::array<TS, LEN>...>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			return prepend(F(A[0], B[0], C[0], D[0]),
-				XipHelper<LEN-1>().zipWith(F, tail(A), tail(B),
-							tail(C), tail(D)));
+			return unzip(IN, make_index_sequence<sizeof...(TS)>(),
+				make_index_sequence<LEN>());
 		}
 
 		// FUNCTION :
 		//        zipWith
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function with C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Implements the zipWith function on any number
+		//        of input arrays using a single pack expansion
+		//        of the index_sequence 0, 1, ... LEN-1
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
         	//            Typename of a class-wrapped function. 
 		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
-		//
-		//        TC : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            third argument
-		//
-		//        TD : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            fourth argument
-		//
-		//        TE : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            fifth argument
+		//        TS : typename... (Inferred)
+		//            Types of the the std::array values in
+		//            each input array
 		//
 		// ARGUMENTS : 
 		//        F : FN const&
@@ -449,32 +331,12 @@ namespace hops{
 		//            function used to compute an output value
 		//            at each array index
 		//
-		//        A : std::array<TA, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<TB, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
-		// 
-		//        C : std::array<TC, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the third argument to F's 
-		//            operator() function
-		// 
-		//        D : std::array<TD, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the fourth argument to F's 
-		//            operator() function
-		// 
-		//        E : std::array<TE, LEN> const&
-		//            Input array whose elements will be
-		//            passed as the fifth argument to F's 
-		//            operator() function
+		//        IN : std::array<TS, LEN> const&...
+		//            Input arrays whose elements will be
+		//            passed, in order, as the arguments to
+		//            F's operator() function
 		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), LEN>
+		// RETURNS : std::array<decltype(F(IN[0]...)), LEN>
 		//        An array where the output at each location
 		//        is the result of F's operator() function applied to
 		//        values at corresponding locations in the
@@ -485,62 +347,19 @@ namespace hops{
 		//        operator() function is required by our
 		//        library, and indicates to the compiler that
 		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, typename TC,
-			 typename TD, typename TE>
-		auto zipWith(FN const& F, std::array<TA, LEN> const& A,
-			std::array<TB, LEN> const& B,
-			std::array<TC, LEN> const& C,
-			std::array<TD, LEN> const& D,
-			std::array<TE, LEN> const& E) const
-			-> std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), LEN> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=E._M_instance
+		template<class FN, typename... TS>
+		auto zipWith(FN const& F, std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(IN[0]...)), LEN> {
 #pragma HLS INLINE
-			return prepend(F(A[0], B[0], C[0], D[0], E[0]),
-				XipHelper<LEN-1>().zipWith(F, tail(A), tail(B),
-							tail(C), tail(D), tail(E)));
+			return expand(F, IN...);
 		}
-	};
 
-	// MODULE :
-	//        struct XipHelper
-	// 
-	// DESCRIPTION :
-	//        Base-case implementation of XipHelper for a
-	//        loop-like structure using C++ Template
-	//        Meta-Programming and Partial Template
-	//        Specialization.
-	// 
-	// FUNCTIONS :
-	//        auto zip(std::array<TL, 0> const&,
-	//                 std::array<TR, 0> const&) const
-	//        auto unzip(std::array<pair<TL, TR>, 0> const&) const
-	//        auto zipWith(std::array<TL, 0> const&,
-	//                     std::array<TR, 0> const&) const
-	//        auto zipWith(std::array<TL, 0> const&,
-	//                     std::array<TR, 0> const&,
-	//                     std::array<TR, 0> const&) const
-	//        auto zipWith(std::array<TL, 0> const&,
-	//                     std::array<TR, 0> const&,
-	//                     std::array<TR, 0> const&,
-	//                     std::array<TR, 0> const&) const
-	//        auto zipWith(std::array<TL, 0> const&,
-	//                     std::array<TR, 0> const&,
-	//                     std::array<TR, 0> const&,
-	//                     std::array<TR, 0> const&,
-	//                     std::array<TR, 0> const&) const
-	template <>
-	struct XipHelper<0>{
 		// FUNCTION :
 		//        zip
 		// 
 		// DESCRIPTION :
-		//        Base-case definition of the recursive
-		//        implementation of the zip function using C++
-		//        Template Metaprogramming 
+		//        Pairs the elements at every index in the
+		//        index_sequence argument
 		// 
 		// PARAMETERS :
 		//        TL : typename (Inferred)
@@ -551,44 +370,47 @@ namespace hops{
 		//            Type of the the std::array values in the
 		//            second argument
 		//
+		//        IDX : std::size_t... (Inferred)
+		//            The indicies of the input arrays
+		//
 		// ARGUMENTS :
-		//        L : std::array<TL, 0> const&
+		//        L : std::array<TL, LEN> const&
 		//            Input array whose elements will be in
 		//            the first position in the returned array
 		//            of pairs.
 		// 
-		//        R : std::array<TR, 0> const&
+		//        R : std::array<TR, LEN> const&
 		//            Input array whose elements will be in
 		//            the second position in the returned
 		//            array of pairs.
 		// 
-		// RETURNS : std::array<std::pair<TL, TR>, 0 >
-		//        A zero-length array of pairs, typed to make
-		//        the compiler happy
+		//        SEQ : index_sequence<IDX...>
+		//            Unused, except to deduce IDX
 		//
-		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<typename TL, typename TR>
-		auto zip(std::array<TL, 0> const& L, std::array<TR, 0> const& R) const
-			-> std::array<std::pair<TL, TR>, 0>{
+		// RETURNS : std::array<std::pair<TL, TR>, LEN > 
+		//        An array of pairs, where the first and
+		//        second elements of each pair correspond to
+		//        the elements at that location in the first
+		//        and second array arguments
+		template<typename TL, typename TR, std::size_t... IDX>
+		auto zip(std::array<TL, LEN> const& L, std::array<TR, LEN> const& R,
+			index_sequence<IDX...> SEQ) const
+			-> std::array<std::pair<TL, TR>, LEN >{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=L._M_instance
 #pragma HLS ARRAY_PARTITION complete VARIABLE=R._M_instance
 #pragma HLS INLINE
-			std::array<std::pair<TL, TR>, 0> nil;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=nil._M_instance
-			return nil;
+			std::array<std::pair<TL, TR>, LEN> res =
+				{{std::pair<TL, TR>(L[IDX], R[IDX])...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=res._M_instance
+			return res;
 		}
 
 		// FUNCTION :
 		//        unzip
 		// 
 		// DESCRIPTION :
-		//        Base-case definition of the recursive
-		//        implementation of the unzip function using C++
-		//        Template Metaprogramming 
+		//        Splits the pairs at every index in the
+		//        index_sequence argument
 		// 
 		// PARAMETERS :
 		//        TL : typename (Inferred)
@@ -599,281 +421,209 @@ namespace hops{
 		//            Type of the the element in the second
 		//            position of each pair
 		//
+		//        IDX : std::size_t... (Inferred)
+		//            The indicies of the input array
+		//
 		// ARGUMENTS :
-		//        IN : std::array<std::pair<TL, TR>, 0> const&
-		//            Empty input array of pairs whose
-		//            elements will be split and returned at
-		//            corresponding positions in the output
-		//            arrays
-		// 
-		// RETURNS : std::pair<std::array<TL, 0>,
-		//                     std::array<TR, 0> >
-		//        A pair of empty arrays where the elements of
-		//        the first and second arrays are the elements
-		//        at the first and second position at the
-		//        corresponding position of the input array
+		//        IN : std::array<std::pair<TL, TR>, LEN> const&
+		//            Input array of pairs whose elements will
+		//            be split and returned at corresponding
+		//            positions in the output arrays
+		// 
+		//        SEQ : index_sequence<IDX...>
+		//            Unused, except to deduce IDX
 		//
-		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<typename TL, typename TR>
-		auto unzip(std::array<std::pair<TL, TR>, 0> const& IN) const
-			-> std::pair<std::array<TL, 0>, std::array<TR, 0> >{
+		// RETURNS : std::pair<std::array<TL, LEN>,
+		//                     std::array<TR, LEN> >
+		//        A pair of arrays where the elements of the
+		//        first and second arrays are the elements at
+		//        the first and second position at the 
+		//        corresponding position of the input array
+		template<typename TL, typename TR, std::size_t... IDX>
+		auto unzip(std::array<std::pair<TL, TR>, LEN> const& IN,
+			index_sequence<IDX...> SEQ) const
+			-> std::pair<std::array<TL, LEN>, std::array<TR, LEN> >{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			std::array<TL, 0> lnil;
-			std::array<TR, 0> rnil;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=lnil._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=rnil._M_instance
-			return {lnil, rnil};
+			std::array<TL, LEN> l = {{IN[IDX].first...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=l._M_instance
+			std::array<TR, LEN> r = {{IN[IDX].second...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=r._M_instance
+			return {l, r};
 		}
 
 		// FUNCTION :
-		//        zipWith
+		//        unzip
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function using C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Splits the tuples at every index in the
+		//        second index_sequence argument into one array
+		//        per position in the first
 		// 
 		// PARAMETERS :
-        	//        FN : class (Inferred)
-        	//            Typename of a class-wrapped function. 
-		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
+		//        TS : typename... (Inferred)
+		//            Types of the elements of each tuple
 		//
-		// ARGUMENTS : 
-		//        F : class FN
-		//            Instantiation of the class-wrapped
-		//            function used to compute an output value
-		//            at each array index
+		//        POS : std::size_t... (Inferred)
+		//            The positions in each tuple
 		//
-		//        A : std::array<T, 0> const&
-		//            Nill array with Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<T, 0> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's
-		//            operator() function
-		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0])), 0>
-		//        A zero-length (nil) array with the element
-		//        type determined by applying F's operator()
-		//        function to hypothetical values at A[0] and
-		//        B[0]
+		//        IDX : std::size_t... (Inferred)
+		//            The indicies of the input array
 		//
-		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB>
-		auto zipWith(FN const& F,
-			std::array<TA, 0> const& A,
-			std::array<TB, 0> const& B)
-			-> std::array<decltype(F(A[0], B[0])), 0> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+		// ARGUMENTS :
+		//        IN : std::array<std::tuple<TS...>, LEN> const&
+		//            Input array of tuples
+		// 
+		//        PSEQ : index_sequence<POS...>
+		//            Unused, except to deduce POS
+		//
+		//        SEQ : index_sequence<IDX...>
+		//            Passed to column
+		//
+		// RETURNS : std::tuple<std::array<TS, LEN>...>
+		//        A tuple of arrays, where array K holds
+		//        element K of every tuple in the input array
+		template<typename... TS, std::size_t... POS, std::size_t... IDX>
+		auto unzip(std::array<std::tuple<TS...>, LEN> const& IN,
+			index_sequence<POS...> PSEQ,
+			index_sequence<IDX...> SEQ) const
+			-> std::tuple<std::array<TS, LEN>...>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
 #pragma HLS INLINE
-			std::array<decltype(F(A[0], B[0])), 0> nil;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=nil._M_instance
-			return nil;
-		}	  
+			return std::tuple<std::array<TS, LEN>...>(column<POS>(IN, SEQ)...);
+		}
 
 		// FUNCTION :
-		//        zipWith
+		//        column
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function using C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Returns element POS of the tuple at every index
+		//        in the index_sequence argument
 		// 
 		// PARAMETERS :
-        	//        FN : class (Inferred)
-        	//            Typename of a class-wrapped function. 
-		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
+		//        POS : std::size_t
+		//            The position in each tuple
 		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
-		//
-		//        TC : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            third argument
-		//
-		// ARGUMENTS : 
-		//        F : FN const&
-		//            Instantiation of the class-wrapped
-		//            function used to compute an output value
-		//            at each array index
+		//        TS : typename... (Inferred)
+		//            Types of the elements of each tuple
 		//
-		//        A : std::array<TA, 0> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<TB, 0> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
-		// 
-		//        C : std::array<TC, 0> const&
-		//            Input array whose elements will be
-		//            passed as the third argument to F's 
-		//            operator() function
-		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0])), 0>
-		//        A zero-length (nil) array with the element
-		//        type determined by applying F's operator()
-		//        function to hypothetical values at A[0], 
-		//        B[0], and C[0]
+		//        IDX : std::size_t... (Inferred)
+		//            The indicies of the input array
 		//
-		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, typename TC>
-		auto zipWith(FN const& F,
-			std::array<TA, 0> const& A,
-			std::array<TB, 0> const& B,
-			std::array<TC, 0> const& C)
-			-> std::array<decltype(F(A[0], B[0], C[0])), 0> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+		// ARGUMENTS :
+		//        IN : std::array<std::tuple<TS...>, LEN> const&
+		//            Input array of tuples
+		// 
+		//        SEQ : index_sequence<IDX...>
+		//            Unused, except to deduce IDX
+		//
+		// RETURNS : std::array<T, LEN>
+		//        Where T is the type of element POS of the
+		//        tuples
+		template<std::size_t POS, typename... TS, std::size_t... IDX>
+		static auto column(std::array<std::tuple<TS...>, LEN> const& IN,
+				index_sequence<IDX...> SEQ)
+			-> std::array<typename std::tuple_element<POS, std::tuple<TS...> >::type, LEN>{
 #pragma HLS INLINE
-			std::array<decltype(F(A[0], B[0], C[0])), 0> nil;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=nil._M_instance
-			return nil;
+			std::array<typename std::tuple_element<POS, std::tuple<TS...> >::type, LEN> res =
+				{{std::get<POS>(IN[IDX])...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=res._M_instance
+			return res;
 		}
 
 		// FUNCTION :
-		//        zipWith
+		//        at
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function using C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Applies F to the elements at index IDX of
+		//        every input array
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
         	//            Typename of a class-wrapped function. 
 		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
-		//
-		//        TC : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            third argument
-		//
-		//        TD : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            fourth argument
+		//        TS : typename... (Inferred)
+		//            Types of the the std::array values in
+		//            each input array
 		//
 		// ARGUMENTS : 
 		//        F : FN const&
 		//            Instantiation of the class-wrapped
-		//            function used to compute an output value
-		//            at each array index
+		//            function
 		//
-		//        A : std::array<TA, 0> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<TB, 0> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
-		// 
-		//        C : std::array<TC, 0> const&
-		//            Input array whose elements will be
-		//            passed as the third argument to F's 
-		//            operator() function
-		// 
-		//        D : std::array<TD, 0> const&
-		//            Input array whose elements will be
-		//            passed as the fourth argument to F's 
-		//            operator() function
-		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0])), 0>
-		//        A zero-length (nil) array with the element
-		//        type determined by applying F's operator()
-		//        function to hypothetical values at A[0], 
-		//        B[0], C[0], and D[0]
+		//        IDX : std::size_t
+		//            The index of the input arrays
+		//
+		//        IN : std::array<TS, LEN> const&...
+		//            Input arrays whose elements at index
+		//            IDX are passed, in order, to F
+		//
+		// RETURNS : decltype(F(IN[0]...))
+		//        The result of F
 		//
 		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, typename TC, typename TD>
-		auto zipWith(FN const& F,
-			std::array<TA, 0> const& A,
-			std::array<TB, 0> const& B,
-			std::array<TC, 0> const& C,
-			std::array<TD, 0> const& D)
-			-> std::array<decltype(F(A[0], B[0], C[0], D[0])), 0> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
+		//        IDX is a function argument, not a template
+		//        parameter, so that at is instantiated once
+		//        instead of once per index. IDX is a constant
+		//        after inlining.
+		template<class FN, typename... TS>
+		static auto at(FN const& F, std::size_t IDX,
+			std::array<TS, LEN> const&... IN)
+			-> decltype(F(IN[0]...)) {
 #pragma HLS INLINE
-			std::array<decltype(F(A[0], B[0], C[0], D[0])), 0> nil;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=nil._M_instance
-			return nil;
+			return F(IN[IDX]...);
 		}
 
 		// FUNCTION :
-		//        zipWith
+		//        expand
 		// 
 		// DESCRIPTION :
-		//        Implements the zipWith function using C++
-		//        Template Metaprogramming using the recursive
-		//        structure defined by XipHelper
+		//        Applies F at every index of the input arrays,
+		//        selecting the implementation for the array
+		//        length: a braced initializer over every index
+		//        (std::false_type), or BlockExpandHelper for long
+		//        arrays (std::true_type)
+		template<class FN, typename... TS>
+		auto expand(FN const& F, std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(IN[0]...)), LEN> {
+#pragma HLS INLINE
+			return expand(F, BlockExpandHelper<LEN>(), IN...);
+		}
+
+		template<class FN, typename... TS>
+		auto expand(FN const& F, std::false_type BLOCKED,
+			std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(IN[0]...)), LEN> {
+#pragma HLS INLINE
+			return expand(F, make_index_sequence<LEN>(), IN...);
+		}
+
+		template<class FN, typename... TS>
+		auto expand(FN const& F, std::true_type BLOCKED,
+			std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(IN[0]...)), LEN> {
+#pragma HLS INLINE
+			return BlockExpandHelper<LEN>::expand(F, IN...);
+		}
+
+		// FUNCTION :
+		//        expand
+		// 
+		// DESCRIPTION :
+		//        Implements the zipWith function on any
+		//        number of input arrays by applying F at every
+		//        index in the index_sequence argument
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
         	//            Typename of a class-wrapped function. 
 		//
-		//        TA : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            first argument
-		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
+		//        IDX : std::size_t... (Inferred)
+		//            The indicies of the input arrays
 		//
-		//        TC : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            third argument
-		//
-		//        TD : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            fourth argument
-		//
-		//        TE : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            fifth argument
+		//        TS : typename... (Inferred)
+		//            Types of the the std::array values in
+		//            each input array
 		//
 		// ARGUMENTS : 
 		//        F : FN const&
@@ -881,59 +631,28 @@ namespace hops{
 		//            function used to compute an output value
 		//            at each array index
 		//
-		//        A : std::array<TA, 0> const&
-		//            Input array whose elements will be
-		//            passed as the first argument to F's
-		//            operator() function
-		// 
-		//        B : std::array<TB, 0> const&
-		//            Input array whose elements will be
-		//            passed as the second argument to F's 
-		//            operator() function
-		// 
-		//        C : std::array<TC, 0> const&
-		//            Input array whose elements will be
-		//            passed as the third argument to F's 
-		//            operator() function
-		// 
-		//        D : std::array<TD, 0> const&
-		//            Input array whose elements will be
-		//            passed as the fourth argument to F's 
-		//            operator() function
-		// 
-		//        E : std::array<TE, 0> const&
-		//            Input array whose elements will be
-		//            passed as the fifth argument to F's 
-		//            operator() function
-		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), 0>
-		//        A zero-length (nil) array with the element
-		//        type determined by applying F's operator()
-		//        function to hypothetical values at A[0], 
-		//        B[0], C[0], D[0], and E[0]
+		//        SEQ : index_sequence<IDX...>
+		//            Unused, except to deduce IDX
 		//
-		// NOTES :
-		//        The trailing const declaration on the
-		//        operator() function is required by our
-		//        library, and indicates to the compiler that
-		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, typename TC, typename TD, typename TE>
-		auto zipWith(FN const& F,
-			std::array<TA, 0> const& A,
-			std::array<TB, 0> const& B,
-			std::array<TC, 0> const& C,
-			std::array<TD, 0> const& D,
-			std::array<TE, 0> const& E)
-			-> std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), 0> {
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=E._M_instance
+		//        IN : std::array<TS, LEN> const&...
+		//            Input arrays whose elements will be
+		//            passed, in order, as the arguments to
+		//            F's operator() function
+		// 
+		// RETURNS : std::array<decltype(F(IN[0]...)), LEN>
+		//        An array where the output at each location
+		//        is the result of F's operator() function applied to
+		//        values at corresponding locations in the
+		//        input arrays
+		template<class FN, std::size_t... IDX, typename... TS>
+		auto expand(FN const& F, index_sequence<IDX...> SEQ,
+			std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(IN[0]...)), LEN> {
 #pragma HLS INLINE
-			std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), 0> nil;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=nil._M_instance
-			return nil;
+			std::array<decltype(F(IN[0]...)), LEN> res =
+				{{at(F, IDX, IN...)...}};
+#pragma HLS ARRAY_PARTITION complete VARIABLE=res._M_instance
+			return res;
 		}
 	};
 
@@ -949,6 +668,12 @@ namespace hops{
 	//        std::array<std::pair<TL, TR>, LEN >
 	//            operator()(std::array<TL, LEN> const&,
 	//                       std::array<TR, LEN> const&)
+	//        std::array<std::tuple<TA, TB, TC, TS...>, LEN >
+	//            operator()(std::array<TA, LEN> const&,
+	//                       std::array<TB, LEN> const&,
+	//                       std::array<TC, LEN> const&,
+	//                       std::array<TS, LEN> const&...) const
+	//        auto operator()(P const&, AS const&...) const
 	//
 	// NOTES :
 	//        A corresponding loop-based implementation is defined
@@ -1005,6 +730,28 @@ namespace hops{
 #pragma HLS INLINE
 			return XipHelper<LEN>().zip(L, R);
 		}
+
+		template<typename TA, typename TB, typename TC, std::size_t LEN,
+			 typename... TS>
+		auto operator()(std::array<TA, LEN> const& A,
+				std::array<TB, LEN> const& B,
+				std::array<TC, LEN> const& C,
+				std::array<TS, LEN> const&... IN) const
+			-> std::array<std::tuple<TA, TB, TC, TS...>, LEN >{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+#pragma HLS INLINE
+			return XipHelper<LEN>().zip(A, B, C, IN...);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.zip(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.zip(ARGS...);
+		}
 	};
 
 	// MODULE :
@@ -1016,32 +763,31 @@ namespace hops{
 	//        function to provide a function-like API.
 	// 
 	// FUNCTIONS :
-	//        auto operator()(std::array<TA, LEN> const&,
-	//                        std::array<TB, LEN> const&) const
-	//        auto operator()(std::array<TA, LEN> const&,
-	//                        std::array<TB, LEN> const&,
-	//                        std::array<TC, LEN> const&) const
-	//        auto operator()(std::array<TA, LEN> const&,
-	//                        std::array<TB, LEN> const&,
-	//                        std::array<TC, LEN> const&,
-	//                        std::array<TD, LEN> const&) const
-	//        auto operator()(std::array<TA, LEN> const&,
-	//                        std::array<TB, LEN> const&,
-	//                        std::array<TC, LEN> const&,
-	//                        std::array<TD, LEN> const&,
-	//                        std::array<TE, LEN> const&) const
+	//        auto operator()(FN const&, std::array<TA, LEN> const&,
+	//                        std::array<TS, LEN> const&...) const
+	//        auto operator()(E const&, ES const&...) const
+	//        auto operator()(std::array<TA, LEN> const&, ES const&...) const
+	//        auto operator()(P const&, AS const&...) const
 	//
 	// NOTES :
 	//        A corresponding loop-based implementation is defined
 	//        in the hops::loop namespace
+	//
+	//        When the first input is a lazy expression or view (see
+	//        lazy.hpp and view.hpp) the result is a lazy expression,
+	//        evaluated when it is assigned to a std::array or
+	//        reduced. The remaining inputs may be std::arrays or
+	//        lazy expressions. When the first input is a std::array
+	//        the other inputs are evaluated, and the result is a
+	//        std::array.
 	struct ZipWith{
 		// FUNCTION :
 		//        operator()
 		// 
 		// DESCRIPTION :
 		//        Provides a function-like interface to the
-		//        linear recurisve structure defined by the
-		//        zipWith function of XipHelper
+		//        zipWith function of XipHelper, for any number of
+		//        input arrays
 		// 
 		// PARAMETERS :
         	//        FN : class (Inferred)
@@ -1051,30 +797,30 @@ namespace hops{
 		//            Type of the the std::array values in the
 		//            first argument
 		//
-		//        TB : typename (Inferred)
-		//            Type of the the std::array values in the
-		//            second argument
-		//
         	//        LEN : std::size_t (Inferred)
         	//            Length of the std::array input arguments
 		//
+		//        TS : typename... (Inferred)
+		//            Types of the the std::array values in the
+		//            remaining arguments
+		//
 		// ARGUMENTS : 
 		//        F : FN const&
 		//            Instantiation of the class-wrapped
 		//            function used to compute an output value
 		//            at each array index
 		//
-		//        A : std::array<T, 0> const&
-		//            Nil array with Input array whose
-		//            elements will be passed as the first
-		//            argument to F's operator() function
-		// 
-		//        B : std::array<T, 0> const&
+		//        A : std::array<TA, LEN> const&
 		//            Input array whose elements will be
-		//            passed as the second argument to F's 
+		//            passed as the first argument to F's
 		//            operator() function
 		// 
-		// RETURNS : std::array<decltype(F(A[0], B[0])), LEN>
+		//        IN : std::array<TS, LEN> const&...
+		//            Input arrays whose elements will be
+		//            passed, in order, as the remaining
+		//            arguments to F's operator() function
+		// 
+		// RETURNS : std::array<decltype(F(A[0], IN[0]...)), LEN>
 		//        An array where the output at each location
 		//        is the result of F's operator() function applied to
 		//        values at corresponding locations in the
@@ -1085,61 +831,39 @@ namespace hops{
 		//        operator() function is required by our
 		//        library, and indicates to the compiler that
 		//        the method modifies no internal state
-		template<class FN, typename TA, typename TB, std::size_t LEN>
+		template<class FN, typename TA, std::size_t LEN, typename... TS>
 		auto operator()(FN const& F,
 				std::array<TA, LEN> const& A,
-				std::array<TB, LEN> const& B) const
-			-> std::array<decltype(F(A[0], B[0])), LEN>{
+				std::array<TS, LEN> const&... IN) const
+			-> std::array<decltype(F(A[0], IN[0]...)), LEN>{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
 #pragma HLS INLINE
-			return XipHelper<LEN>().zipWith(F, A, B);
+			return XipHelper<LEN>().zipWith(F, A, IN...);
 		}
 
-		template<class FN, typename TA, typename TB, typename TC,
-			 std::size_t LEN>
-		auto operator()(FN const& F,
-				std::array<TA, LEN> const& A,
-				std::array<TB, LEN> const& B,
-				std::array<TC, LEN> const& C) const
-			-> std::array<decltype(F(A[0], B[0], C[0])), LEN>{
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+		template<class FN, class E, class... ES>
+		auto operator()(FN const& F, E const& A, ES const&... IN) const
+			-> decltype(A.zipWith(F, IN...)){
 #pragma HLS INLINE
-			return XipHelper<LEN>().zipWith(F, A, B, C);
+			return A.zipWith(F, IN...);
 		}
-		template<class FN, typename TA, typename TB, typename TC,
-			 typename TD, std::size_t LEN>
-		auto operator()(FN const& F,
-				std::array<TA, LEN> const& A,
-				std::array<TB, LEN> const& B,
-				std::array<TC, LEN> const& C,
-				std::array<TD, LEN> const& D) const
-			-> std::array<decltype(F(A[0], B[0], C[0], D[0])), LEN>{
+
+		template<class FN, typename TA, std::size_t LEN, class... ES>
+		auto operator()(FN const& F, std::array<TA, LEN> const& A,
+				ES const&... IN) const
+			-> typename std::enable_if<AnyLazy<ES...>::value,
+				decltype(XipHelper<LEN>().zipWith(F, A, evaluate(IN)...))>::type{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
 #pragma HLS INLINE
-			return XipHelper<LEN>().zipWith(F, A, B, C, D);
+			return XipHelper<LEN>().zipWith(F, A, evaluate(IN)...);
 		}
-		template<class FN, typename TA, typename TB, typename TC,
-			 typename TD, typename TE, std::size_t LEN>
-		auto operator()(FN const& F,
-				std::array<TA, LEN> const& A,
-				std::array<TB, LEN> const& B,
-				std::array<TC, LEN> const& C,
-				std::array<TD, LEN> const& D,
-				std::array<TE, LEN> const& E)
-			-> std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), LEN>{
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=E._M_instance
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.zipWith(ARGS...))>::type{
 #pragma HLS INLINE
-			return XipHelper<LEN>().zipWith(F, A, B, C, D, E);
+			return POLICY.zipWith(ARGS...);
 		}
 	};
 
@@ -1155,6 +879,9 @@ namespace hops{
 	// FUNCTIONS :
 	//        std::pair<std::array<TL, LEN>, std::array<TR, LEN> >
 	//            operator()(std::array<std::pair<TL, TR>, LEN> const&) const
+	//        std::tuple<std::array<TS, LEN>...>
+	//            operator()(std::array<std::tuple<TS...>, LEN> const&) const
+	//        auto operator()(P const&, AS const&...) const
 	//
 	// NOTES :
 	//        A corresponding loop-based implementation is defined
@@ -1208,6 +935,22 @@ namespace hops{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=temp.second._M_instance
 			return temp;
 		}
+
+		template<typename... TS, std::size_t LEN>
+		auto operator()(std::array<std::tuple<TS...>, LEN> const& IN) const
+			-> std::tuple<std::array<TS, LEN>...>{
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+			return XipHelper<LEN>().unzip(IN);
+		}
+
+		template <class P, class... AS>
+		auto operator()(P const& POLICY, AS const&... ARGS) const
+			-> typename std::enable_if<IsPolicy<P>::value,
+				decltype(POLICY.unzip(ARGS...))>::type{
+#pragma HLS INLINE
+			return POLICY.unzip(ARGS...);
+		}
 	};
 
 	// VARIABLE :
@@ -1221,6 +964,7 @@ namespace hops{
 	//
 	//            std::array<int, 2> a = {1, 2}, b = {3, 4};
 	//            zip(a, b); // {{1, 3}, {2, 4}}
+	//            zip(a, b, a); // {(1, 3, 1), (2, 4, 2)} as std::tuple
 	//        
 	// NOTES :
 	//        A corresponding loop-based implementation is defined
@@ -1275,6 +1019,8 @@ namespace hops{
 		// FUNCTIONS :
 		//        std::pair<std::array<TL, LEN>, std::array<TR, LEN> >
 		//            operator()(std::array<std::pair<TL, TR>, LEN> const&) const
+		//        std::tuple<std::array<TS, LEN>...>
+		//            operator()(std::array<std::tuple<TS...>, LEN> const&) const
 		//
 		// NOTES :
 		//        A corresponding loop-based implementation is defined
@@ -1333,6 +1079,32 @@ namespace hops{
 				}
 				return {left, right};
 			}
+
+			template <typename... TS, std::size_t LEN>
+			auto operator()(std::array<std::tuple<TS...>, LEN> const& IN) const
+				-> std::tuple<std::array<TS, LEN>...> {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=IN._M_instance
+#pragma HLS INLINE
+				std::tuple<std::array<TS, LEN>...> temp;
+			unzip_loop:
+				for(int i = 0; i < LEN; ++i){
+#pragma HLS UNROLL
+					assign(temp, IN[i], i, make_index_sequence<sizeof...(TS)>());
+				}
+				return temp;
+			}
+
+		private:
+			// Writes element POS of T to index IDX of array POS
+			// in OUT, for every POS
+			template <typename... TS, std::size_t LEN, std::size_t... POS>
+			static void assign(std::tuple<std::array<TS, LEN>...>& OUT,
+					std::tuple<TS...> const& T, std::size_t IDX,
+					index_sequence<POS...> PSEQ){
+#pragma HLS INLINE
+				int unused[] = {0, (std::get<POS>(OUT)[IDX] = std::get<POS>(T), 0)...};
+				(void)unused;
+			}
 		};
 
 		// MODULE :
@@ -1346,6 +1118,11 @@ namespace hops{
 		//        std::array<std::pair<TL, TR>, LEN >
 		//            operator()(std::array<TL, LEN> const&,
 		//                       std::array<TR, LEN> const&) const
+		//        std::array<std::tuple<TA, TB, TC, TS...>, LEN >
+		//            operator()(std::array<TA, LEN> const&,
+		//                       std::array<TB, LEN> const&,
+		//                       std::array<TC, LEN> const&,
+		//                       std::array<TS, LEN> const&...) const
 		//
 		// NOTES :
 		//        A corresponding loop-based implementation is defined
@@ -1412,6 +1189,27 @@ namespace hops{
 				}
 				return temp;
 			}
+
+			template <typename TA, typename TB, typename TC, std::size_t LEN,
+				  typename... TS>
+			auto operator()(std::array<TA, LEN> const& A,
+					std::array<TB, LEN> const& B,
+					std::array<TC, LEN> const& C,
+					std::array<TS, LEN> const&... IN) const
+				-> std::array<std::tuple<TA, TB, TC, TS...>, LEN> {
+#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
+#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
+#pragma HLS INLINE
+				std::array<std::tuple<TA, TB, TC, TS...>, LEN> temp;
+#pragma HLS ARRAY_PARTITION complete VARIABLE=temp._M_instance
+			zip_loop:
+				for(int i = 0; i < LEN; ++i){
+#pragma HLS UNROLL
+					temp[i] = std::tuple<TA, TB, TC, TS...>(A[i], B[i], C[i], IN[i]...);
+				}
+				return temp;
+			}
 		};
 
 
@@ -1423,8 +1221,8 @@ namespace hops{
 		//        implementation of the zipWith function
 		// 
 		// FUNCTIONS :
-		//        auto operator()(std::array<TL, LEN> const&,
-		//                        std::array<TR, LEN> const&) const
+		//        auto operator()(FN const&, std::array<TA, LEN> const&,
+		//                        std::array<TS, LEN> const&...) const
 		//
 		// NOTES :
 		//        A corresponding loop-based implementation is defined
@@ -1434,76 +1232,9 @@ namespace hops{
 			//        operator()
 			// 
 			// DESCRIPTION :
-			//        Implements the zipWith function using an
-			//        unrolled for-loop 
-			// 
-			// PARAMETERS :
-			//        FN : class (Inferred)
-			//            Typename of a class-wrapped function. 
-			//
-			//        TA : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            first argument
-			//
-			//        TB : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            second argument
-			//
-			//        LEN : std::size_t (Inferred)
-			//            Length of the std::array input arguments
-			//
-			// ARGUMENTS : 
-			//        F : FN const&
-			//            Instantiation of the class-wrapped
-			//            function used to compute an output value
-			//            at each array index
-			//
-			//        A : std::array<T, LEN> const&
-			//            Nil array with Input array
-			//            whose elements will be passed as
-			//            the first argument to F's
-			//            operator() function
-			// 
-			//        B : std::array<T, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the second argument to F's
-			//            operator() function
-			// 
-			// RETURNS : std::array<decltype(F(A[0], B[0])), LEN>
-			//        An array where the output at each location
-			//        is the result of F's operator() function applied to
-			//        values at corresponding locations in the
-			//        input arrays
-			//
-			// NOTES :
-			//        The trailing const declaration on the
-			//        operator() function is required by our
-			//        library, and indicates to the compiler that
-			//        the method modifies no internal state
-			template <class FN, typename TA, typename TB, std::size_t LEN>
-			auto operator()(FN const& F,
-					std::array<TA, LEN> const& A,
-					std::array<TB, LEN> const& B) const
-				-> std::array<decltype(F(A[0], B[0])), LEN>{
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS INLINE
-				std::array<decltype(F(A[0], B[0])), LEN> temp;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=temp._M_instance
-			zip_loop:
-				for(int i = 0; i < LEN; ++i){
-#pragma HLS UNROLL
-					temp[i] = F(A[i], B[i]);
-				}
-				return temp;
-			}
-
-			// FUNCTION :
-			//        operator()
-			// 
-			// DESCRIPTION :
-			//        Provides a function-like interface to the
-			//        loop::ZipWith class
+			//        Implements the zipWith function on any
+			//        number of input arrays using an unrolled
+			//        for-loop
 			// 
 			// PARAMETERS :
 			//        FN : class (Inferred)
@@ -1513,193 +1244,12 @@ namespace hops{
 			//            Type of the the std::array values in the
 			//            first argument
 			//
-			//        TB : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            second argument
-			//
-			//        TC : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            third argument
-			//
 			//        LEN : std::size_t (Inferred)
 			//            Length of the std::array input arguments
 			//
-			// ARGUMENTS : 
-			//        F : FN const&
-			//            Instantiation of the class-wrapped
-			//            function used to compute an output value
-			//            at each array index
-			//
-			//        A : std::array<T, LEN> const&
-			//            Nil array with Input array whose
-			//            elements will be passed as the first
-			//            argument to F's operator() function
-			// 
-			//        B : std::array<T, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the second argument to F's 
-			//            operator() function
-			// 
-			//        C : std::array<TC, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the third argument to F's 
-			//            operator() function
-			// 
-			// RETURNS : std::array<decltype(F(A[0], B[0], C[0])), LEN>
-			//        An array where the output at each location
-			//        is the result of F's operator() function applied to
-			//        values at corresponding locations in the
-			//        input arrays
-			//
-			// NOTES :
-			//        The trailing const declaration on the
-			//        operator() function is required by our
-			//        library, and indicates to the compiler that
-			//        the method modifies no internal state
-			template <class FN, typename TA, typename TB, 
-				  typename TC, std::size_t LEN>
-			auto operator()(FN const& F,
-					std::array<TA, LEN> const& A,
-					std::array<TB, LEN> const& B,
-					std::array<TC, LEN> const& C) const
-				-> std::array<decltype(F(A[0], B[0], C[0])), LEN>{
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS INLINE
-				std::array<decltype(F(A[0], B[0], C[0])), LEN> temp;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=temp._M_instance
-			zip_loop:
-				for(int i = 0; i < LEN; ++i){
-#pragma HLS UNROLL
-					temp[i] = F(A[i], B[i], C[i]);
-				}
-				return temp;
-			}
-
-			// FUNCTION :
-			//        operator()
-			// 
-			// DESCRIPTION :
-			//        Provides a function-like interface to the
-			//        loop::ZipWith class
-			// 
-			// PARAMETERS :
-			//        FN : class (Inferred)
-			//            Typename of a class-wrapped function. 
-			//
-			//        TA : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            first argument
-			//
-			//        TB : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            second argument
-			//
-			//        TC : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            third argument
-			//
-			//        TD : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            fourth argument
-			//
-			//        LEN : std::size_t (Inferred)
-			//            Length of the std::array input arguments
-			//
-			// ARGUMENTS : 
-			//        F : FN const&
-			//            Instantiation of the class-wrapped
-			//            function used to compute an output value
-			//            at each array index
-			//
-			//        A : std::array<T, LEN> const&
-			//            Nil array with Input array whose
-			//            elements will be passed as the first
-			//            argument to F's operator() function
-			// 
-			//        B : std::array<T, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the second argument to F's 
-			//            operator() function
-			// 
-			//        C : std::array<TC, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the third argument to F's 
-			//            operator() function
-			// 
-			//        D : std::array<TD, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the fourth argument to F's 
-			//            operator() function
-			// 
-			// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0])), LEN>
-			//        An array where the output at each location
-			//        is the result of F's operator() function applied to
-			//        values at corresponding locations in the
-			//        input arrays
-			//
-			// NOTES :
-			//        The trailing const declaration on the
-			//        operator() function is required by our
-			//        library, and indicates to the compiler that
-			//        the method modifies no internal state
-			template <class FN, typename TA, typename TB,
-				  typename TC, typename TD, std::size_t LEN>
-			auto operator()(FN const& F,
-					std::array<TA, LEN> const& A,
-					std::array<TB, LEN> const& B,
-					std::array<TC, LEN> const& C,
-					std::array<TD, LEN> const& D) const
-				-> std::array<decltype(F(A[0], B[0], C[0], D[0])), LEN>{
-#pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
-#pragma HLS INLINE
-				std::array<decltype(F(A[0], B[0], C[0], D[0])), LEN> temp;
-#pragma HLS ARRAY_PARTITION complete VARIABLE=temp._M_instance
-			zip_loop:
-				for(int i = 0; i < LEN; ++i){
-#pragma HLS UNROLL
-					temp[i] = F(A[i], B[i], C[i], D[i]);
-				}
-				return temp;
-			}
-
-			// FUNCTION :
-			//        operator()
-			// 
-			// DESCRIPTION :
-			//        Provides a function-like interface to the
-			//        loop::ZipWith class
-			// 
-			// PARAMETERS :
-			//        FN : class (Inferred)
-			//            Typename of a class-wrapped function. 
-			//
-			//        TA : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            first argument
-			//
-			//        TB : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            second argument
-			//
-			//        TC : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            third argument
-			//
-			//        TD : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            fourth argument
-			//
-			//        TE : typename (Inferred)
-			//            Type of the the std::array values in the
-			//            fifth argument
-			//
-			//        LEN : std::size_t (Inferred)
-			//            Length of the std::array input arguments
+			//        TS : typename... (Inferred)
+			//            Types of the the std::array values in the
+			//            remaining arguments
 			//
 			// ARGUMENTS : 
 			//        F : FN const&
@@ -1707,32 +1257,17 @@ namespace hops{
 			//            function used to compute an output value
 			//            at each array index
 			//
-			//        A : std::array<T, LEN> const&
-			//            Nil array with Input array whose
-			//            elements will be passed as the first
-			//            argument to F's operator() function
-			// 
-			//        B : std::array<T, LEN> const&
+			//        A : std::array<TA, LEN> const&
 			//            Input array whose elements will be
-			//            passed as the second argument to F's 
+			//            passed as the first argument to F's
 			//            operator() function
 			// 
-			//        C : std::array<TC, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the third argument to F's 
-			//            operator() function
-			// 
-			//        D : std::array<TD, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the fourth argument to F's 
-			//            operator() function
-			// 
-			//        E : std::array<TE, LEN> const&
-			//            Input array whose elements will be
-			//            passed as the fifth argument to F's 
-			//            operator() function
+			//        IN : std::array<TS, LEN> const&...
+			//            Input arrays whose elements will be
+			//            passed, in order, as the remaining
+			//            arguments to F's operator() function
 			// 
-			// RETURNS : std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), LEN>
+			// RETURNS : std::array<decltype(F(A[0], IN[0]...)), LEN>
 			//        An array where the output at each location
 			//        is the result of F's operator() function applied to
 			//        values at corresponding locations in the
@@ -1743,28 +1278,19 @@ namespace hops{
 			//        operator() function is required by our
 			//        library, and indicates to the compiler that
 			//        the method modifies no internal state
-			template <class FN, typename TA, typename TB,
-				  typename TC, typename TD, typename TE,
-				  std::size_t LEN>
+			template <class FN, typename TA, std::size_t LEN, typename... TS>
 			auto operator()(FN const& F,
 					std::array<TA, LEN> const& A,
-					std::array<TB, LEN> const& B,
-					std::array<TC, LEN> const& C,
-					std::array<TD, LEN> const& D,
-					std::array<TE, LEN> const& E) const
-				-> std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), LEN>{
+					std::array<TS, LEN> const&... IN) const
+				-> std::array<decltype(F(A[0], IN[0]...)), LEN>{
 #pragma HLS ARRAY_PARTITION complete VARIABLE=A._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=B._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=C._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=D._M_instance
-#pragma HLS ARRAY_PARTITION complete VARIABLE=E._M_instance
 #pragma HLS INLINE
-				std::array<decltype(F(A[0], B[0], C[0], D[0], E[0])), LEN> temp;
+				std::array<decltype(F(A[0], IN[0]...)), LEN> temp;
 #pragma HLS ARRAY_PARTITION complete VARIABLE=temp._M_instance
 			zip_loop:
 				for(int i = 0; i < LEN; ++i){
 #pragma HLS UNROLL
-					temp[i] = F(A[i], B[i], C[i], D[i], E[i]);
+					temp[i] = F(A[i], IN[i]...);
 				}
 				return temp;
 			}
@@ -1824,5 +1350,83 @@ namespace hops{
 		//        in the hops namespace
 		Unzip unzip;
 	} // namespace loop
+
+	namespace dyn{
+		// MODULE :
+		//        struct ZipWith
+		// 
+		// DESCRIPTION :
+		//        Implements the zipWith function on runtime-length
+		//        arrays (see span.hpp) using a loop in the
+		//        operator() function to provide a function-like
+		//        API.
+		// 
+		// FUNCTIONS :
+		//        Span<TO> operator()(FN const& F, CO&& OUT, CS const&... IN) const
+		//
+		// NOTES :
+		//        F is the same function object that is passed to
+		//        hops::zipWith.
+		struct ZipWith{
+			// FUNCTION :
+			//        operator()
+			// 
+			// DESCRIPTION :
+			//        Writes F applied to the corresponding
+			//        elements of each input to the corresponding
+			//        element of OUT
+			// 
+			// PARAMETERS :
+			//        FN : class (Inferred)
+			//            Typename of a wrapped function. 
+			//
+			//        CO, CS : class (Inferred)
+			//            Types of the output and inputs: a
+			//            std::vector, std::array or Span
+			//
+			// ARGUMENTS : 
+			//        F : FN const&
+			//            Instantiation of a wrapped function
+			//            with one argument per input
+			//
+			//        OUT : CO&&
+			//            Output array, with the length of every
+			//            input. OUT may be one of the inputs.
+			//
+			//        IN : CS const&...
+			//            One or more input arrays
+			// 
+			// RETURNS : Span<TO>
+			//        A Span of OUT
+			template <class FN, class CO, class... CS>
+			auto operator()(FN const& F, CO&& OUT, CS const&... IN) const
+				-> decltype(span(OUT)){
+				static_assert(sizeof...(CS) > 0, "zipWith requires at least one input");
+				auto out = span(OUT);
+				std::size_t const sizes[] = {IN.size()...};
+				for(std::size_t j = 0; j < sizeof...(CS); ++j){
+					assert(sizes[j] == out.size());
+				}
+				(void)sizes;
+				for(std::size_t i = 0; i < out.size(); ++i){
+					out[i] = F(IN.data()[i]...);
+				}
+				return out;
+			}
+		};
+
+		// VARIABLE :
+		//        zipWith (instance of ZipWith)
+		// 
+		// DESCRIPTION :
+		//        Instantion of the runtime-length ZipWith struct
+		//        that provides a function-like API with the
+		//        operator() function.
+		//
+		// EXAMPLE :
+		//        std::vector<int> a = {1, 2}, b = {3, 4}, c(2);
+		//        dyn::zipWith(std::plus<int>(), c, a, b); // c === {4, 6}
+		ZipWith zipWith;
+	} // namespace dyn
 } // namespace hops
 #endif // __ZIP_HPP